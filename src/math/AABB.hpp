@@ -0,0 +1,139 @@
+#ifndef __MATH__AABB_HPP__
+#define __MATH__AABB_HPP__
+
+#include "Plane.hpp"
+#include "Span.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+// Axis-aligned box [min, max], closed on every face
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class AABB
+{
+  public:
+  static constexpr AABB<T> FromCenterExtent(const Vector3<T>& center, const Vector3<T>& extent) { return AABB<T>(center - extent, center + extent); }
+
+  // Smallest box around the points, the box of the origin when there are none
+  static AABB<T> FromPoints(Math::Span<const Vector3<T>> points)
+  {
+    if(points.IsEmpty())
+    {
+      return AABB<T>();
+    }
+
+    AABB<T> result(points[0], points[0]);
+    for(const Vector3<T>& point : points)
+    {
+      result = Merge(result, AABB<T>(point, point));
+    }
+
+    return result;
+  }
+
+  static constexpr AABB<T> Merge(const AABB<T>& a, const AABB<T>& b)
+  {
+    return AABB<T>(Vector3<T>(std::min(a.m_Min.GetX(), b.m_Min.GetX()), std::min(a.m_Min.GetY(), b.m_Min.GetY()), std::min(a.m_Min.GetZ(), b.m_Min.GetZ())),
+                   Vector3<T>(std::max(a.m_Max.GetX(), b.m_Max.GetX()), std::max(a.m_Max.GetY(), b.m_Max.GetY()), std::max(a.m_Max.GetZ(), b.m_Max.GetZ())));
+  }
+
+  constexpr bool operator==(const AABB<T>& rhs) const { return (m_Min == rhs.m_Min) && (m_Max == rhs.m_Max); }
+  constexpr bool operator!=(const AABB<T>& rhs) const { return !((*this) == rhs); }
+
+  constexpr bool Contains(const Vector3<T>& point) const
+  {
+    return (point.GetX() >= m_Min.GetX()) && (point.GetX() <= m_Max.GetX()) && (point.GetY() >= m_Min.GetY()) && (point.GetY() <= m_Max.GetY())
+           && (point.GetZ() >= m_Min.GetZ()) && (point.GetZ() <= m_Max.GetZ());
+  }
+
+  constexpr bool Contains(const AABB<T>& other) const { return Contains(other.m_Min) && Contains(other.m_Max); }
+
+  // Touching faces overlap
+  constexpr bool Overlaps(const AABB<T>& other) const
+  {
+    return (m_Min.GetX() <= other.m_Max.GetX()) && (m_Max.GetX() >= other.m_Min.GetX()) && (m_Min.GetY() <= other.m_Max.GetY())
+           && (m_Max.GetY() >= other.m_Min.GetY()) && (m_Min.GetZ() <= other.m_Max.GetZ()) && (m_Max.GetZ() >= other.m_Min.GetZ());
+  }
+
+  // Outside when even the corner farthest along the normal is behind the plane, inside when the nearest one is in front
+  constexpr Math::Containment Classify(const Plane<T>& plane) const
+  {
+    const Vector3<T>& normal = plane.GetNormal();
+    const Vector3<T> farthest((normal.GetX() >= static_cast<T>(0)) ? m_Max.GetX() : m_Min.GetX(),
+                              (normal.GetY() >= static_cast<T>(0)) ? m_Max.GetY() : m_Min.GetY(),
+                              (normal.GetZ() >= static_cast<T>(0)) ? m_Max.GetZ() : m_Min.GetZ());
+    if(plane.GetDistance(farthest) < static_cast<T>(0))
+    {
+      return Math::Containment::Outside;
+    }
+
+    const Vector3<T> nearest((normal.GetX() >= static_cast<T>(0)) ? m_Min.GetX() : m_Max.GetX(),
+                             (normal.GetY() >= static_cast<T>(0)) ? m_Min.GetY() : m_Max.GetY(),
+                             (normal.GetZ() >= static_cast<T>(0)) ? m_Min.GetZ() : m_Max.GetZ());
+    return (plane.GetDistance(nearest) >= static_cast<T>(0)) ? Math::Containment::Inside : Math::Containment::Intersecting;
+  }
+
+  // Slab test of the ray origin + t * direction for t in [0, maxDistance], distance is the entry t, zero from inside
+  bool Raycast(const Vector3<T>& origin, const Vector3<T>& direction, T& distance, T maxDistance = std::numeric_limits<T>::infinity()) const
+  {
+    T enter = static_cast<T>(0);
+    T exit  = maxDistance;
+    for(std::size_t axis = 0u; axis < 3u; axis++)
+    {
+      const T start = GetAxis(origin, axis);
+      const T step  = GetAxis(direction, axis);
+      const T low   = GetAxis(m_Min, axis);
+      const T high  = GetAxis(m_Max, axis);
+
+      // Parallel to the slab, 1 / 0 would turn a start on the face into 0 * infinity
+      if(step == static_cast<T>(0))
+      {
+        if((start < low) || (start > high))
+        {
+          return false;
+        }
+
+        continue;
+      }
+
+      const T inverse = static_cast<T>(1) / step;
+      const T near    = (low - start) * inverse;
+      const T far     = (high - start) * inverse;
+      enter           = std::max(enter, std::min(near, far));
+      exit            = std::min(exit, std::max(near, far));
+      if(enter > exit)
+      {
+        return false;
+      }
+    }
+
+    distance = enter;
+    return true;
+  }
+
+  constexpr Vector3<T> GetCenter() const { return (m_Min + m_Max) * static_cast<T>(0.5); }
+  constexpr Vector3<T> GetExtent() const { return (m_Max - m_Min) * static_cast<T>(0.5); }
+  constexpr Vector3<T> GetSize() const { return m_Max - m_Min; }
+
+  constexpr const Vector3<T>& GetMin() const { return m_Min; }
+  constexpr const Vector3<T>& GetMax() const { return m_Max; }
+
+  constexpr AABB(const Vector3<T>& min, const Vector3<T>& max)
+      : m_Min(min)
+      , m_Max(max)
+  {}
+
+  constexpr AABB() = default;
+
+  private:
+  static constexpr T GetAxis(const Vector3<T>& value, std::size_t axis) { return (axis == 0u) ? value.GetX() : ((axis == 1u) ? value.GetY() : value.GetZ()); }
+
+  Vector3<T> m_Min;
+  Vector3<T> m_Max;
+};
+
+#endif // __MATH__AABB_HPP__
@@ -0,0 +1,97 @@
+#include "AABB.hpp"
+#include "Plane.hpp"
+#include "Vector3.hpp"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class AABBTyped : public Test
+  {};
+
+  using AABBTypes = Types<float, double>;
+  TYPED_TEST_SUITE(AABBTyped, AABBTypes);
+
+  template<class T>
+  static Vector3<T> Make(double x, double y, double z)
+  {
+    return Vector3<T>(static_cast<T>(x), static_cast<T>(y), static_cast<T>(z));
+  }
+
+  TYPED_TEST(AABBTyped, Construction)
+  {
+    using T = TypeParam;
+
+    const AABB<T> box = AABB<T>::FromCenterExtent(Make<T>(1, 2, 3), Make<T>(1, 0.5, 2));
+    ASSERT_TRUE(box.GetMin() == Make<T>(0, 1.5, 1));
+    ASSERT_TRUE(box.GetMax() == Make<T>(2, 2.5, 5));
+    ASSERT_TRUE(box.GetCenter() == Make<T>(1, 2, 3));
+    ASSERT_TRUE(box.GetExtent() == Make<T>(1, 0.5, 2));
+    ASSERT_TRUE(box.GetSize() == Make<T>(2, 1, 4));
+
+    const std::vector<Vector3<T>> points = {Make<T>(1, -2, 0), Make<T>(-3, 4, 1), Make<T>(0, 0, -5)};
+    ASSERT_TRUE(AABB<T>::FromPoints(points) == AABB<T>(Make<T>(-3, -2, -5), Make<T>(1, 4, 1)));
+    ASSERT_TRUE(AABB<T>::FromPoints(Math::Span<const Vector3<T>>()) == AABB<T>());
+    ASSERT_TRUE(AABB<T>::Merge(box, AABB<T>(Make<T>(-1, 2, 2), Make<T>(0, 3, 3))) == AABB<T>(Make<T>(-1, 1.5, 1), Make<T>(2, 3, 5)));
+
+    static_assert(AABB<T>::FromCenterExtent(Vector3<T>::Zero, Vector3<T>::One).Contains(Vector3<T>::One));
+  }
+
+  TYPED_TEST(AABBTyped, Containment)
+  {
+    using T = TypeParam;
+
+    const AABB<T> box(Make<T>(0, 0, 0), Make<T>(2, 2, 2));
+    ASSERT_TRUE(box.Contains(Make<T>(1, 1, 1)));
+    ASSERT_TRUE(box.Contains(Make<T>(2, 0, 2)));
+    ASSERT_FALSE(box.Contains(Make<T>(2.5, 1, 1)));
+    ASSERT_TRUE(box.Contains(AABB<T>(Make<T>(0.5, 0.5, 0.5), Make<T>(2, 1, 1))));
+    ASSERT_FALSE(box.Contains(AABB<T>(Make<T>(0.5, 0.5, 0.5), Make<T>(3, 1, 1))));
+
+    // Touching faces overlap, a gap on any single axis separates
+    ASSERT_TRUE(box.Overlaps(AABB<T>(Make<T>(2, 1, 1), Make<T>(3, 3, 3))));
+    ASSERT_TRUE(box.Overlaps(AABB<T>(Make<T>(-1, -1, -1), Make<T>(3, 3, 3))));
+    ASSERT_FALSE(box.Overlaps(AABB<T>(Make<T>(0, 0, 2.5), Make<T>(2, 2, 3))));
+  }
+
+  TYPED_TEST(AABBTyped, Classify)
+  {
+    using T = TypeParam;
+
+    const AABB<T> box(Make<T>(0, 0, 0), Make<T>(2, 2, 2));
+    const Plane<T> diagonal = Plane<T>(Make<T>(1, 1, 0), static_cast<T>(0)).ToNormalized();
+    ASSERT_EQ(box.Classify(diagonal), Math::Containment::Inside);
+    ASSERT_EQ(box.Classify(diagonal.ToFlipped()), Math::Containment::Intersecting);
+    ASSERT_EQ(box.Classify(Plane<T>(Make<T>(-1, 0, 0), static_cast<T>(-3))), Math::Containment::Outside);
+    ASSERT_EQ(box.Classify(Plane<T>(Make<T>(0, 0, 1), static_cast<T>(-1))), Math::Containment::Intersecting);
+  }
+
+  TYPED_TEST(AABBTyped, Raycast)
+  {
+    using T = TypeParam;
+
+    const AABB<T> box(Make<T>(1, 1, 1), Make<T>(3, 3, 3));
+    T distance = static_cast<T>(-1);
+
+    ASSERT_TRUE(box.Raycast(Make<T>(0, 2, 2), Make<T>(2, 0, 0), distance));
+    ASSERT_EQ(distance, static_cast<T>(0.5));
+    ASSERT_TRUE(box.Raycast(Make<T>(2, 2, 2), Make<T>(0, -1, 0), distance));
+    ASSERT_EQ(distance, static_cast<T>(0));
+    ASSERT_TRUE(box.Raycast(Make<T>(-1, -1, -1), Make<T>(1, 1, 1), distance));
+    ASSERT_EQ(distance, static_cast<T>(2));
+
+    // Pointing away, missing, too short and parallel to a slab with the origin on a face
+    ASSERT_FALSE(box.Raycast(Make<T>(0, 2, 2), Make<T>(-1, 0, 0), distance));
+    ASSERT_FALSE(box.Raycast(Make<T>(0, 5, 2), Make<T>(1, 0, 0), distance));
+    ASSERT_FALSE(box.Raycast(Make<T>(0, 2, 2), Make<T>(1, 0, 0), distance, static_cast<T>(0.5)));
+    ASSERT_TRUE(box.Raycast(Make<T>(0, 1, 2), Make<T>(1, 0, 0), distance));
+    ASSERT_EQ(distance, static_cast<T>(1));
+    ASSERT_FALSE(box.Raycast(Make<T>(0, 0.5, 2), Make<T>(1, 0, 0), distance));
+  }
+} // namespace UnitTest
@@ -0,0 +1,56 @@
+#ifndef __MATH__ALIGNEDALLOCATOR_HPP__
+#define __MATH__ALIGNEDALLOCATOR_HPP__
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace Math
+{
+  template<class T, std::size_t Alignment = 64u>
+  class AlignedAllocator
+  {
+    public:
+    using value_type = T;
+
+    static constexpr std::size_t kAlignment = (Alignment < alignof(T)) ? alignof(T) : Alignment;
+
+    template<class U>
+    struct rebind
+    {
+      using other = AlignedAllocator<U, Alignment>;
+    };
+
+    T* allocate(std::size_t count)
+    {
+      if(count > (std::numeric_limits<std::size_t>::max() / sizeof(T)))
+      {
+        throw std::bad_array_new_length();
+      }
+
+      return static_cast<T*>(::operator new(count * sizeof(T), static_cast<std::align_val_t>(kAlignment)));
+    }
+
+    void deallocate(T* pointer, std::size_t) noexcept { ::operator delete(pointer, static_cast<std::align_val_t>(kAlignment)); }
+
+    template<class U>
+    constexpr bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept
+    {
+      return true;
+    }
+
+    template<class U>
+    constexpr bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept
+    {
+      return false;
+    }
+
+    constexpr AlignedAllocator() noexcept = default;
+
+    template<class U>
+    constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+    {}
+  };
+} // namespace Math
+
+#endif // __MATH__ALIGNEDALLOCATOR_HPP__
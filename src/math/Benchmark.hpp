@@ -0,0 +1,149 @@
+#ifndef __MATH__BENCHMARK_HPP__
+#define __MATH__BENCHMARK_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+/*
+ * Shared helpers of the *.bench.cpp files. Each benchmark is registered as Name<Type>/Size, where Size is the number of
+ * inputs handled per iteration and items_per_second counts those inputs, so runs of different sizes compare directly.
+ */
+namespace Benchmark
+{
+  template<class T>
+  constexpr const char* kTypeName = "?";
+
+  template<>
+  constexpr const char* kTypeName<float> = "float";
+
+  template<>
+  constexpr const char* kTypeName<double> = "double";
+
+  template<>
+  constexpr const char* kTypeName<int> = "int";
+
+  template<>
+  constexpr const char* kTypeName<std::uint32_t> = "uint32";
+
+  template<>
+  constexpr const char* kTypeName<std::uint64_t> = "uint64";
+
+  template<class T>
+  std::string Name(const char* name)
+  {
+    return std::string(name) + "<" + kTypeName<T> + ">";
+  }
+
+  // From a few cache lines to beyond the first level data cache
+  inline void Sizes(benchmark::internal::Benchmark* benchmark)
+  {
+    benchmark->RangeMultiplier(16)->Range(64, 16384);
+  }
+
+  // Deterministic inputs, within (-100, 100) and never zero for signed types so they can divide, [1, 2^20] for unsigned
+  template<class T>
+  T CreateScalar(std::size_t index)
+  {
+    const std::size_t hash = (index * 2654435761u) % 1048576u;
+    if constexpr(std::is_unsigned_v<T>)
+    {
+      return static_cast<T>(hash + 1u);
+    }
+    else if constexpr(std::is_integral_v<T>)
+    {
+      const int value = static_cast<int>(hash % 199u) - 99;
+      return static_cast<T>((value != 0) ? value : 100);
+    }
+    else
+    {
+      return static_cast<T>(((static_cast<double>(hash) + 0.5) / 5242.88) - 100.0);
+    }
+  }
+
+  template<class T>
+  std::vector<T> CreateScalars(std::size_t count)
+  {
+    std::vector<T> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      result.push_back(CreateScalar<T>(i));
+    }
+
+    return result;
+  }
+
+  inline void SetItems(benchmark::State& state, std::size_t count)
+  {
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+  }
+
+  // op(value) for each of the inputs made by create(count)
+  template<class Create, class Op>
+  benchmark::internal::Benchmark* RegisterUnary(const std::string& name, Create create, Op op)
+  {
+    return benchmark::RegisterBenchmark(name.c_str(),
+                                        [create, op](benchmark::State& state)
+                                        {
+                                          const auto values = create(static_cast<std::size_t>(state.range(0)));
+                                          for(auto _ : state)
+                                          {
+                                            for(const auto& value : values)
+                                            {
+                                              benchmark::DoNotOptimize(op(value));
+                                            }
+                                          }
+
+                                          SetItems(state, values.size());
+                                        })
+      ->Apply(Sizes);
+  }
+
+  // op(a, b) for each input paired with its neighbour
+  template<class Create, class Op>
+  benchmark::internal::Benchmark* RegisterBinary(const std::string& name, Create create, Op op)
+  {
+    return benchmark::RegisterBenchmark(name.c_str(),
+                                        [create, op](benchmark::State& state)
+                                        {
+                                          const std::size_t count = static_cast<std::size_t>(state.range(0));
+                                          const auto values       = create(count + 1u);
+                                          for(auto _ : state)
+                                          {
+                                            for(std::size_t i = 0u; i < count; i++)
+                                            {
+                                              benchmark::DoNotOptimize(op(values[i], values[i + 1u]));
+                                            }
+                                          }
+
+                                          SetItems(state, count);
+                                        })
+      ->Apply(Sizes);
+  }
+
+  // setup(count) prepares the inputs of a batch kernel and returns the call that runs it once over all of them
+  template<class Setup>
+  benchmark::internal::Benchmark* RegisterBatch(const std::string& name, Setup setup)
+  {
+    return benchmark::RegisterBenchmark(name.c_str(),
+                                        [setup](benchmark::State& state)
+                                        {
+                                          const std::size_t count = static_cast<std::size_t>(state.range(0));
+                                          auto run                = setup(count);
+                                          for(auto _ : state)
+                                          {
+                                            run();
+                                            benchmark::ClobberMemory();
+                                          }
+
+                                          SetItems(state, count);
+                                        })
+      ->Apply(Sizes);
+  }
+} // namespace Benchmark
+
+#endif // __MATH__BENCHMARK_HPP__
@@ -0,0 +1,126 @@
+#include "AABB.hpp"
+#include "Benchmark.hpp"
+#include "BoundsBatch.hpp"
+#include "Frustum.hpp"
+#include "Matrix4.hpp"
+#include "Sphere.hpp"
+#include "Vector3.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Benchmark
+{
+  // Spheres scattered in front of and around a 90 degree perspective so that roughly a third survive the cull
+  template<class T>
+  static std::vector<Sphere<T>> CreateSpheres(std::size_t count)
+  {
+    std::uint32_t state   = 12345u;
+    const auto coordinate = [&]()
+    {
+      state = (state * 1664525u) + 1013904223u;
+      return static_cast<T>((static_cast<double>(state >> 8u) / 83886.08) - 100.0);
+    };
+
+    std::vector<Sphere<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T x = coordinate();
+      const T y = coordinate();
+      result.push_back(Sphere<T>(Vector3<T>(x, y, coordinate()), static_cast<T>(1) + static_cast<T>(i % 4u)));
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static Frustum<T> CreateFrustum()
+  {
+    Matrix4<T> projection;
+    projection.Set(0u, 0u, static_cast<T>(1));
+    projection.Set(1u, 1u, static_cast<T>(1));
+    projection.Set(2u, 2u, static_cast<T>(-1.02));
+    projection.Set(2u, 3u, static_cast<T>(-2.02));
+    projection.Set(3u, 2u, static_cast<T>(-1));
+    return Frustum<T>::FromMatrix(projection);
+  }
+
+  template<class T>
+  static std::vector<AABB<T>> CreateBoxes(std::size_t count)
+  {
+    std::vector<AABB<T>> result;
+    for(const Sphere<T>& sphere : CreateSpheres<T>(count))
+    {
+      result.push_back(sphere.GetBounds());
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static bool RegisterBoundsBatch()
+  {
+    RegisterBatch(Name<T>("BoundsBatch_CullSpheresScalar"),
+                  [](std::size_t count)
+                  {
+                    return [spheres = CreateSpheres<T>(count), frustum = CreateFrustum<T>(), visible = std::vector<std::size_t>()]() mutable
+                    {
+                      visible.clear();
+                      for(std::size_t i = 0u; i < spheres.size(); i++)
+                      {
+                        if(frustum.Intersects(spheres[i]))
+                        {
+                          visible.push_back(i);
+                        }
+                      }
+
+                      benchmark::DoNotOptimize(visible.data());
+                    };
+                  });
+
+    RegisterBatch(Name<T>("BoundsBatch_CullSpheres"),
+                  [](std::size_t count)
+                  {
+                    const std::vector<Sphere<T>> values = CreateSpheres<T>(count);
+                    return [spheres = SphereArray<T>(values), frustum = CreateFrustum<T>(), visible = std::vector<std::size_t>()]() mutable
+                    {
+                      Math::Batch::Cull(frustum, spheres, visible);
+                      benchmark::DoNotOptimize(visible.data());
+                    };
+                  });
+
+    RegisterBatch(Name<T>("BoundsBatch_CullBoxesScalar"),
+                  [](std::size_t count)
+                  {
+                    return [boxes = CreateBoxes<T>(count), frustum = CreateFrustum<T>(), visible = std::vector<std::size_t>()]() mutable
+                    {
+                      visible.clear();
+                      for(std::size_t i = 0u; i < boxes.size(); i++)
+                      {
+                        if(frustum.Intersects(boxes[i]))
+                        {
+                          visible.push_back(i);
+                        }
+                      }
+
+                      benchmark::DoNotOptimize(visible.data());
+                    };
+                  });
+
+    RegisterBatch(Name<T>("BoundsBatch_CullBoxes"),
+                  [](std::size_t count)
+                  {
+                    const std::vector<AABB<T>> values = CreateBoxes<T>(count);
+                    return [boxes = AABBArray<T>(values), frustum = CreateFrustum<T>(), visible = std::vector<std::size_t>()]() mutable
+                    {
+                      Math::Batch::Cull(frustum, boxes, visible);
+                      benchmark::DoNotOptimize(visible.data());
+                    };
+                  });
+
+    return true;
+  }
+
+  static const bool kBoundsBatchRegistered = RegisterBoundsBatch<float>() && RegisterBoundsBatch<double>();
+} // namespace Benchmark
@@ -0,0 +1,346 @@
+#ifndef __MATH__BOUNDSBATCH_HPP__
+#define __MATH__BOUNDSBATCH_HPP__
+
+#include "AABB.hpp"
+#include "AlignedAllocator.hpp"
+#include "Frustum.hpp"
+#include "Simd.hpp"
+#include "Sphere.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// Structure-of-arrays storage for AABB, the corners kept as two Vector3Array
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class AABBArray
+{
+  public:
+  AABB<T> operator[](std::size_t index) const { return AABB<T>(m_Min[index], m_Max[index]); }
+
+  void Set(std::size_t index, const AABB<T>& value)
+  {
+    m_Min.Set(index, value.GetMin());
+    m_Max.Set(index, value.GetMax());
+  }
+
+  void PushBack(const AABB<T>& value)
+  {
+    m_Min.PushBack(value.GetMin());
+    m_Max.PushBack(value.GetMax());
+  }
+
+  void Resize(std::size_t size)
+  {
+    m_Min.Resize(size);
+    m_Max.Resize(size);
+  }
+
+  void Clear()
+  {
+    m_Min.Clear();
+    m_Max.Clear();
+  }
+
+  std::size_t GetSize() const { return m_Min.GetSize(); }
+  bool IsEmpty() const { return m_Min.IsEmpty(); }
+
+  const Vector3Array<T>& GetMin() const { return m_Min; }
+  const Vector3Array<T>& GetMax() const { return m_Max; }
+
+  AABBArray(Math::Span<const AABB<T>> values)
+  {
+    for(const AABB<T>& value : values)
+    {
+      PushBack(value);
+    }
+  }
+
+  AABBArray() = default;
+
+  private:
+  Vector3Array<T> m_Min;
+  Vector3Array<T> m_Max;
+};
+
+// Structure-of-arrays storage for Sphere, centers in a Vector3Array next to an aligned radius array
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class SphereArray
+{
+  public:
+  using Container = std::vector<T, Math::AlignedAllocator<T>>;
+
+  Sphere<T> operator[](std::size_t index) const { return Sphere<T>(m_Center[index], m_Radius[index]); }
+
+  void Set(std::size_t index, const Sphere<T>& value)
+  {
+    m_Center.Set(index, value.GetCenter());
+    m_Radius[index] = value.GetRadius();
+  }
+
+  void PushBack(const Sphere<T>& value)
+  {
+    m_Center.PushBack(value.GetCenter());
+    m_Radius.push_back(value.GetRadius());
+  }
+
+  void Resize(std::size_t size)
+  {
+    m_Center.Resize(size);
+    m_Radius.resize(size);
+  }
+
+  void Clear()
+  {
+    m_Center.Clear();
+    m_Radius.clear();
+  }
+
+  std::size_t GetSize() const { return m_Radius.size(); }
+  bool IsEmpty() const { return m_Radius.empty(); }
+
+  const Vector3Array<T>& GetCenter() const { return m_Center; }
+  Math::Span<const T> GetRadius() const { return Math::Span<const T>(m_Radius); }
+
+  SphereArray(Math::Span<const Sphere<T>> values)
+  {
+    for(const Sphere<T>& value : values)
+    {
+      PushBack(value);
+    }
+  }
+
+  SphereArray() = default;
+
+  private:
+  Vector3Array<T> m_Center;
+  Container m_Radius;
+};
+
+namespace Math::Batch
+{
+  // The tests below match the single object ones plane by plane, out receives the passing indices in increasing order
+
+  // Spheres not entirely behind one of the planes, as Frustum::Intersects
+  template<class T>
+  void Cull(const Frustum<T>& frustum, const SphereArray<T>& spheres, std::vector<std::size_t>& visible)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Bounds::Cull", spheres.GetSize());
+
+    using Register = typename Math::Simd::Traits<T>::Register;
+
+    const T* cx = spheres.GetCenter().GetX().GetData();
+    const T* cy = spheres.GetCenter().GetY().GetData();
+    const T* cz = spheres.GetCenter().GetZ().GetData();
+    const T* r  = spheres.GetRadius().GetData();
+
+    const auto packed = [&](std::size_t i)
+    {
+      const Register x      = Math::Simd::Load(cx + i);
+      const Register y      = Math::Simd::Load(cy + i);
+      const Register z      = Math::Simd::Load(cz + i);
+      const Register radius = Math::Simd::Load(r + i);
+      const Register zero   = Math::Simd::Broadcast(static_cast<T>(0));
+
+      int mask = 0xF;
+      for(const Plane<T>& plane : frustum.GetPlanes())
+      {
+        const Vector3<T>& n = plane.GetNormal();
+        const Register xy   = Math::Simd::Add(Math::Simd::Multiply(Math::Simd::Broadcast(n.GetX()), x),
+                                              Math::Simd::Multiply(Math::Simd::Broadcast(n.GetY()), y));
+        const Register xyz  = Math::Simd::Add(xy, Math::Simd::Multiply(Math::Simd::Broadcast(n.GetZ()), z));
+        const Register d    = Math::Simd::Add(xyz, Math::Simd::Broadcast(plane.GetOffset()));
+        mask &= Math::Simd::GreaterEqualMask(Math::Simd::Add(d, radius), zero);
+      }
+
+      return mask;
+    };
+
+    const auto scalar = [&](std::size_t i)
+    {
+      for(const Plane<T>& plane : frustum.GetPlanes())
+      {
+        const Vector3<T>& n = plane.GetNormal();
+        const T d           = (((n.GetX() * cx[i]) + (n.GetY() * cy[i])) + (n.GetZ() * cz[i])) + plane.GetOffset();
+        if(!((d + r[i]) >= static_cast<T>(0)))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    };
+
+    Math::Detail::CompactIndices<T>(spheres.GetSize(), visible, packed, scalar);
+  }
+
+  // Boxes whose corner farthest along each plane normal is not behind that plane, as Frustum::Intersects
+  template<class T>
+  void Cull(const Frustum<T>& frustum, const AABBArray<T>& boxes, std::vector<std::size_t>& visible)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Bounds::Cull", boxes.GetSize());
+
+    using Register = typename Math::Simd::Traits<T>::Register;
+
+    // Per plane, the component arrays holding its farthest corner
+    const T* corners[6][3];
+    for(std::size_t p = 0u; p < 6u; p++)
+    {
+      const Vector3<T>& n = frustum.GetPlane(p).GetNormal();
+      corners[p][0]       = ((n.GetX() >= static_cast<T>(0)) ? boxes.GetMax() : boxes.GetMin()).GetX().GetData();
+      corners[p][1]       = ((n.GetY() >= static_cast<T>(0)) ? boxes.GetMax() : boxes.GetMin()).GetY().GetData();
+      corners[p][2]       = ((n.GetZ() >= static_cast<T>(0)) ? boxes.GetMax() : boxes.GetMin()).GetZ().GetData();
+    }
+
+    const auto packed = [&](std::size_t i)
+    {
+      const Register zero = Math::Simd::Broadcast(static_cast<T>(0));
+
+      int mask = 0xF;
+      for(std::size_t p = 0u; p < 6u; p++)
+      {
+        const Plane<T>& plane = frustum.GetPlane(p);
+        const Vector3<T>& n   = plane.GetNormal();
+        const Register xy     = Math::Simd::Add(Math::Simd::Multiply(Math::Simd::Broadcast(n.GetX()), Math::Simd::Load(corners[p][0] + i)),
+                                                Math::Simd::Multiply(Math::Simd::Broadcast(n.GetY()), Math::Simd::Load(corners[p][1] + i)));
+        const Register d = Math::Simd::Add(Math::Simd::Add(xy, Math::Simd::Multiply(Math::Simd::Broadcast(n.GetZ()), Math::Simd::Load(corners[p][2] + i))),
+                                           Math::Simd::Broadcast(plane.GetOffset()));
+        mask &= Math::Simd::GreaterEqualMask(d, zero);
+      }
+
+      return mask;
+    };
+
+    const auto scalar = [&](std::size_t i)
+    {
+      for(std::size_t p = 0u; p < 6u; p++)
+      {
+        const Plane<T>& plane = frustum.GetPlane(p);
+        const Vector3<T>& n   = plane.GetNormal();
+        const T d = (((n.GetX() * corners[p][0][i]) + (n.GetY() * corners[p][1][i])) + (n.GetZ() * corners[p][2][i])) + plane.GetOffset();
+        if(!(d >= static_cast<T>(0)))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    };
+
+    Math::Detail::CompactIndices<T>(boxes.GetSize(), visible, packed, scalar);
+  }
+
+  // Boxes overlapping box, as AABB::Overlaps
+  template<class T>
+  void Overlap(const AABB<T>& box, const AABBArray<T>& boxes, std::vector<std::size_t>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Bounds::Overlap", boxes.GetSize());
+
+    const T* min[3] = {boxes.GetMin().GetX().GetData(), boxes.GetMin().GetY().GetData(), boxes.GetMin().GetZ().GetData()};
+    const T* max[3] = {boxes.GetMax().GetX().GetData(), boxes.GetMax().GetY().GetData(), boxes.GetMax().GetZ().GetData()};
+    const T low[3]  = {box.GetMin().GetX(), box.GetMin().GetY(), box.GetMin().GetZ()};
+    const T high[3] = {box.GetMax().GetX(), box.GetMax().GetY(), box.GetMax().GetZ()};
+
+    const auto packed = [&](std::size_t i)
+    {
+      int mask = 0xF;
+      for(std::size_t axis = 0u; axis < 3u; axis++)
+      {
+        mask &= Math::Simd::GreaterEqualMask(Math::Simd::Broadcast(high[axis]), Math::Simd::Load(min[axis] + i));
+        mask &= Math::Simd::GreaterEqualMask(Math::Simd::Load(max[axis] + i), Math::Simd::Broadcast(low[axis]));
+      }
+
+      return mask;
+    };
+
+    const auto scalar = [&](std::size_t i)
+    {
+      bool result = true;
+      for(std::size_t axis = 0u; axis < 3u; axis++)
+      {
+        result = result && (high[axis] >= min[axis][i]) && (max[axis][i] >= low[axis]);
+      }
+
+      return result;
+    };
+
+    Math::Detail::CompactIndices<T>(boxes.GetSize(), out, packed, scalar);
+  }
+
+  // Spheres overlapping sphere, as Sphere::Overlaps
+  template<class T>
+  void Overlap(const Sphere<T>& sphere, const SphereArray<T>& spheres, std::vector<std::size_t>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Bounds::Overlap", spheres.GetSize());
+
+    using Register = typename Math::Simd::Traits<T>::Register;
+
+    const T* cx = spheres.GetCenter().GetX().GetData();
+    const T* cy = spheres.GetCenter().GetY().GetData();
+    const T* cz = spheres.GetCenter().GetZ().GetData();
+    const T* r  = spheres.GetRadius().GetData();
+
+    const auto packed = [&](std::size_t i)
+    {
+      const Register dx    = Math::Simd::Subtract(Math::Simd::Broadcast(sphere.GetCenter().GetX()), Math::Simd::Load(cx + i));
+      const Register dy    = Math::Simd::Subtract(Math::Simd::Broadcast(sphere.GetCenter().GetY()), Math::Simd::Load(cy + i));
+      const Register dz    = Math::Simd::Subtract(Math::Simd::Broadcast(sphere.GetCenter().GetZ()), Math::Simd::Load(cz + i));
+      const Register reach = Math::Simd::Add(Math::Simd::Broadcast(sphere.GetRadius()), Math::Simd::Load(r + i));
+      const Register xy    = Math::Simd::Add(Math::Simd::Multiply(dx, dx), Math::Simd::Multiply(dy, dy));
+      return Math::Simd::GreaterEqualMask(Math::Simd::Multiply(reach, reach), Math::Simd::Add(xy, Math::Simd::Multiply(dz, dz)));
+    };
+
+    const auto scalar = [&](std::size_t i)
+    {
+      const T dx    = sphere.GetCenter().GetX() - cx[i];
+      const T dy    = sphere.GetCenter().GetY() - cy[i];
+      const T dz    = sphere.GetCenter().GetZ() - cz[i];
+      const T reach = sphere.GetRadius() + r[i];
+      return (reach * reach) >= (((dx * dx) + (dy * dy)) + (dz * dz));
+    };
+
+    Math::Detail::CompactIndices<T>(spheres.GetSize(), out, packed, scalar);
+  }
+
+  // Points inside box, as AABB::Contains
+  template<class T>
+  void Contains(const AABB<T>& box, const Vector3Array<T>& points, std::vector<std::size_t>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Bounds::Contains", points.GetSize());
+
+    const T* p[3]   = {points.GetX().GetData(), points.GetY().GetData(), points.GetZ().GetData()};
+    const T low[3]  = {box.GetMin().GetX(), box.GetMin().GetY(), box.GetMin().GetZ()};
+    const T high[3] = {box.GetMax().GetX(), box.GetMax().GetY(), box.GetMax().GetZ()};
+
+    const auto packed = [&](std::size_t i)
+    {
+      int mask = 0xF;
+      for(std::size_t axis = 0u; axis < 3u; axis++)
+      {
+        const auto value = Math::Simd::Load(p[axis] + i);
+        mask &= Math::Simd::GreaterEqualMask(value, Math::Simd::Broadcast(low[axis]));
+        mask &= Math::Simd::GreaterEqualMask(Math::Simd::Broadcast(high[axis]), value);
+      }
+
+      return mask;
+    };
+
+    const auto scalar = [&](std::size_t i)
+    {
+      bool result = true;
+      for(std::size_t axis = 0u; axis < 3u; axis++)
+      {
+        result = result && (p[axis][i] >= low[axis]) && (high[axis] >= p[axis][i]);
+      }
+
+      return result;
+    };
+
+    Math::Detail::CompactIndices<T>(points.GetSize(), out, packed, scalar);
+  }
+} // namespace Math::Batch
+
+#endif // __MATH__BOUNDSBATCH_HPP__
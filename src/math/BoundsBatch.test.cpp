@@ -0,0 +1,133 @@
+#include "AABB.hpp"
+#include "BoundsBatch.hpp"
+#include "Frustum.hpp"
+#include "Matrix4.hpp"
+#include "Sphere.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class BoundsBatchTyped : public Test
+  {};
+
+  using BoundsBatchTypes = Types<float, double>;
+  TYPED_TEST_SUITE(BoundsBatchTyped, BoundsBatchTypes);
+
+  // Coordinates on a coarse grid of quarter units keep every test away from rounding ties
+  template<class T>
+  static T CreateCoordinate(std::uint32_t& state, int range)
+  {
+    state = (state * 1664525u) + 1013904223u;
+    return static_cast<T>(static_cast<int>((state >> 8u) % static_cast<std::uint32_t>(8 * range)) - (4 * range)) * static_cast<T>(0.25) + static_cast<T>(0.125);
+  }
+
+  template<class T>
+  static Frustum<T> CreateFrustum()
+  {
+    Matrix4<T> projection;
+    projection.Set(0u, 0u, static_cast<T>(1));
+    projection.Set(1u, 1u, static_cast<T>(2));
+    projection.Set(2u, 2u, static_cast<T>(-1.02));
+    projection.Set(2u, 3u, static_cast<T>(-2.02));
+    projection.Set(3u, 2u, static_cast<T>(-1));
+    return Frustum<T>::FromMatrix(projection);
+  }
+
+  TYPED_TEST(BoundsBatchTyped, Cull)
+  {
+    using T = TypeParam;
+
+    // An odd count leaves a scalar tail after the packed blocks
+    std::uint32_t state = 7u;
+    std::vector<Sphere<T>> spheres;
+    std::vector<AABB<T>> boxes;
+    for(std::size_t i = 0u; i < 1003u; i++)
+    {
+      const Vector3<T> center(CreateCoordinate<T>(state, 40), CreateCoordinate<T>(state, 40), CreateCoordinate<T>(state, 60));
+      const T size = static_cast<T>(1) + static_cast<T>(i % 5u);
+      spheres.push_back(Sphere<T>(center, size));
+      boxes.push_back(AABB<T>::FromCenterExtent(center, Vector3<T>(size, size * static_cast<T>(0.5), size * static_cast<T>(2))));
+    }
+
+    const Frustum<T> frustum = CreateFrustum<T>();
+    const SphereArray<T> sphereArray(spheres);
+    const AABBArray<T> boxArray(boxes);
+    ASSERT_EQ(sphereArray.GetSize(), spheres.size());
+    ASSERT_TRUE(boxArray[17] == boxes[17]);
+    ASSERT_TRUE(sphereArray[17] == spheres[17]);
+
+    std::vector<std::size_t> expectedSpheres;
+    std::vector<std::size_t> expectedBoxes;
+    for(std::size_t i = 0u; i < spheres.size(); i++)
+    {
+      if(frustum.Intersects(spheres[i])) expectedSpheres.push_back(i);
+      if(frustum.Intersects(boxes[i])) expectedBoxes.push_back(i);
+    }
+
+    // Some of each, so the test would notice an index list stuck at none or all
+    ASSERT_GT(expectedSpheres.size(), 50u);
+    ASSERT_LT(expectedSpheres.size(), 950u);
+
+    std::vector<std::size_t> visible;
+    Math::Batch::Cull(frustum, sphereArray, visible);
+    ASSERT_EQ(visible, expectedSpheres);
+    Math::Batch::Cull(frustum, boxArray, visible);
+    ASSERT_EQ(visible, expectedBoxes);
+
+    Math::Batch::Cull(frustum, SphereArray<T>(), visible);
+    ASSERT_TRUE(visible.empty());
+  }
+
+  TYPED_TEST(BoundsBatchTyped, Overlap)
+  {
+    using T = TypeParam;
+
+    std::uint32_t state = 3u;
+    std::vector<Sphere<T>> spheres;
+    std::vector<AABB<T>> boxes;
+    std::vector<Vector3<T>> points;
+    for(std::size_t i = 0u; i < 258u; i++)
+    {
+      const Vector3<T> center(CreateCoordinate<T>(state, 10), CreateCoordinate<T>(state, 10), CreateCoordinate<T>(state, 10));
+      spheres.push_back(Sphere<T>(center, static_cast<T>(1.5)));
+      boxes.push_back(AABB<T>::FromCenterExtent(center, Vector3<T>(static_cast<T>(1), static_cast<T>(2), static_cast<T>(0.5))));
+      points.push_back(center);
+    }
+
+    const AABB<T> box(Vector3<T>(static_cast<T>(-3), static_cast<T>(-6), static_cast<T>(-1)),
+                      Vector3<T>(static_cast<T>(4), static_cast<T>(2), static_cast<T>(5)));
+    const Sphere<T> sphere(Vector3<T>(static_cast<T>(1), static_cast<T>(-1), static_cast<T>(2)), static_cast<T>(4));
+
+    std::vector<std::size_t> expectedBoxes;
+    std::vector<std::size_t> expectedSpheres;
+    std::vector<std::size_t> expectedPoints;
+    for(std::size_t i = 0u; i < boxes.size(); i++)
+    {
+      if(box.Overlaps(boxes[i])) expectedBoxes.push_back(i);
+      if(sphere.Overlaps(spheres[i])) expectedSpheres.push_back(i);
+      if(box.Contains(points[i])) expectedPoints.push_back(i);
+    }
+
+    ASSERT_FALSE(expectedBoxes.empty());
+    ASSERT_FALSE(expectedSpheres.empty());
+    ASSERT_FALSE(expectedPoints.empty());
+
+    std::vector<std::size_t> out;
+    Math::Batch::Overlap(box, AABBArray<T>(boxes), out);
+    ASSERT_EQ(out, expectedBoxes);
+    Math::Batch::Overlap(sphere, SphereArray<T>(spheres), out);
+    ASSERT_EQ(out, expectedSpheres);
+    Math::Batch::Contains(box, Vector3Array<T>(points), out);
+    ASSERT_EQ(out, expectedPoints);
+  }
+} // namespace UnitTest
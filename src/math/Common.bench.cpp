@@ -0,0 +1,82 @@
+#include "Benchmark.hpp"
+#include "Common.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace Benchmark
+{
+  // Odd inputs near the top of the range, most of them reach the Miller-Rabin rounds
+  template<class T>
+  static std::vector<T> CreatePrimeCandidates(std::size_t count)
+  {
+    std::vector<T> result = CreateScalars<T>(count);
+    for(T& value : result)
+    {
+      value = static_cast<T>(std::numeric_limits<T>::max() - (value * static_cast<T>(2)));
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static bool RegisterCommon()
+  {
+    const auto create = &CreateScalars<T>;
+    constexpr T kMin  = static_cast<T>(std::is_signed_v<T> ? -100 : 1);
+    constexpr T kMax  = static_cast<T>(100);
+
+    if constexpr(std::is_signed_v<T>)
+    {
+      // Lerp takes a float fraction for float and a double one otherwise
+      using Fraction = std::conditional_t<std::is_same_v<T, float>, float, double>;
+
+      RegisterUnary(Name<T>("Common_Sign"), create, [](T value) { return Math::Sign(value); });
+      RegisterBinary(Name<T>("Common_Equals"), create, [](T a, T b) { return Math::Equals(a, b); });
+      RegisterBinary(Name<T>("Common_Delta"), create, [](T a, T b) { return Math::Delta(a, b); });
+      RegisterUnary(Name<T>("Common_Reverse"), create, [=](T value) { return Math::Reverse(value, kMin, kMax); });
+      RegisterBinary(Name<T>("Common_Midpoint"), create, [](T a, T b) { return Math::Midpoint(a, b); });
+      RegisterUnary(Name<T>("Common_Clamp"), create, [](T value) { return Math::Clamp(value, static_cast<T>(-50), static_cast<T>(50)); });
+      RegisterUnary(Name<T>("Common_Clamp01"), create, [](T value) { return Math::Clamp01(value); });
+      RegisterUnary(Name<T>("Common_Clamp11"), create, [](T value) { return Math::Clamp11(value); });
+      RegisterUnary(Name<T>("Common_Normalize"), create, [=](T value) { return Math::Normalize(value, kMin, kMax, static_cast<T>(10), static_cast<T>(20)); });
+      RegisterUnary(Name<T>("Common_Normalize01"), create, [=](T value) { return Math::Normalize01(value, kMin, kMax); });
+      RegisterUnary(Name<T>("Common_Denormalize01"), create, [=](T value) { return Math::Denormalize01(value, kMin, kMax); });
+      RegisterUnary(Name<T>("Common_Normalize11"), create, [=](T value) { return Math::Normalize11(value, kMin, kMax); });
+      RegisterUnary(Name<T>("Common_Denormalize11"), create, [=](T value) { return Math::Denormalize11(value, kMin, kMax); });
+      RegisterBinary(Name<T>("Common_Lerp"), create, [](T a, T b) { return Math::Lerp(a, b, static_cast<Fraction>(0.3)); });
+      RegisterUnary(Name<T>("Common_Sqrt"), create, [](T value) { return Math::Sqrt((value < static_cast<T>(0)) ? -value : value); });
+      RegisterUnary(Name<T>("Common_NumericLength"), create, [](T value) { return Math::NumericLength(value * static_cast<T>(997)); });
+    }
+
+    if constexpr(std::is_signed_v<T> && std::is_integral_v<T>)
+    {
+      // The floating point instantiation of Distance goes through ::abs(int), so only integers are measured
+      RegisterBinary(Name<T>("Common_Distance"), create, [](T a, T b) { return Math::Distance(a, b); });
+      RegisterUnary(Name<T>("Common_NumericLengthBase7"), create, [](T value) { return Math::NumericLength<7>(value * static_cast<T>(997)); });
+    }
+
+    if constexpr(std::is_floating_point_v<T>)
+    {
+      RegisterUnary(Name<T>("Common_Sin"), create, [](T value) { return Math::Sin(value); });
+      RegisterUnary(Name<T>("Common_Cos"), create, [](T value) { return Math::Cos(value); });
+      RegisterUnary(Name<T>("Common_Acos"), create, [](T value) { return Math::Acos(value / static_cast<T>(100)); });
+    }
+
+    if constexpr(std::is_unsigned_v<T>)
+    {
+      RegisterUnary(Name<T>("Common_IsPowerOfTwo"), create, [](T value) { return Math::IsPowerOfTwo(value); });
+      RegisterUnary(Name<T>("Common_IsPrime"), &CreatePrimeCandidates<T>, [](T value) { return Math::IsPrime(value); });
+      RegisterUnary(Name<T>("Common_DivisorSum"), create, [](T value) { return Math::DivisorSum(value); });
+      RegisterUnary(Name<T>("Common_IsPerfect"), create, [](T value) { return Math::IsPerfect(value); });
+    }
+
+    return true;
+  }
+
+  static const bool kCommonRegistered = RegisterCommon<float>() && RegisterCommon<double>() && RegisterCommon<int>() && RegisterCommon<std::uint32_t>()
+                                        && RegisterCommon<std::uint64_t>();
+} // namespace Benchmark
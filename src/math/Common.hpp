@@ -1,14 +1,348 @@
 #ifndef __MATH__COMMON_HPP__
 #define __MATH__COMMON_HPP__
 
+#include "Instrumentation.hpp"
+
 #include <algorithm>
+#include <cassert>
+#include <charconv>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <limits>
+#include <system_error>
 #include <type_traits>
 
+#if __has_include(<bit>)
+#include <bit>
+#endif
+
+namespace Math::Detail
+{
+#if defined(__SIZEOF_INT128__)
+  __extension__ using UInt128 = unsigned __int128;
+#endif
+
+  // (a * b) % modulus without overflow, a and b must already be reduced
+  constexpr std::uint64_t MultiplyModulo(std::uint64_t a, std::uint64_t b, std::uint64_t modulus)
+  {
+    if(modulus <= std::numeric_limits<std::uint32_t>::max())
+    {
+      return (a * b) % modulus;
+    }
+
+#if defined(__SIZEOF_INT128__)
+    return static_cast<std::uint64_t>((static_cast<UInt128>(a) * b) % modulus);
+#else
+    std::uint64_t result = 0u;
+    while(b != 0u)
+    {
+      if((b & 1u) != 0u)
+      {
+        result = (result >= (modulus - a)) ? (result - (modulus - a)) : (result + a);
+      }
+
+      a = (a >= (modulus - a)) ? (a - (modulus - a)) : (a + a);
+      b >>= 1u;
+    }
+
+    return result;
+#endif
+  }
+
+  constexpr std::uint64_t PowerModulo(std::uint64_t base, std::uint64_t exponent, std::uint64_t modulus)
+  {
+    std::uint64_t result = 1u % modulus;
+    base %= modulus;
+    while(exponent != 0u)
+    {
+      if((exponent & 1u) != 0u)
+      {
+        result = MultiplyModulo(result, base, modulus);
+      }
+
+      base = MultiplyModulo(base, base, modulus);
+      exponent >>= 1u;
+    }
+
+    return result;
+  }
+
+  constexpr int BitWidth(std::uint64_t value)
+  {
+#if defined(__cpp_lib_bitops)
+    return 64 - std::countl_zero(value);
+#elif defined(__GNUC__) || defined(__clang__)
+    return (value == 0u) ? 0 : (64 - __builtin_clzll(value));
+#else
+    int result = 0;
+    for(; value != 0u; value >>= 1u)
+    {
+      result++;
+    }
+
+    return result;
+#endif
+  }
+
+  template<class T>
+  constexpr std::uint64_t Magnitude(T value)
+  {
+    if constexpr(std::is_signed_v<T>)
+    {
+      // Negating in unsigned arithmetic keeps the minimum value well defined
+      return (value < static_cast<T>(0)) ? (0u - static_cast<std::uint64_t>(value)) : static_cast<std::uint64_t>(value);
+    }
+    else
+    {
+      return static_cast<std::uint64_t>(value);
+    }
+  }
+
+  constexpr std::uint64_t kPowersOfTen[] = {1u,
+                                            10u,
+                                            100u,
+                                            1000u,
+                                            10000u,
+                                            100000u,
+                                            1000000u,
+                                            10000000u,
+                                            100000000u,
+                                            1000000000u,
+                                            10000000000u,
+                                            100000000000u,
+                                            1000000000000u,
+                                            10000000000000u,
+                                            100000000000000u,
+                                            1000000000000000u,
+                                            10000000000000000u,
+                                            100000000000000000u,
+                                            1000000000000000000u,
+                                            10000000000000000000u};
+
+  // log10(2) ~ 1233 / 4096 estimates the digits from the bit width, one table lookup corrects the estimate
+  constexpr std::size_t DecimalLength(std::uint64_t value)
+  {
+    // Zero has one digit, setting the low bit never moves a value across a power of ten
+    value |= 1u;
+
+    const std::size_t estimate = (static_cast<std::size_t>(BitWidth(value)) * 1233u) >> 12u;
+    return (estimate + 1u) - ((value < kPowersOfTen[estimate]) ? 1u : 0u);
+  }
+
+  constexpr std::size_t BinaryLength(std::uint64_t value, unsigned int bitsPerDigit)
+  {
+    return (static_cast<std::size_t>(BitWidth(value | 1u)) + (bitsPerDigit - 1u)) / bitsPerDigit;
+  }
+
+  constexpr std::size_t GenericLength(std::uint64_t value, std::uint64_t radix)
+  {
+    std::size_t result = 1u;
+    for(; value >= radix; value /= radix)
+    {
+      result++;
+    }
+
+    return result;
+  }
+
+  // Strong probable prime test of an odd value > 2 against every witness
+  constexpr bool MillerRabin(std::uint64_t value, const std::uint64_t* witnesses, std::size_t count)
+  {
+    std::uint64_t odd     = value - 1u;
+    unsigned int twoPower = 0u;
+    while((odd & 1u) == 0u)
+    {
+      odd >>= 1u;
+      twoPower++;
+    }
+
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const std::uint64_t witness = witnesses[i] % value;
+      if(witness == 0u)
+      {
+        continue;
+      }
+
+      std::uint64_t x = PowerModulo(witness, odd, value);
+      if((x == 1u) || (x == (value - 1u)))
+      {
+        continue;
+      }
+
+      bool composite = true;
+      for(unsigned int r = 1u; r < twoPower; r++)
+      {
+        x = MultiplyModulo(x, x, value);
+        if(x == (value - 1u))
+        {
+          composite = false;
+          break;
+        }
+      }
+
+      if(composite)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  // True while the enclosing call runs as a constant expression, constexpr code uses it to step around intrinsics and <cmath>
+  constexpr bool IsConstantEvaluated()
+  {
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#else
+    return __builtin_is_constant_evaluated();
+#endif
+  }
+
+  /*
+   * Correctly rounded square root of a positive finite value for constant evaluation. The significand is scaled to an
+   * integer with an odd number of bits, and its root is taken digit by digit with two spare bits for rounding, so the
+   * result is bit-identical to std::sqrt.
+   */
+  template<class T>
+  constexpr T ExactSqrt(T value)
+  {
+    static_assert(std::numeric_limits<T>::digits < 60, "The remainder of the digit-by-digit root must fit 64 bits");
+
+    constexpr int kDigits    = std::numeric_limits<T>::digits;
+    constexpr int kOddDigits = kDigits | 1;
+    constexpr int kShift     = kOddDigits + 1;
+    constexpr int kExtra     = kShift - kDigits;
+    constexpr T kTop         = static_cast<T>(std::uint64_t(1) << kOddDigits);
+    constexpr T kBottom      = kTop / static_cast<T>(2);
+    constexpr T kStep        = static_cast<T>(4294967296.0);
+    constexpr T kTwo         = static_cast<T>(2);
+
+    // value == radicand * 2^exponent with the radicand in [2^(kOddDigits - 1), 2^kOddDigits), every scaling step is exact
+    int exponent  = 0;
+    T significand = value;
+    for(; significand >= (kTop * kStep); exponent += 32) significand /= kStep;
+    for(; significand >= kTop; exponent++) significand /= kTwo;
+    for(; (significand * kStep) < kBottom; exponent -= 32) significand *= kStep;
+    for(; significand < kBottom; exponent--) significand *= kTwo;
+
+    std::uint64_t radicand = static_cast<std::uint64_t>(significand);
+    if((exponent % 2) != 0)
+    {
+      radicand <<= 1u;
+      exponent--;
+    }
+
+    // Root of radicand << kShift two bits at a time, the shifted-in bits are all zero
+    std::uint64_t root      = 0u;
+    std::uint64_t remainder = 0u;
+    for(int position = 2 * kOddDigits; position >= 0; position -= 2)
+    {
+      const std::uint64_t pair  = (position >= kShift) ? ((radicand >> (position - kShift)) & 3u) : 0u;
+      const std::uint64_t trial = (root << 2u) | 1u;
+      remainder                 = (remainder << 2u) | pair;
+      root <<= 1u;
+      if(remainder >= trial)
+      {
+        remainder -= trial;
+        root |= 1u;
+      }
+    }
+
+    const std::uint64_t half = std::uint64_t(1) << (kExtra - 1);
+    const std::uint64_t low  = root & ((std::uint64_t(1) << kExtra) - 1u);
+    std::uint64_t rounded    = root >> kExtra;
+    if((low > half) || ((low == half) && ((remainder != 0u) || ((rounded & 1u) != 0u))))
+    {
+      rounded++;
+    }
+
+    T result  = static_cast<T>(rounded);
+    int scale = ((exponent - kShift) / 2) + kExtra;
+    for(; scale >= 32; scale -= 32) result *= kStep;
+    for(; scale > 0; scale--) result *= kTwo;
+    for(; scale <= -32; scale += 32) result /= kStep;
+    for(; scale < 0; scale++) result /= kTwo;
+
+    return result;
+  }
+
+  // Newton iteration from above for types too wide for ExactSqrt, stops once the estimate no longer decreases
+  template<class T>
+  constexpr T NewtonSqrt(T value)
+  {
+    if(value == static_cast<T>(0))
+    {
+      return value;
+    }
+
+    T estimate = (value > static_cast<T>(1)) ? value : static_cast<T>(1);
+    for(;;)
+    {
+      const T next = (estimate + (value / estimate)) / static_cast<T>(2);
+      if(!(next < estimate))
+      {
+        return estimate;
+      }
+
+      estimate = next;
+    }
+  }
+
+  constexpr long double kPi     = 3.141592653589793238462643383279502884L;
+  constexpr long double kHalfPi = 1.570796326794896619231321691639751442L;
+
+  // Sine or cosine in long double: the argument is reduced to [-pi/4, pi/4] around the nearest quarter turn and the
+  // Taylor series of sin or cos of the remainder runs until its terms vanish
+  constexpr long double SineCosine(long double value, bool cosine)
+  {
+    const long double turns     = value / kHalfPi;
+    const std::int64_t nearest  = static_cast<std::int64_t>((turns < 0.0L) ? (turns - 0.5L) : (turns + 0.5L));
+    const long double reduced   = value - (static_cast<long double>(nearest) * kHalfPi);
+    const std::int64_t quadrant = (((nearest % 4) + 4) + (cosine ? 1 : 0)) % 4;
+    const long double square    = reduced * reduced;
+    const bool useCosine        = (quadrant % 2) != 0;
+
+    long double term = useCosine ? 1.0L : reduced;
+    long double sum  = term;
+    for(int n = useCosine ? 1 : 2; (term != 0.0L) && (n < 40); n += 2)
+    {
+      term *= -square / static_cast<long double>(n * (n + 1));
+      sum += term;
+    }
+
+    return (quadrant >= 2) ? -sum : sum;
+  }
+
+  // asin for |value| <= 0.5 by Newton iteration on sin, where cos stays above 0.86 and convergence is quadratic
+  constexpr long double ArcSineSmall(long double value)
+  {
+    long double angle = value;
+    for(int i = 0; i < 8; i++)
+    {
+      angle -= (SineCosine(angle, false) - value) / SineCosine(angle, true);
+    }
+
+    return angle;
+  }
+} // namespace Math::Detail
+
 namespace Math
 {
+  // Scalars the vector types accept: signed arithmetic types and any type with signed std::numeric_limits, such as Fixed
+  template<class T>
+  constexpr bool kSignedScalar = std::numeric_limits<T>::is_specialized && std::numeric_limits<T>::is_signed;
+
+  /*
+   * Sqrt, Sin, Cos and Acos of scalars other than the built-in types, specialised next to the type like Fixed.hpp does.
+   * Specialisations are found where a template is instantiated, so the vector types work without the scalar's header.
+   */
+  template<class T>
+  struct ScalarFunctions;
+
   template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
   constexpr T Sign(T value)
   {
@@ -46,52 +380,81 @@ namespace Math
     return value > kZero ? ((value & (value - kOne)) == kZero) : false;
   }
 
+  // Digits of value in base, the sign is not counted. Base 10 and power-of-two bases take constant time.
   template<class T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
-  std::size_t NumericLength(T value, int base = 10)
+  constexpr std::size_t NumericLength(T value, int base = 10)
   {
-    constexpr T kZero = static_cast<T>(0);
+    assert(base >= 2);
 
-    std::size_t result = 0u;
-    if(value == kZero)
+    const std::uint64_t magnitude = Detail::Magnitude(value);
+    const std::uint64_t radix     = static_cast<std::uint64_t>(base);
+    if(radix == 10u)
     {
-      return 1u;
+      return Detail::DecimalLength(magnitude);
     }
-
-    while(value != kZero)
+    else if(IsPowerOfTwo(radix))
     {
-      value /= base;
-      result++;
+      return Detail::BinaryLength(magnitude, static_cast<unsigned int>(Detail::BitWidth(radix - 1u)));
     }
 
-    return result;
+    return Detail::GenericLength(magnitude, radix);
+  }
+
+  // Compile-time base, lets the generic fallback divide by a constant
+  template<int Base, class T, std::enable_if_t<std::is_integral_v<T> && (Base >= 2), bool> = true>
+  constexpr std::size_t NumericLength(T value)
+  {
+    constexpr std::uint64_t kRadix = static_cast<std::uint64_t>(Base);
+
+    const std::uint64_t magnitude = Detail::Magnitude(value);
+    if constexpr(kRadix == 10u)
+    {
+      return Detail::DecimalLength(magnitude);
+    }
+    else if constexpr(IsPowerOfTwo(kRadix))
+    {
+      return Detail::BinaryLength(magnitude, static_cast<unsigned int>(Detail::BitWidth(kRadix - 1u)));
+    }
+    else
+    {
+      return Detail::GenericLength(magnitude, kRadix);
+    }
   }
 
+  /*
+   * Decimal digits of the shortest representation that reads back to value, written without an exponent. The sign is
+   * not counted, a zero integer part counts as one digit, and non-finite values have no length.
+   */
   template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
   std::size_t NumericLength(T value)
   {
-    constexpr T kZero = static_cast<T>(0);
-    constexpr T kTen  = static_cast<T>(10);
-
-    std::size_t result = 0u;
-    if(std::trunc(value) == kZero)
+    if(!std::isfinite(value))
     {
-      result++;
+      return 0u;
     }
 
-    T tmpValue = value - std::trunc(value);
-    while(tmpValue != std::trunc(tmpValue))
+    // Shortest round-trip scientific form d[.ddd]e[+-]xx, the mantissa and exponent bound the buffer for every type
+    char buffer[64];
+    const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), std::fabs(value), std::chars_format::scientific);
+    assert(result.ec == std::errc());
+
+    std::size_t significant = 0u;
+    const char* cursor      = buffer;
+    for(; *cursor != 'e'; cursor++)
     {
-      tmpValue *= kTen;
-      result++;
+      significant += (*cursor != '.') ? 1u : 0u;
     }
 
-    while(std::trunc(value) != kZero)
+    long exponent = 0;
+    std::from_chars((cursor[1] == '+') ? (cursor + 2) : (cursor + 1), result.ptr, exponent);
+
+    // 1.5e-2 reads 0.015: the leading zero, -exponent - 1 zeros, then the significant digits
+    if(exponent < 0)
     {
-      value /= kTen;
-      result++;
+      return static_cast<std::size_t>(-exponent) + significant;
     }
 
-    return result;
+    return std::max(static_cast<std::size_t>(exponent) + 1u, significant);
   }
 
   template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
@@ -176,61 +539,242 @@ namespace Math
   template<class T, class U, std::enable_if_t<std::is_arithmetic_v<T> && std::is_floating_point_v<U>, bool> = true>
   T Lerp(T min, T max, U fraction)
   {
+    MATH_INSTRUMENT("Lerp");
+
     constexpr U kOne = static_cast<U>(1);
     return static_cast<T>((static_cast<U>(min) * (kOne - fraction)) + (static_cast<U>(max) * fraction));
   }
 
+  /*
+   * std::sqrt, also usable in constant expressions. Compile-time floating point roots are correctly rounded and
+   * therefore match the runtime results bit for bit, integers are promoted to double like std::sqrt does.
+   */
+  template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+  constexpr std::conditional_t<std::is_integral_v<T>, double, T> Sqrt(T value)
+  {
+    MATH_INSTRUMENT_COUNT("Sqrt");
+
+    using R = std::conditional_t<std::is_integral_v<T>, double, T>;
+
+    if(!Detail::IsConstantEvaluated())
+    {
+      return std::sqrt(value);
+    }
+
+    const R x = static_cast<R>(value);
+    if((x != x) || (x == static_cast<R>(0)) || (x == std::numeric_limits<R>::infinity()))
+    {
+      return x;
+    }
+
+    if(x < static_cast<R>(0))
+    {
+      return std::numeric_limits<R>::quiet_NaN();
+    }
+
+    if constexpr(std::numeric_limits<R>::digits < 60)
+    {
+      return Detail::ExactSqrt(x);
+    }
+    else
+    {
+      return Detail::NewtonSqrt(x);
+    }
+  }
+
+  // std::sin, also usable in constant expressions where it is within an ulp or two for arguments of moderate size
+  template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+  constexpr T Sin(T value)
+  {
+    MATH_INSTRUMENT_COUNT("Sin");
+
+    if(!Detail::IsConstantEvaluated())
+    {
+      return std::sin(value);
+    }
+
+    return ((value - value) == static_cast<T>(0)) ? static_cast<T>(Detail::SineCosine(value, false)) : std::numeric_limits<T>::quiet_NaN();
+  }
+
+  // std::cos, also usable in constant expressions, see Sin
+  template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+  constexpr T Cos(T value)
+  {
+    MATH_INSTRUMENT_COUNT("Cos");
+
+    if(!Detail::IsConstantEvaluated())
+    {
+      return std::cos(value);
+    }
+
+    return ((value - value) == static_cast<T>(0)) ? static_cast<T>(Detail::SineCosine(value, true)) : std::numeric_limits<T>::quiet_NaN();
+  }
+
+  // std::acos, also usable in constant expressions. Arguments beyond +-0.5 go through acos(x) = 2 asin(sqrt((1 - x) / 2))
+  // so the Newton iteration never runs where the slope of sin vanishes.
+  template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+  constexpr T Acos(T value)
+  {
+    MATH_INSTRUMENT_COUNT("Acos");
+
+    if(!Detail::IsConstantEvaluated())
+    {
+      return std::acos(value);
+    }
+
+    if(!((value >= static_cast<T>(-1)) && (value <= static_cast<T>(1))))
+    {
+      return std::numeric_limits<T>::quiet_NaN();
+    }
+
+    const long double x = value;
+    if(x > 0.5L)
+    {
+      return static_cast<T>(2.0L * Detail::ArcSineSmall(Detail::NewtonSqrt((1.0L - x) / 2.0L)));
+    }
+
+    if(x < -0.5L)
+    {
+      return static_cast<T>(Detail::kPi - (2.0L * Detail::ArcSineSmall(Detail::NewtonSqrt((1.0L + x) / 2.0L))));
+    }
+
+    return static_cast<T>(Detail::kHalfPi - Detail::ArcSineSmall(x));
+  }
+
+  // Other scalar types go through their ScalarFunctions specialisation
+  template<class T, std::enable_if_t<!std::is_arithmetic_v<T>, bool> = true>
+  constexpr T Sqrt(T value)
+  {
+    return ScalarFunctions<T>::Sqrt(value);
+  }
+
+  template<class T, std::enable_if_t<!std::is_arithmetic_v<T>, bool> = true>
+  constexpr T Sin(T value)
+  {
+    return ScalarFunctions<T>::Sin(value);
+  }
+
+  template<class T, std::enable_if_t<!std::is_arithmetic_v<T>, bool> = true>
+  constexpr T Cos(T value)
+  {
+    return ScalarFunctions<T>::Cos(value);
+  }
+
+  template<class T, std::enable_if_t<!std::is_arithmetic_v<T>, bool> = true>
+  constexpr T Acos(T value)
+  {
+    return ScalarFunctions<T>::Acos(value);
+  }
+
+  // Deterministic for every 64-bit input: small factors by trial division, the rest by Miller-Rabin
   template<class T, std::enable_if_t<std::is_unsigned_v<T>, bool> = true>
   bool IsPrime(T value)
   {
-    constexpr T kTwo   = static_cast<T>(2);
-    constexpr T kThree = static_cast<T>(3);
-    constexpr T kZero  = static_cast<T>(0);
+    MATH_INSTRUMENT("IsPrime");
+
+    static_assert(sizeof(T) <= sizeof(std::uint64_t), "IsPrime supports up to 64-bit values");
+
+    constexpr std::uint64_t kSmallPrimes[] = {2u, 3u, 5u, 7u, 11u, 13u, 17u, 19u, 23u, 29u, 31u, 37u};
+    constexpr std::uint64_t kSmallLimit    = 41u * 41u;
+
+    const std::uint64_t number = static_cast<std::uint64_t>(value);
+    if(number < 2u)
+    {
+      return false;
+    }
 
-    if(value == kTwo)
+    for(const std::uint64_t prime : kSmallPrimes)
+    {
+      if(number == prime)
+      {
+        return true;
+      }
+      else if((number % prime) == 0u)
+      {
+        return false;
+      }
+    }
+
+    if(number < kSmallLimit)
     {
       return true;
     }
-    else if((value < kTwo) || ((value % kTwo) == kZero))
+
+    // Smallest known witness sets that are exact below 2^32 and 2^64 respectively
+    constexpr std::uint64_t kWitnesses32[] = {2u, 7u, 61u};
+    constexpr std::uint64_t kWitnesses64[] = {2u, 325u, 9375u, 28178u, 450775u, 9780504u, 1795265022u};
+
+    if(number <= std::numeric_limits<std::uint32_t>::max())
     {
-      return false;
+      return Detail::MillerRabin(number, kWitnesses32, std::size(kWitnesses32));
     }
 
-    const T max = static_cast<T>(std::sqrt(value));
-    for(T i = kThree; i <= max; i += kTwo)
+    return Detail::MillerRabin(number, kWitnesses64, std::size(kWitnesses64));
+  }
+
+  // Sum of all divisors of value including value itself, from its factorization by trial division. The sum grows to several
+  // times value and wraps around like any unsigned arithmetic once it exceeds T, values up to max / 8 always fit.
+  template<class T, std::enable_if_t<std::is_unsigned_v<T>, bool> = true>
+  T DivisorSum(T value)
+  {
+    MATH_INSTRUMENT("DivisorSum");
+
+    constexpr T kZero = static_cast<T>(0);
+    constexpr T kOne  = static_cast<T>(1);
+    constexpr T kTwo  = static_cast<T>(2);
+
+    if(value == kZero)
     {
-      if(value % i == kZero)
+      return kZero;
+    }
+
+    T result = kOne;
+    for(T factor = kTwo; factor <= (value / factor); factor += (factor == kTwo) ? kOne : kTwo)
+    {
+      if((value % factor) != kZero)
       {
-        return false;
+        continue;
       }
+
+      // 1 + p + p^2 + ... + p^e accumulated while dividing p out
+      T power = kOne;
+      T sum   = kOne;
+      while((value % factor) == kZero)
+      {
+        value /= factor;
+        power *= factor;
+        sum += power;
+      }
+
+      result *= sum;
     }
 
-    return true;
+    return (value > kOne) ? static_cast<T>(result * (value + kOne)) : result;
   }
 
+  /*
+   * Euclid-Euler: every even perfect number is 2^(p-1) * (2^p - 1) with 2^p - 1 a Mersenne prime. No odd perfect number
+   * exists below 10^1500, so for any fixed width integer the check reduces to that shape plus one primality test.
+   */
   template<class T, std::enable_if_t<std::is_unsigned_v<T>, bool> = true>
   bool IsPerfect(T value)
   {
-    constexpr T kZero  = static_cast<T>(0);
-    constexpr T kTwo   = static_cast<T>(2);
-    constexpr T kThree = static_cast<T>(3);
+    MATH_INSTRUMENT("IsPerfect");
 
-    if((value % kTwo) != kZero)
+    std::uint64_t odd = static_cast<std::uint64_t>(value);
+    if((odd < 2u) || ((odd & 1u) != 0u))
     {
       return false;
     }
 
-    const T max = value / kTwo;
-    T sum       = kThree;
-    for(T i = kThree; i <= max; i++)
+    unsigned int twoPower = 0u;
+    while((odd & 1u) == 0u)
     {
-      if((value % i) == kZero)
-      {
-        sum += i;
-      }
+      odd >>= 1u;
+      twoPower++;
     }
 
-    return sum == value;
+    return ((odd + 1u) == (std::uint64_t(2u) << twoPower)) && IsPrime(odd);
   }
 } // namespace Math
 
@@ -1,5 +1,8 @@
 #include "Common.hpp"
 
+#include <array>
+#include <cmath>
+#include <limits>
 #include <unordered_set>
 
 #include <gtest/gtest.h>
@@ -101,6 +104,66 @@ namespace UnitTest
     ASSERT_EQ(Math::NumericLength(-0.015), 4u);
   }
 
+  TEST(Math, NumericLengthInteger)
+  {
+    static_assert(Math::NumericLength(12345) == 5u);
+    static_assert(Math::NumericLength<16>(0xFFu) == 2u);
+    static_assert(Math::NumericLength<7>(-49) == 3u);
+
+    // Both sides of every power of ten, including the last one that fits 64 bits
+    std::uint64_t power = 1u;
+    for(std::size_t digits = 1u; digits <= 19u; digits++)
+    {
+      ASSERT_EQ(Math::NumericLength(power), digits);
+      ASSERT_EQ(Math::NumericLength((power * 10u) - 1u), digits);
+      power *= 10u;
+    }
+
+    ASSERT_EQ(Math::NumericLength(power), 20u);
+    ASSERT_EQ(Math::NumericLength(std::numeric_limits<std::uint64_t>::max()), 20u);
+    ASSERT_EQ(Math::NumericLength(std::numeric_limits<std::int64_t>::min()), 19u);
+
+    ASSERT_EQ(Math::NumericLength(0, 2), 1u);
+    ASSERT_EQ(Math::NumericLength(255, 2), 8u);
+    ASSERT_EQ(Math::NumericLength(256, 2), 9u);
+    ASSERT_EQ(Math::NumericLength(0xFFFF, 16), 4u);
+    ASSERT_EQ(Math::NumericLength(0x10000, 16), 5u);
+    ASSERT_EQ(Math::NumericLength(-0777, 8), 3u);
+    ASSERT_EQ(Math::NumericLength(std::numeric_limits<std::uint64_t>::max(), 16), 16u);
+    ASSERT_EQ(Math::NumericLength(std::numeric_limits<std::uint64_t>::max(), 3), 41u);
+
+    for(int value = 0; value < 5000; value++)
+    {
+      for(int base = 2; base <= 16; base++)
+      {
+        std::size_t expected = 1u;
+        for(int rest = value; rest >= base; rest /= base)
+        {
+          expected++;
+        }
+
+        ASSERT_EQ(Math::NumericLength(value, base), expected);
+      }
+
+      ASSERT_EQ(Math::NumericLength<3>(value), Math::NumericLength(value, 3));
+      ASSERT_EQ(Math::NumericLength<10>(-value), Math::NumericLength(value));
+    }
+  }
+
+  TEST(Math, NumericLengthFloat)
+  {
+    ASSERT_EQ(Math::NumericLength(0.1), 2u);
+    ASSERT_EQ(Math::NumericLength(0.1f), 2u);
+    ASSERT_EQ(Math::NumericLength(0.3), 2u);
+    ASSERT_EQ(Math::NumericLength(0.1 + 0.2), 18u);
+    ASSERT_EQ(Math::NumericLength(123.456), 6u);
+    ASSERT_EQ(Math::NumericLength(100.0), 3u);
+    ASSERT_EQ(Math::NumericLength(1e300), 301u);
+    ASSERT_EQ(Math::NumericLength(5e-324), 325u);
+    ASSERT_EQ(Math::NumericLength(std::numeric_limits<double>::infinity()), 0u);
+    ASSERT_EQ(Math::NumericLength(std::numeric_limits<double>::quiet_NaN()), 0u);
+  }
+
   TEST(Math, Distance)
   {
     ASSERT_EQ(Math::Distance(5, 10), 5);
@@ -208,6 +271,31 @@ namespace UnitTest
     }
   }
 
+  TEST(Math, IsPrimeLarge)
+  {
+    ASSERT_TRUE(Math::IsPrime(std::uint32_t(4294967291u)));
+    ASSERT_TRUE(Math::IsPrime(std::uint64_t(2305843009213693951u)));
+    ASSERT_TRUE(Math::IsPrime(std::uint64_t(18446744073709551557u)));
+
+    // Carmichael numbers and strong pseudoprimes to many small bases
+    ASSERT_FALSE(Math::IsPrime(std::uint32_t(561u)));
+    ASSERT_FALSE(Math::IsPrime(std::uint32_t(3215031751u)));
+    ASSERT_FALSE(Math::IsPrime(std::uint64_t(4759123141u)));
+    ASSERT_FALSE(Math::IsPrime(std::uint64_t(3825123056546413051u)));
+    ASSERT_FALSE(Math::IsPrime(std::uint64_t(4294967291u) * 4294967279u));
+    ASSERT_FALSE(Math::IsPrime(std::numeric_limits<std::uint64_t>::max()));
+  }
+
+  TEST(Math, DivisorSum)
+  {
+    ASSERT_EQ(Math::DivisorSum(0u), 0u);
+    ASSERT_EQ(Math::DivisorSum(1u), 1u);
+    ASSERT_EQ(Math::DivisorSum(12u), 28u);
+    ASSERT_EQ(Math::DivisorSum(97u), 98u);
+    ASSERT_EQ(Math::DivisorSum(std::uint64_t(1u) << 40u), (std::uint64_t(1u) << 41u) - 1u);
+    ASSERT_EQ(Math::DivisorSum(std::uint64_t(4294967291u) * 65521u), std::uint64_t(4294967292u) * 65522u);
+  }
+
   TEST(Math, IsPerfect)
   {
     const std::unordered_set<std::uint32_t> perfectNumbers = {6u, 28u, 496u, 8128u};
@@ -218,5 +306,111 @@ namespace UnitTest
       const bool expected = perfectNumbers.find(i) != perfectNumbers.cend();
       ASSERT_EQ(actual, expected);
     }
+
+    ASSERT_TRUE(Math::IsPerfect(std::uint32_t(33550336u)));
+    ASSERT_TRUE(Math::IsPerfect(std::uint64_t(8589869056u)));
+    ASSERT_TRUE(Math::IsPerfect(std::uint64_t(137438691328u)));
+    ASSERT_TRUE(Math::IsPerfect(std::uint64_t(2305843008139952128u)));
+
+    // Right shape, but 2^11 - 1 = 23 * 89 is not a Mersenne prime
+    ASSERT_FALSE(Math::IsPerfect(std::uint32_t(2096128u)));
+    ASSERT_FALSE(Math::IsPerfect(std::numeric_limits<std::uint64_t>::max()));
+  }
+
+  template<class T>
+  static constexpr std::array<T, 64> CreateRoots(const std::array<T, 64>& values)
+  {
+    std::array<T, 64> result = {};
+    for(std::size_t i = 0u; i < values.size(); i++)
+    {
+      result[i] = Math::Sqrt(values[i]);
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static constexpr std::array<T, 64> CreateRadicands()
+  {
+    // Sixty steps from the smallest subnormal towards the largest finite value
+    constexpr T kStep        = static_cast<T>(std::is_same_v<T, float> ? 21.0 : 17179869184.0);
+    std::array<T, 64> result = {};
+    T value                  = std::numeric_limits<T>::denorm_min();
+    for(std::size_t i = 0u; i < 60u; i++)
+    {
+      result[i] = value * static_cast<T>(1.61803398874989484820);
+      value *= kStep;
+    }
+
+    result[60] = static_cast<T>(2);
+    result[61] = static_cast<T>(3);
+    result[62] = std::numeric_limits<T>::max();
+    result[63] = std::numeric_limits<T>::min();
+    return result;
+  }
+
+  template<class T>
+  static void TestSqrt()
+  {
+    constexpr std::array<T, 64> kRadicands = CreateRadicands<T>();
+    constexpr std::array<T, 64> kRoots     = CreateRoots(kRadicands);
+
+    // Compile-time roots are correctly rounded, so they agree with the runtime ones exactly
+    for(std::size_t i = 0u; i < kRadicands.size(); i++)
+    {
+      ASSERT_EQ(kRoots[i], std::sqrt(kRadicands[i]));
+    }
+  }
+
+  TEST(Math, Sqrt)
+  {
+    static_assert(Math::Sqrt(16.0) == 4.0);
+    static_assert(Math::Sqrt(0.25f) == 0.5f);
+    static_assert(Math::Sqrt(-0.0) == 0.0);
+    static_assert(Math::Sqrt(49) == 7.0);
+    static_assert(Math::Sqrt(std::numeric_limits<double>::infinity()) == std::numeric_limits<double>::infinity());
+    static_assert(Math::Sqrt(-1.0) != Math::Sqrt(-1.0));
+
+    TestSqrt<float>();
+    TestSqrt<double>();
+
+    constexpr long double kRootTwo = Math::Sqrt(2.0L);
+    ASSERT_LE(std::fabs(kRootTwo - std::sqrt(2.0L)), 2.0L * std::numeric_limits<long double>::epsilon());
+    ASSERT_EQ(Math::Sqrt(2.0), std::sqrt(2.0));
+  }
+
+  TEST(Math, Trigonometry)
+  {
+    constexpr std::size_t kCount = 33u;
+    constexpr double kTolerance  = 4.0 * std::numeric_limits<double>::epsilon();
+
+    constexpr auto kTable = []()
+    {
+      std::array<double, 3u * kCount> result = {};
+      for(std::size_t i = 0u; i < kCount; i++)
+      {
+        const double angle = (static_cast<double>(i) - 16.0) * 0.4;
+        const double ratio = (static_cast<double>(i) - 16.0) / 16.0;
+        result[i]                 = Math::Sin(angle);
+        result[kCount + i]        = Math::Cos(angle);
+        result[(2u * kCount) + i] = Math::Acos(ratio);
+      }
+
+      return result;
+    }();
+
+    for(std::size_t i = 0u; i < kCount; i++)
+    {
+      const double angle = (static_cast<double>(i) - 16.0) * 0.4;
+      const double ratio = (static_cast<double>(i) - 16.0) / 16.0;
+      ASSERT_NEAR(kTable[i], std::sin(angle), kTolerance);
+      ASSERT_NEAR(kTable[kCount + i], std::cos(angle), kTolerance);
+      ASSERT_NEAR(kTable[(2u * kCount) + i], std::acos(ratio), kTolerance);
+    }
+
+    static_assert(Math::Sin(0.0) == 0.0);
+    static_assert(Math::Cos(0.0f) == 1.0f);
+    static_assert(Math::Acos(1.0) == 0.0);
+    static_assert(Math::Acos(2.0) != Math::Acos(2.0));
   }
 } // namespace UnitTest
@@ -0,0 +1,73 @@
+#include "Benchmark.hpp"
+#include "CommonBatch.hpp"
+#include "LinearMap.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace Benchmark
+{
+  // Runs kernel(in, out) over count inputs into a separate output
+  template<class T, class Kernel>
+  static void RegisterSpan(const char* name, Kernel kernel)
+  {
+    RegisterBatch(Name<T>(name),
+                  [kernel](std::size_t count)
+                  {
+                    return [kernel, in = CreateScalars<T>(count), out = std::vector<T>(count)]() mutable
+                    { kernel(Math::Span<const T>(in), Math::Span<T>(out)); };
+                  });
+  }
+
+  template<class T>
+  static bool RegisterCommonBatch()
+  {
+    using In  = Math::Span<const T>;
+    using Out = Math::Span<T>;
+
+    constexpr T kMin = static_cast<T>(-100);
+    constexpr T kMax = static_cast<T>(100);
+
+    RegisterSpan<T>("Batch_Clamp", [](In in, Out out) { Math::Batch::Clamp(in, out, static_cast<T>(-50), static_cast<T>(50)); });
+    RegisterSpan<T>("Batch_Clamp01", [](In in, Out out) { Math::Batch::Clamp01(in, out); });
+    RegisterSpan<T>("Batch_Clamp11", [](In in, Out out) { Math::Batch::Clamp11(in, out); });
+    RegisterSpan<T>("Batch_Normalize", [](In in, Out out) { Math::Batch::Normalize(in, out, kMin, kMax, static_cast<T>(10), static_cast<T>(20)); });
+    RegisterSpan<T>("Batch_Normalize01", [](In in, Out out) { Math::Batch::Normalize01(in, out, kMin, kMax); });
+    RegisterSpan<T>("Batch_Denormalize01", [](In in, Out out) { Math::Batch::Denormalize01(in, out, kMin, kMax); });
+    RegisterSpan<T>("Batch_Normalize11", [](In in, Out out) { Math::Batch::Normalize11(in, out, kMin, kMax); });
+    RegisterSpan<T>("Batch_Denormalize11", [](In in, Out out) { Math::Batch::Denormalize11(in, out, kMin, kMax); });
+    RegisterSpan<T>("Batch_Sign", [](In in, Out out) { Math::Batch::Sign(in, out); });
+
+    if constexpr(std::is_floating_point_v<T>)
+    {
+      RegisterBatch(Name<T>("Batch_Lerp"),
+                    [](std::size_t count)
+                    {
+                      return [from = CreateScalars<T>(count + 1u), out = std::vector<T>(count)]() mutable
+                      {
+                        const In values(from);
+                        Math::Batch::Lerp(values.Subspan(0u, out.size()), values.Subspan(1u), static_cast<T>(0.3), Out(out));
+                      };
+                    });
+      RegisterBatch(Name<T>("Batch_LerpFractions"),
+                    [](std::size_t count)
+                    {
+                      std::vector<T> fractions = CreateScalars<T>(count);
+                      for(T& fraction : fractions)
+                      {
+                        fraction = Math::Normalize01(fraction, kMin, kMax);
+                      }
+
+                      return [fractions, out = std::vector<T>(count)]() mutable { Math::Batch::Lerp(kMin, kMax, In(fractions), Out(out)); };
+                    });
+
+      const LinearMap<T> map = LinearMap<T>::Normalize01(kMin, kMax, true);
+      RegisterSpan<T>("Batch_LinearMap", [map](In in, Out out) { Math::Batch::Apply(map, in, out); });
+    }
+
+    return true;
+  }
+
+  static const bool kCommonBatchRegistered = RegisterCommonBatch<float>() && RegisterCommonBatch<double>() && RegisterCommonBatch<int>();
+} // namespace Benchmark
@@ -0,0 +1,389 @@
+#ifndef __MATH__COMMONBATCH_HPP__
+#define __MATH__COMMONBATCH_HPP__
+
+#include "Common.hpp"
+#include "Simd.hpp"
+#include "Span.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace Math::Detail
+{
+  // True when writing out front to back would overwrite input elements before they are read
+  template<class T>
+  bool IsShiftedAbove(const T* out, const T* in, std::size_t count)
+  {
+    const std::uintptr_t outAddress = reinterpret_cast<std::uintptr_t>(out);
+    const std::uintptr_t inAddress  = reinterpret_cast<std::uintptr_t>(in);
+    return (outAddress > inAddress) && (outAddress < (inAddress + (count * sizeof(T))));
+  }
+
+  // True when writing out back to front would overwrite input elements before they are read
+  template<class T>
+  bool IsShiftedBelow(const T* out, const T* in, std::size_t count)
+  {
+    return IsShiftedAbove(in, out, count);
+  }
+
+  /*
+   * Drives an element-wise kernel over count elements: packed(i) handles the kLanes elements starting at i, scalar(i)
+   * handles one. Each packed step loads all of its input before storing, so walking backwards keeps an output that sits
+   * above its input correct, and walking forwards does the same for an output below it.
+   */
+  template<class T, class Packed, class Scalar>
+  void RunKernel(std::size_t count, bool backward, Packed&& packed, Scalar&& scalar)
+  {
+    constexpr bool kPacked       = Math::Simd::Traits<T>::kEnabled;
+    constexpr std::size_t kLanes = Math::Simd::Traits<T>::kLanes;
+
+    const std::size_t packedCount = kPacked ? (count - (count % kLanes)) : 0u;
+    if(!backward)
+    {
+      std::size_t i = 0u;
+      for(; i < packedCount; i += kLanes)
+      {
+        packed(i);
+      }
+
+      for(; i < count; i++)
+      {
+        scalar(i);
+      }
+    }
+    else
+    {
+      for(std::size_t i = count; i > packedCount; i--)
+      {
+        scalar(i - 1u);
+      }
+
+      for(std::size_t i = packedCount; i > 0u; i -= kLanes)
+      {
+        packed(i - kLanes);
+      }
+    }
+  }
+
+  // out[i] = op(in[i]), op is called with either a packed register or a scalar
+  template<class T, class Op>
+  void UnaryKernel(Math::Span<const T> in, Math::Span<T> out, Op&& op)
+  {
+    assert(out.GetSize() >= in.GetSize());
+
+    const std::size_t count = in.GetSize();
+    const T* source         = in.GetData();
+    T* destination          = out.GetData();
+
+    RunKernel<T>(
+      count,
+      IsShiftedAbove(destination, source, count),
+      [&](std::size_t i)
+      {
+        if constexpr(Math::Simd::Traits<T>::kEnabled)
+        {
+          Math::Simd::StoreUnaligned(destination + i, op(Math::Simd::LoadUnaligned(source + i)));
+        }
+      },
+      [&](std::size_t i) { destination[i] = op(source[i]); });
+  }
+
+  // out[i] = op(a[i], b[i]), falls back to a copy of b when a and b overlap the output from opposite sides
+  template<class T, class Op>
+  void BinaryKernel(Math::Span<const T> a, Math::Span<const T> b, Math::Span<T> out, Op&& op)
+  {
+    assert(a.GetSize() == b.GetSize());
+    assert(out.GetSize() >= a.GetSize());
+
+    const std::size_t count = a.GetSize();
+    const T* first          = a.GetData();
+    const T* second         = b.GetData();
+    T* destination          = out.GetData();
+
+    const bool backward = IsShiftedAbove(destination, first, count) || IsShiftedAbove(destination, second, count);
+    if(backward && (IsShiftedBelow(destination, first, count) || IsShiftedBelow(destination, second, count)))
+    {
+      const std::vector<T> copy(second, second + count);
+      BinaryKernel(a, Math::Span<const T>(copy), out, op);
+      return;
+    }
+
+    RunKernel<T>(
+      count,
+      backward,
+      [&](std::size_t i)
+      {
+        if constexpr(Math::Simd::Traits<T>::kEnabled)
+        {
+          Math::Simd::StoreUnaligned(destination + i, op(Math::Simd::LoadUnaligned(first + i), Math::Simd::LoadUnaligned(second + i)));
+        }
+      },
+      [&](std::size_t i) { destination[i] = op(first[i], second[i]); });
+  }
+
+  // Packed Math::Normalize, the operation order matches the scalar version so results are identical
+  template<class T>
+  void NormalizeKernel(Math::Span<const T> in, Math::Span<T> out, T inMin, T inMax, T outMin, T outMax)
+  {
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      const auto offset = Math::Simd::Broadcast(inMin);
+      const auto scale  = Math::Simd::Broadcast(outMax - outMin);
+      const auto range  = Math::Simd::Broadcast(inMax - inMin);
+      const auto base   = Math::Simd::Broadcast(outMin);
+
+      UnaryKernel(in,
+                  out,
+                  [&](auto value)
+                  {
+                    if constexpr(std::is_same_v<decltype(value), T>)
+                    {
+                      return Math::Normalize(value, inMin, inMax, outMin, outMax);
+                    }
+                    else
+                    {
+                      return Math::Simd::Add(Math::Simd::Divide(Math::Simd::Multiply(Math::Simd::Subtract(value, offset), scale), range), base);
+                    }
+                  });
+    }
+    else
+    {
+      UnaryKernel(in, out, [&](T value) { return Math::Normalize(value, inMin, inMax, outMin, outMax); });
+    }
+  }
+} // namespace Math::Detail
+
+namespace Math::Batch
+{
+  // Element-wise versions of the Common.hpp helpers. Outputs may alias or partially overlap the inputs, the in-place
+  // overloads update values directly. float and double run packed where the target supports it, other types loop.
+
+  // Math::Clamp per element, max(min, min(value, max)) with the same NaN behaviour as the scalar version
+  template<class T>
+  void Clamp(Math::Span<const T> in, Math::Span<T> out, T min, T max)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Clamp", in.GetSize());
+
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      const auto low  = Math::Simd::Broadcast(min);
+      const auto high = Math::Simd::Broadcast(max);
+
+      Math::Detail::UnaryKernel(in,
+                                out,
+                                [&](auto value)
+                                {
+                                  if constexpr(std::is_same_v<decltype(value), T>)
+                                  {
+                                    return Math::Clamp(value, min, max);
+                                  }
+                                  else
+                                  {
+                                    return Math::Simd::Max(Math::Simd::Min(high, value), low);
+                                  }
+                                });
+    }
+    else
+    {
+      Math::Detail::UnaryKernel(in, out, [&](T value) { return Math::Clamp(value, min, max); });
+    }
+  }
+
+  template<class T>
+  void Clamp(Math::Span<T> values, T min, T max)
+  {
+    Clamp(Math::Span<const T>(values), values, min, max);
+  }
+
+  template<class T>
+  void Clamp01(Math::Span<const T> in, Math::Span<T> out)
+  {
+    Clamp(in, out, static_cast<T>(0), static_cast<T>(1));
+  }
+
+  template<class T>
+  void Clamp01(Math::Span<T> values)
+  {
+    Clamp(values, static_cast<T>(0), static_cast<T>(1));
+  }
+
+  template<class T>
+  void Clamp11(Math::Span<const T> in, Math::Span<T> out)
+  {
+    Clamp(in, out, static_cast<T>(-1), static_cast<T>(1));
+  }
+
+  template<class T>
+  void Clamp11(Math::Span<T> values)
+  {
+    Clamp(values, static_cast<T>(-1), static_cast<T>(1));
+  }
+
+  template<class T>
+  void Normalize(Math::Span<const T> in, Math::Span<T> out, T inMin, T inMax, T outMin, T outMax)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Normalize", in.GetSize());
+    Math::Detail::NormalizeKernel(in, out, inMin, inMax, outMin, outMax);
+  }
+
+  template<class T>
+  void Normalize(Math::Span<T> values, T inMin, T inMax, T outMin, T outMax)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Normalize", values.GetSize());
+    Math::Detail::NormalizeKernel(Math::Span<const T>(values), values, inMin, inMax, outMin, outMax);
+  }
+
+  template<class T>
+  void Normalize01(Math::Span<const T> in, Math::Span<T> out, T min, T max)
+  {
+    Normalize(in, out, min, max, static_cast<T>(0), static_cast<T>(1));
+  }
+
+  template<class T>
+  void Normalize01(Math::Span<T> values, T min, T max)
+  {
+    Normalize(values, min, max, static_cast<T>(0), static_cast<T>(1));
+  }
+
+  template<class T>
+  void Denormalize01(Math::Span<const T> in, Math::Span<T> out, T min, T max)
+  {
+    Normalize(in, out, static_cast<T>(0), static_cast<T>(1), min, max);
+  }
+
+  template<class T>
+  void Denormalize01(Math::Span<T> values, T min, T max)
+  {
+    Normalize(values, static_cast<T>(0), static_cast<T>(1), min, max);
+  }
+
+  template<class T>
+  void Normalize11(Math::Span<const T> in, Math::Span<T> out, T min, T max)
+  {
+    Normalize(in, out, min, max, static_cast<T>(-1), static_cast<T>(1));
+  }
+
+  template<class T>
+  void Normalize11(Math::Span<T> values, T min, T max)
+  {
+    Normalize(values, min, max, static_cast<T>(-1), static_cast<T>(1));
+  }
+
+  template<class T>
+  void Denormalize11(Math::Span<const T> in, Math::Span<T> out, T min, T max)
+  {
+    Normalize(in, out, static_cast<T>(-1), static_cast<T>(1), min, max);
+  }
+
+  template<class T>
+  void Denormalize11(Math::Span<T> values, T min, T max)
+  {
+    Normalize(values, static_cast<T>(-1), static_cast<T>(1), min, max);
+  }
+
+  // out[i] = Math::Lerp(min[i], max[i], fraction)
+  template<class T, class U, std::enable_if_t<std::is_floating_point_v<U>, bool> = true>
+  void Lerp(Math::Span<const T> min, Math::Span<const T> max, U fraction, Math::Span<T> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Lerp", min.GetSize());
+
+    if constexpr(Math::Simd::Traits<T>::kEnabled && std::is_same_v<T, U>)
+    {
+      const auto fromWeight = Math::Simd::Broadcast(static_cast<T>(1) - fraction);
+      const auto toWeight   = Math::Simd::Broadcast(fraction);
+
+      Math::Detail::BinaryKernel(min,
+                                 max,
+                                 out,
+                                 [&](auto from, auto to)
+                                 {
+                                   if constexpr(std::is_same_v<decltype(from), T>)
+                                   {
+                                     return Math::Lerp(from, to, fraction);
+                                   }
+                                   else
+                                   {
+                                     return Math::Simd::Add(Math::Simd::Multiply(from, fromWeight), Math::Simd::Multiply(to, toWeight));
+                                   }
+                                 });
+    }
+    else
+    {
+      Math::Detail::BinaryKernel(min, max, out, [&](T from, T to) { return Math::Lerp(from, to, fraction); });
+    }
+  }
+
+  // out[i] = Math::Lerp(min, max, fractions[i])
+  template<class T, class U, std::enable_if_t<std::is_floating_point_v<U>, bool> = true>
+  void Lerp(T min, T max, Math::Span<const U> fractions, Math::Span<T> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Lerp", fractions.GetSize());
+
+    if constexpr(Math::Simd::Traits<T>::kEnabled && std::is_same_v<T, U>)
+    {
+      const auto from = Math::Simd::Broadcast(min);
+      const auto to   = Math::Simd::Broadcast(max);
+      const auto one  = Math::Simd::Broadcast(static_cast<T>(1));
+
+      Math::Detail::UnaryKernel(fractions,
+                                out,
+                                [&](auto fraction)
+                                {
+                                  if constexpr(std::is_same_v<decltype(fraction), T>)
+                                  {
+                                    return Math::Lerp(min, max, fraction);
+                                  }
+                                  else
+                                  {
+                                    return Math::Simd::Add(Math::Simd::Multiply(from, Math::Simd::Subtract(one, fraction)), Math::Simd::Multiply(to, fraction));
+                                  }
+                                });
+    }
+    else if constexpr(std::is_same_v<T, U>)
+    {
+      Math::Detail::UnaryKernel(fractions, out, [&](T fraction) { return Math::Lerp(min, max, fraction); });
+    }
+    else
+    {
+      // Different element types cannot share storage
+      const std::size_t count = fractions.GetSize();
+      assert(out.GetSize() >= count);
+
+      for(std::size_t i = 0u; i < count; i++)
+      {
+        out[i] = Math::Lerp(min, max, fractions[i]);
+      }
+    }
+  }
+
+  template<class T>
+  void Sign(Math::Span<const T> in, Math::Span<T> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Sign", in.GetSize());
+
+    Math::Detail::UnaryKernel(in,
+                              out,
+                              [](auto value)
+                              {
+                                if constexpr(std::is_same_v<decltype(value), T>)
+                                {
+                                  return Math::Sign(value);
+                                }
+                                else
+                                {
+                                  return Math::Simd::Sign(value);
+                                }
+                              });
+  }
+
+  template<class T>
+  void Sign(Math::Span<T> values)
+  {
+    Sign(Math::Span<const T>(values), values);
+  }
+} // namespace Math::Batch
+
+#endif // __MATH__COMMONBATCH_HPP__
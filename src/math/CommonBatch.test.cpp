@@ -0,0 +1,179 @@
+#include "CommonBatch.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class CommonBatchTyped : public Test
+  {};
+
+  using CommonBatchTypes = Types<float, double>;
+  TYPED_TEST_SUITE(CommonBatchTyped, CommonBatchTypes);
+
+  template<class T>
+  static std::vector<T> CreateValues(std::size_t count)
+  {
+    std::vector<T> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      result.push_back((static_cast<T>(i % 13u) - static_cast<T>(6)) * static_cast<T>(0.25));
+    }
+
+    return result;
+  }
+
+  TYPED_TEST(CommonBatchTyped, Clamp)
+  {
+    using T = TypeParam;
+
+    std::vector<T> values = CreateValues<T>(37u);
+    values[5]             = std::numeric_limits<T>::quiet_NaN();
+
+    std::vector<T> clamped(values.size());
+    std::vector<T> clamped01(values.size());
+    std::vector<T> inPlace = values;
+    Math::Batch::Clamp(Math::Span<const T>(values), Math::Span<T>(clamped), static_cast<T>(-0.5), static_cast<T>(0.75));
+    Math::Batch::Clamp01(Math::Span<const T>(values), Math::Span<T>(clamped01));
+    Math::Batch::Clamp11(Math::Span<T>(inPlace));
+
+    for(std::size_t i = 0u; i < values.size(); i++)
+    {
+      ASSERT_EQ(clamped[i], Math::Clamp(values[i], static_cast<T>(-0.5), static_cast<T>(0.75)));
+      ASSERT_EQ(clamped01[i], Math::Clamp01(values[i]));
+      ASSERT_EQ(inPlace[i], Math::Clamp11(values[i]));
+    }
+  }
+
+  TYPED_TEST(CommonBatchTyped, Normalize)
+  {
+    using T = TypeParam;
+
+    const std::vector<T> values = CreateValues<T>(37u);
+
+    std::vector<T> normalized(values.size());
+    std::vector<T> normalized01(values.size());
+    std::vector<T> normalized11(values.size());
+    std::vector<T> denormalized01 = values;
+    std::vector<T> denormalized11 = values;
+    Math::Batch::Normalize(Math::Span<const T>(values), Math::Span<T>(normalized), T(-2), T(2), T(10), T(20));
+    Math::Batch::Normalize01(Math::Span<const T>(values), Math::Span<T>(normalized01), T(-1.5), T(1.5));
+    Math::Batch::Normalize11(Math::Span<const T>(values), Math::Span<T>(normalized11), T(-1.5), T(1.5));
+    Math::Batch::Denormalize01(Math::Span<T>(denormalized01), T(-3), T(5));
+    Math::Batch::Denormalize11(Math::Span<T>(denormalized11), T(-3), T(5));
+
+    for(std::size_t i = 0u; i < values.size(); i++)
+    {
+      ASSERT_EQ(normalized[i], Math::Normalize(values[i], T(-2), T(2), T(10), T(20)));
+      ASSERT_EQ(normalized01[i], Math::Normalize01(values[i], T(-1.5), T(1.5)));
+      ASSERT_EQ(normalized11[i], Math::Normalize11(values[i], T(-1.5), T(1.5)));
+      ASSERT_EQ(denormalized01[i], Math::Denormalize01(values[i], T(-3), T(5)));
+      ASSERT_EQ(denormalized11[i], Math::Denormalize11(values[i], T(-3), T(5)));
+    }
+  }
+
+  TYPED_TEST(CommonBatchTyped, LerpSign)
+  {
+    using T = TypeParam;
+
+    const std::vector<T> from = CreateValues<T>(37u);
+    const std::vector<T> to   = CreateValues<T>(40u);
+    std::vector<T> fractions(from.size());
+    for(std::size_t i = 0u; i < fractions.size(); i++)
+    {
+      fractions[i] = static_cast<T>(i) / static_cast<T>(36);
+    }
+
+    std::vector<T> blended(from.size());
+    std::vector<T> ramp(from.size());
+    std::vector<T> signs = from;
+    Math::Batch::Lerp(Math::Span<const T>(from), Math::Span<const T>(to).Subspan(3u), T(0.3), Math::Span<T>(blended));
+    Math::Batch::Lerp(T(-2), T(6), Math::Span<const T>(fractions), Math::Span<T>(ramp));
+    Math::Batch::Sign(Math::Span<T>(signs));
+
+    // The packed kernel may contract into fused multiply-adds differently from the scalar tail
+    const T tolerance = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+    for(std::size_t i = 0u; i < from.size(); i++)
+    {
+      ASSERT_NEAR(blended[i], Math::Lerp(from[i], to[i + 3u], T(0.3)), tolerance);
+      ASSERT_NEAR(ramp[i], Math::Lerp(T(-2), T(6), fractions[i]), tolerance);
+      ASSERT_EQ(signs[i], Math::Sign(from[i]));
+    }
+  }
+
+  TYPED_TEST(CommonBatchTyped, Overlap)
+  {
+    using T = TypeParam;
+
+    const std::vector<T> values = CreateValues<T>(80u);
+    const std::size_t count     = 50u;
+
+    // Output shifted above and below the input by less than one register and by more than one
+    for(std::size_t shift = 1u; shift <= 9u; shift += 4u)
+    {
+      std::vector<T> above = values;
+      Math::Batch::Normalize01(Math::Span<const T>(above.data(), count), Math::Span<T>(above.data() + shift, count), T(-2), T(2));
+
+      std::vector<T> below = values;
+      Math::Batch::Normalize01(Math::Span<const T>(below.data() + shift, count), Math::Span<T>(below.data(), count), T(-2), T(2));
+
+      for(std::size_t i = 0u; i < count; i++)
+      {
+        ASSERT_EQ(above[i + shift], Math::Normalize01(values[i], T(-2), T(2)));
+        ASSERT_EQ(below[i], Math::Normalize01(values[i + shift], T(-2), T(2)));
+      }
+
+      // Both blend inputs overlap the output, one from each side
+      std::vector<T> both = values;
+      Math::Batch::Lerp(Math::Span<const T>(both.data(), count),
+                        Math::Span<const T>(both.data() + (2u * shift), count),
+                        T(0.5),
+                        Math::Span<T>(both.data() + shift, count));
+
+      const T tolerance = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+      for(std::size_t i = 0u; i < count; i++)
+      {
+        ASSERT_NEAR(both[i + shift], Math::Lerp(values[i], values[i + (2u * shift)], T(0.5)), tolerance);
+      }
+
+      // The fractions overload, which loops without packing for double on targets without AVX2
+      std::vector<T> rampAbove = values;
+      Math::Batch::Lerp(T(-2), T(6), Math::Span<const T>(rampAbove.data(), count), Math::Span<T>(rampAbove.data() + shift, count));
+
+      std::vector<T> rampBelow = values;
+      Math::Batch::Lerp(T(-2), T(6), Math::Span<const T>(rampBelow.data() + shift, count), Math::Span<T>(rampBelow.data(), count));
+
+      for(std::size_t i = 0u; i < count; i++)
+      {
+        ASSERT_NEAR(rampAbove[i + shift], Math::Lerp(T(-2), T(6), values[i]), tolerance);
+        ASSERT_NEAR(rampBelow[i], Math::Lerp(T(-2), T(6), values[i + shift]), tolerance);
+      }
+    }
+  }
+
+  TEST(CommonBatch, Integral)
+  {
+    std::vector<int> values;
+    for(int i = -20; i < 21; i++)
+    {
+      values.push_back(i);
+    }
+
+    std::vector<int> clamped(values.size());
+    std::vector<int> signs = values;
+    Math::Batch::Clamp(Math::Span<const int>(values), Math::Span<int>(clamped), -5, 7);
+    Math::Batch::Sign(Math::Span<int>(signs));
+
+    for(std::size_t i = 0u; i < values.size(); i++)
+    {
+      ASSERT_EQ(clamped[i], Math::Clamp(values[i], -5, 7));
+      ASSERT_EQ(signs[i], Math::Sign(values[i]));
+    }
+  }
+} // namespace UnitTest
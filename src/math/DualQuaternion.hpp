@@ -0,0 +1,165 @@
+#ifndef __MATH__DUALQUATERNION_HPP__
+#define __MATH__DUALQUATERNION_HPP__
+
+#include "Common.hpp"
+#include "Quaternion.hpp"
+#include "Span.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+// Rigid transform real + epsilon * dual, with the rotation as the real part and dual = translation * real / 2
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class DualQuaternion
+{
+  public:
+  static constexpr DualQuaternion<T> Zero     = DualQuaternion<T>(Quaternion<T>(), Quaternion<T>());
+  static constexpr DualQuaternion<T> Identity = DualQuaternion<T>(Quaternion<T>::Identity, Quaternion<T>());
+
+  // Rotates first, then translates
+  static constexpr DualQuaternion<T> FromRotationTranslation(const Quaternion<T>& rotation, const Vector3<T>& translation)
+  {
+    const Quaternion<T> pure(translation.GetX(), translation.GetY(), translation.GetZ(), static_cast<T>(0));
+    return DualQuaternion<T>(rotation, (pure * rotation).Scale(static_cast<T>(0.5)));
+  }
+
+  static constexpr DualQuaternion<T> FromRotation(const Quaternion<T>& rotation) { return DualQuaternion<T>(rotation, Quaternion<T>()); }
+  static constexpr DualQuaternion<T> FromTranslation(const Vector3<T>& translation) { return FromRotationTranslation(Quaternion<T>::Identity, translation); }
+
+  // Screw linear interpolation between unit dual quaternions along the shorter arc, constant in angular and linear velocity
+  static DualQuaternion<T> ScLerp(const DualQuaternion<T>& from, const DualQuaternion<T>& to, T fraction)
+  {
+    constexpr T kZero = static_cast<T>(0);
+    constexpr T kHalf = static_cast<T>(0.5);
+
+    const T sign                    = (Quaternion<T>::DotProduct(from.m_Real, to.m_Real) < kZero) ? static_cast<T>(-1) : static_cast<T>(1);
+    const DualQuaternion<T> between = from.ToConjugate() * to.Scale(sign);
+
+    // The screw of the relative transform: angle around and distance along the axis, and the moment of the axis
+    const Vector3<T> vector(between.m_Real.GetX(), between.m_Real.GetY(), between.m_Real.GetZ());
+    const Vector3<T> dualVector(between.m_Dual.GetX(), between.m_Dual.GetY(), between.m_Dual.GetZ());
+    const T sine = vector.GetMagnitude();
+
+    // Without rotation the screw degenerates to a pure translation, which scales linearly
+    if(sine < static_cast<T>(1e-6))
+    {
+      return from * DualQuaternion<T>(Quaternion<T>::Identity, between.m_Dual.Scale(fraction)).ToNormalized();
+    }
+
+    const T cosine          = std::min(between.m_Real.GetW(), static_cast<T>(1));
+    const Vector3<T> axis   = vector / sine;
+    const T angle           = static_cast<T>(2) * Math::Acos(cosine);
+    const T distance        = static_cast<T>(-2) * between.m_Dual.GetW() / sine;
+    const Vector3<T> moment = (dualVector - (axis * (distance * kHalf * cosine))) / sine;
+
+    const T halfAngle    = kHalf * fraction * angle;
+    const T halfDistance = kHalf * fraction * distance;
+    const T partSine     = Math::Sin(halfAngle);
+    const T partCosine   = Math::Cos(halfAngle);
+
+    const Vector3<T> real = axis * partSine;
+    const Vector3<T> dual = (moment * partSine) + (axis * (halfDistance * partCosine));
+    const DualQuaternion<T> power(Quaternion<T>(real.GetX(), real.GetY(), real.GetZ(), partCosine),
+                                  Quaternion<T>(dual.GetX(), dual.GetY(), dual.GetZ(), -halfDistance * partSine));
+    return from * power;
+  }
+
+  // Dual quaternion linear blending, cheap and close to ScLerp for the small angles between neighbouring bones
+  static DualQuaternion<T> Dlb(const DualQuaternion<T>& from, const DualQuaternion<T>& to, T fraction)
+  {
+    const T sign = (Quaternion<T>::DotProduct(from.m_Real, to.m_Real) < static_cast<T>(0)) ? static_cast<T>(-1) : static_cast<T>(1);
+    return (from.Scale(static_cast<T>(1) - fraction) + to.Scale(sign * fraction)).ToNormalized();
+  }
+
+  // Weighted blend of several transforms, each flipped into the hemisphere of the first before summing
+  static DualQuaternion<T> Dlb(Math::Span<const DualQuaternion<T>> values, Math::Span<const T> weights)
+  {
+    assert(!values.IsEmpty() && (values.GetSize() == weights.GetSize()));
+
+    DualQuaternion<T> result = Zero;
+    const std::size_t count = values.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T sign = (Quaternion<T>::DotProduct(values[0].m_Real, values[i].m_Real) < static_cast<T>(0)) ? static_cast<T>(-1) : static_cast<T>(1);
+      result       = result + values[i].Scale(sign * weights[i]);
+    }
+
+    return result.ToNormalized();
+  }
+
+  constexpr bool operator==(const DualQuaternion<T>& rhs) const { return (m_Real == rhs.m_Real) && (m_Dual == rhs.m_Dual); }
+  constexpr bool operator!=(const DualQuaternion<T>& rhs) const { return !((*this) == rhs); }
+
+  constexpr DualQuaternion<T> operator+(const DualQuaternion<T>& rhs) const { return DualQuaternion<T>(m_Real + rhs.m_Real, m_Dual + rhs.m_Dual); }
+
+  // Applies rhs first, as with Quaternion
+  constexpr DualQuaternion<T> operator*(const DualQuaternion<T>& rhs) const
+  {
+    return DualQuaternion<T>(m_Real * rhs.m_Real, (m_Real * rhs.m_Dual) + (m_Dual * rhs.m_Real));
+  }
+
+  constexpr DualQuaternion<T>& operator*=(const DualQuaternion<T>& rhs) { return (*this) = (*this) * rhs; }
+
+  constexpr DualQuaternion<T> Scale(T value) const { return DualQuaternion<T>(m_Real.Scale(value), m_Dual.Scale(value)); }
+
+  // Conjugates both parts, the inverse of a unit dual quaternion
+  constexpr DualQuaternion<T> ToConjugate() const { return DualQuaternion<T>(m_Real.ToConjugate(), m_Dual.ToConjugate()); }
+
+  // Inverse of any dual quaternion with a non-zero real part
+  constexpr DualQuaternion<T> Inverse() const
+  {
+    const Quaternion<T> real = m_Real.Inverse();
+    return DualQuaternion<T>(real, (real * m_Dual * real).Scale(static_cast<T>(-1)));
+  }
+
+  // Unit real part, and the dual part made orthogonal to it again so it still encodes a pure translation
+  DualQuaternion<T> ToNormalized() const
+  {
+    const T magnitude = m_Real.GetMagnitude();
+    if(magnitude == static_cast<T>(0))
+    {
+      return *this;
+    }
+
+    const T inverse          = static_cast<T>(1) / magnitude;
+    const Quaternion<T> real = m_Real.Scale(inverse);
+    const Quaternion<T> dual = m_Dual.Scale(inverse);
+    return DualQuaternion<T>(real, dual - real.Scale(Quaternion<T>::DotProduct(real, dual)));
+  }
+
+  // Expects a unit dual quaternion
+  constexpr Vector3<T> TransformPoint(const Vector3<T>& value) const { return m_Real.Rotate(value) + GetTranslation(); }
+
+  constexpr Vector3<T> TransformDirection(const Vector3<T>& value) const { return m_Real.Rotate(value); }
+
+  // Vector part of 2 dual * conjugate(real), as 2 (w_r v_d - w_d v_r + v_r x v_d) without the full product
+  constexpr Vector3<T> GetTranslation() const
+  {
+    const Vector3<T> real(m_Real.GetX(), m_Real.GetY(), m_Real.GetZ());
+    const Vector3<T> dual(m_Dual.GetX(), m_Dual.GetY(), m_Dual.GetZ());
+    return ((dual * m_Real.GetW()) - (real * m_Dual.GetW()) + Vector3<T>::CrossProduct(real, dual)) * static_cast<T>(2);
+  }
+
+  constexpr const Quaternion<T>& GetRotation() const { return m_Real; }
+  constexpr const Quaternion<T>& GetReal() const { return m_Real; }
+  constexpr const Quaternion<T>& GetDual() const { return m_Dual; }
+
+  constexpr DualQuaternion(const Quaternion<T>& real, const Quaternion<T>& dual)
+      : m_Real(real)
+      , m_Dual(dual)
+  {}
+
+  constexpr DualQuaternion()
+      : m_Real(Quaternion<T>::Identity)
+      , m_Dual(Quaternion<T>())
+  {}
+
+  private:
+  Quaternion<T> m_Real;
+  Quaternion<T> m_Dual;
+};
+
+#endif // __MATH__DUALQUATERNION_HPP__
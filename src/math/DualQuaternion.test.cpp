@@ -0,0 +1,130 @@
+#include "DualQuaternion.hpp"
+#include "Quaternion.hpp"
+#include "Vector3.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class DualQuaternionTyped : public Test
+  {};
+
+  using DualQuaternionTypes = Types<float, double>;
+  TYPED_TEST_SUITE(DualQuaternionTyped, DualQuaternionTypes);
+
+  template<class T>
+  static Vector3<T> Make(double x, double y, double z)
+  {
+    return Vector3<T>(static_cast<T>(x), static_cast<T>(y), static_cast<T>(z));
+  }
+
+  template<class T>
+  static void ExpectNear(const Vector3<T>& actual, const Vector3<T>& expected)
+  {
+    const T tolerance = static_cast<T>(std::is_same_v<T, float> ? 1e-4 : 1e-10);
+    ASSERT_NEAR(actual.GetX(), expected.GetX(), tolerance);
+    ASSERT_NEAR(actual.GetY(), expected.GetY(), tolerance);
+    ASSERT_NEAR(actual.GetZ(), expected.GetZ(), tolerance);
+  }
+
+  TYPED_TEST(DualQuaternionTyped, Transform)
+  {
+    using T = TypeParam;
+
+    const Quaternion<T> rotation      = Quaternion<T>::FromAxisAngle(Make<T>(1, 2, -1), static_cast<T>(1.2));
+    const Vector3<T> translation      = Make<T>(3, -4, 0.5);
+    const DualQuaternion<T> transform = DualQuaternion<T>::FromRotationTranslation(rotation, translation);
+    const Vector3<T> point            = Make<T>(-1, 2, 7);
+
+    ExpectNear(transform.GetTranslation(), translation);
+    ExpectNear(transform.TransformPoint(point), rotation.Rotate(point) + translation);
+    ExpectNear(transform.TransformDirection(point), rotation.Rotate(point));
+    ExpectNear(DualQuaternion<T>::Identity.TransformPoint(point), point);
+    ExpectNear(DualQuaternion<T>::FromTranslation(translation).TransformPoint(point), point + translation);
+    ExpectNear(DualQuaternion<T>::FromRotation(rotation).TransformPoint(point), rotation.Rotate(point));
+  }
+
+  TYPED_TEST(DualQuaternionTyped, Compose)
+  {
+    using T = TypeParam;
+
+    const Quaternion<T> first  = Quaternion<T>::FromAxisAngle(Make<T>(0, 1, 0), static_cast<T>(0.4));
+    const Quaternion<T> second = Quaternion<T>::FromAxisAngle(Make<T>(1, 0, 1), static_cast<T>(-2));
+    const DualQuaternion<T> a  = DualQuaternion<T>::FromRotationTranslation(first, Make<T>(1, 2, 3));
+    const DualQuaternion<T> b  = DualQuaternion<T>::FromRotationTranslation(second, Make<T>(-5, 0, 2));
+    const Vector3<T> point     = Make<T>(0.5, -3, 1);
+
+    // b first, then a
+    ExpectNear((a * b).TransformPoint(point), a.TransformPoint(b.TransformPoint(point)));
+
+    DualQuaternion<T> composed = a;
+    composed *= b;
+    ExpectNear(composed.TransformPoint(point), (a * b).TransformPoint(point));
+
+    ExpectNear((a.ToConjugate() * a).TransformPoint(point), point);
+    ExpectNear((a.Inverse() * a).TransformPoint(point), point);
+
+    // The general inverse also undoes scaled dual quaternions
+    const DualQuaternion<T> scaled = a.Scale(static_cast<T>(3));
+    const DualQuaternion<T> unit   = scaled.Inverse() * scaled;
+    ExpectNear(unit.TransformPoint(point), point);
+  }
+
+  TYPED_TEST(DualQuaternionTyped, Normalize)
+  {
+    using T = TypeParam;
+
+    const Quaternion<T> rotation      = Quaternion<T>::FromAxisAngle(Make<T>(2, -1, 1), static_cast<T>(0.9));
+    const DualQuaternion<T> transform = DualQuaternion<T>::FromRotationTranslation(rotation, Make<T>(1, 1, -2));
+
+    // Off the unit constraint in both parts: scaled, and with some of the real part leaked into the dual one
+    const DualQuaternion<T> drifted(transform.GetReal().Scale(static_cast<T>(1.5)),
+                                    transform.GetDual().Scale(static_cast<T>(1.5)) + rotation.Scale(static_cast<T>(0.1)));
+    const DualQuaternion<T> normalized = drifted.ToNormalized();
+
+    ASSERT_NEAR(normalized.GetReal().GetMagnitude(), static_cast<T>(1), static_cast<T>(1e-6));
+    ASSERT_NEAR(Quaternion<T>::DotProduct(normalized.GetReal(), normalized.GetDual()), static_cast<T>(0), static_cast<T>(1e-6));
+    ExpectNear(normalized.GetTranslation(), transform.GetTranslation());
+  }
+
+  TYPED_TEST(DualQuaternionTyped, Blend)
+  {
+    using T = TypeParam;
+
+    // A screw: a quarter turn around z together with 4 units along z, around an axis through (1, 0, 0)
+    const Quaternion<T> turn          = Quaternion<T>::FromAxisAngle(Make<T>(0, 0, 1), static_cast<T>(1.5707963267948966));
+    const DualQuaternion<T> from      = DualQuaternion<T>::FromTranslation(Make<T>(0, 0, 0));
+    const DualQuaternion<T> to        = DualQuaternion<T>::FromRotationTranslation(turn, Make<T>(1, -1, 4));
+    const DualQuaternion<T> half      = DualQuaternion<T>::ScLerp(from, to, static_cast<T>(0.5));
+    const Quaternion<T> halfTurn      = Quaternion<T>::FromAxisAngle(Make<T>(0, 0, 1), static_cast<T>(0.7853981633974483));
+    const Vector3<T> point            = Make<T>(1, 0, 0);
+
+    // Points on the screw axis only slide along it
+    ExpectNear(half.TransformPoint(point), Make<T>(1, 0, 2));
+    ExpectNear(half.TransformPoint(Make<T>(2, 0, 0)), Make<T>(1, 0, 2) + halfTurn.Rotate(Make<T>(1, 0, 0)));
+
+    ExpectNear(DualQuaternion<T>::ScLerp(from, to, static_cast<T>(0)).TransformPoint(point), from.TransformPoint(point));
+    ExpectNear(DualQuaternion<T>::ScLerp(from, to, static_cast<T>(1)).TransformPoint(point), to.TransformPoint(point));
+
+    // Negated inputs are the same transform, the blend takes the shorter arc either way
+    ExpectNear(DualQuaternion<T>::ScLerp(from, to.Scale(static_cast<T>(-1)), static_cast<T>(0.5)).TransformPoint(point), Make<T>(1, 0, 2));
+
+    // Pure translations blend linearly
+    const DualQuaternion<T> slide = DualQuaternion<T>::ScLerp(from, DualQuaternion<T>::FromTranslation(Make<T>(2, 4, 6)), static_cast<T>(0.25));
+    ExpectNear(slide.TransformPoint(point), Make<T>(1.5, 1, 1.5));
+
+    // Dlb agrees with ScLerp at the ends and in the middle of a symmetric blend
+    const DualQuaternion<T> linear = DualQuaternion<T>::Dlb(from, to, static_cast<T>(0.5));
+    ExpectNear(linear.TransformPoint(point), half.TransformPoint(point));
+    ExpectNear(DualQuaternion<T>::Dlb(from, to.Scale(static_cast<T>(-1)), static_cast<T>(0.5)).TransformPoint(point), half.TransformPoint(point));
+
+    const std::vector<DualQuaternion<T>> values{from, to.Scale(static_cast<T>(-1))};
+    const std::vector<T> weights{static_cast<T>(0.5), static_cast<T>(0.5)};
+    ExpectNear(DualQuaternion<T>::Dlb(values, weights).TransformPoint(point), half.TransformPoint(point));
+  }
+} // namespace UnitTest
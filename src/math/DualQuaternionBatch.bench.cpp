@@ -0,0 +1,86 @@
+#include "Benchmark.hpp"
+#include "DualQuaternion.hpp"
+#include "DualQuaternionBatch.hpp"
+#include "Quaternion.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Benchmark
+{
+  // A skeleton of 64 bones, each vertex weighted to four of them as after a typical rig export
+  template<class T>
+  struct SkinData
+  {
+    std::vector<DualQuaternion<T>> m_Transforms;
+    std::vector<std::array<std::uint32_t, 4u>> m_Bones;
+    std::vector<std::array<T, 4u>> m_Weights;
+    std::vector<Vector3<T>> m_Positions;
+  };
+
+  template<class T>
+  static SkinData<T> CreateSkinData(std::size_t count)
+  {
+    constexpr std::uint32_t kBoneCount = 64u;
+
+    const std::vector<T> scalars = CreateScalars<T>(count + kBoneCount + 4u);
+
+    SkinData<T> result;
+    for(std::uint32_t i = 0u; i < kBoneCount; i++)
+    {
+      const Quaternion<T> rotation = Quaternion<T>::FromAxisAngle(Vector3<T>(scalars[i], static_cast<T>(1), scalars[i + 1u]), scalars[i + 2u]);
+      result.m_Transforms.push_back(DualQuaternion<T>::FromRotationTranslation(rotation, Vector3<T>(scalars[i], scalars[i + 3u], static_cast<T>(1))));
+    }
+
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const std::uint32_t bone = static_cast<std::uint32_t>((i * 7u) % kBoneCount);
+      result.m_Bones.push_back({bone, (bone + 1u) % kBoneCount, (bone + 9u) % kBoneCount, (bone + 30u) % kBoneCount});
+      result.m_Weights.push_back({static_cast<T>(0.4), static_cast<T>(0.3), static_cast<T>(0.2), static_cast<T>(0.1)});
+      result.m_Positions.push_back(Vector3<T>(scalars[i], scalars[i + 1u], scalars[i + 2u]));
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static bool RegisterDualQuaternionBatch()
+  {
+    // Blend then transform one vertex at a time through the DualQuaternion operators
+    RegisterBatch(Name<T>("DualQuaternionBatch_SkinScalar"),
+                  [](std::size_t count)
+                  {
+                    return [data = CreateSkinData<T>(count), out = std::vector<Vector3<T>>(count)]() mutable
+                    {
+                      for(std::size_t i = 0u; i < data.m_Positions.size(); i++)
+                      {
+                        const std::array<DualQuaternion<T>, 4u> influences = {data.m_Transforms[data.m_Bones[i][0]], data.m_Transforms[data.m_Bones[i][1]],
+                                                                              data.m_Transforms[data.m_Bones[i][2]], data.m_Transforms[data.m_Bones[i][3]]};
+                        out[i] = DualQuaternion<T>::Dlb(influences, data.m_Weights[i]).TransformPoint(data.m_Positions[i]);
+                      }
+
+                      benchmark::DoNotOptimize(out.data());
+                    };
+                  });
+
+    RegisterBatch(Name<T>("DualQuaternionBatch_Skin"),
+                  [](std::size_t count)
+                  {
+                    SkinData<T> data = CreateSkinData<T>(count);
+                    const Vector3Array<T> positions(data.m_Positions);
+                    return [data, positions, out = Vector3Array<T>()]() mutable
+                    {
+                      Math::Batch::Skin<T>(data.m_Transforms, data.m_Bones, data.m_Weights, positions, out);
+                      benchmark::DoNotOptimize(out.GetX().GetData());
+                    };
+                  });
+
+    return true;
+  }
+
+  static const bool kDualQuaternionBatchRegistered = RegisterDualQuaternionBatch<float>() && RegisterDualQuaternionBatch<double>();
+} // namespace Benchmark
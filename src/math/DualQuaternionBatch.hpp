@@ -0,0 +1,220 @@
+#ifndef __MATH__DUALQUATERNIONBATCH_HPP__
+#define __MATH__DUALQUATERNIONBATCH_HPP__
+
+#include "DualQuaternion.hpp"
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+#include "Span.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace Math::Detail
+{
+  // Blend of the four influences of one vertex, each flipped into the hemisphere of the first, scaled to a unit real part.
+  // A vertex without weight, or whose influences cancel out, keeps the identity instead of dividing by zero.
+  template<class T>
+  DualQuaternion<T> BlendInfluences(Math::Span<const DualQuaternion<T>> transforms,
+                                    const std::array<std::uint32_t, 4u>& bones,
+                                    const std::array<T, 4u>& weights)
+  {
+    const Quaternion<T>& first = transforms[bones[0]].GetReal();
+
+    DualQuaternion<T> blend = DualQuaternion<T>::Zero;
+    for(std::size_t j = 0u; j < 4u; j++)
+    {
+      const DualQuaternion<T>& transform = transforms[bones[j]];
+      const T sign                       = (Quaternion<T>::DotProduct(first, transform.GetReal()) < static_cast<T>(0)) ? static_cast<T>(-1) : static_cast<T>(1);
+      blend                              = blend + transform.Scale(sign * weights[j]);
+    }
+
+    const T square = blend.GetReal().GetSquareMagnitude();
+    if(square == static_cast<T>(0))
+    {
+      return DualQuaternion<T>::Identity;
+    }
+
+    return blend.Scale(static_cast<T>(1) / Math::Sqrt(square));
+  }
+
+  // Shared by both Skin overloads, normals and outNormals are null when only positions are skinned
+  template<class T>
+  void Skin(Math::Span<const DualQuaternion<T>> transforms,
+            Math::Span<const std::array<std::uint32_t, 4u>> bones,
+            Math::Span<const std::array<T, 4u>> weights,
+            const Vector3Array<T>& positions,
+            const Vector3Array<T>* normals,
+            Vector3Array<T>& outPositions,
+            Vector3Array<T>* outNormals)
+  {
+    const std::size_t count = positions.GetSize();
+    assert((bones.GetSize() == count) && (weights.GetSize() == count));
+    assert((normals == nullptr) || (normals->GetSize() == count));
+
+    outPositions.Resize(count);
+    if(outNormals != nullptr)
+    {
+      outNormals->Resize(count);
+    }
+
+    std::size_t i = 0u;
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      namespace Simd               = Math::Simd;
+      constexpr std::size_t kLanes = Simd::Traits<T>::kLanes;
+
+      // Components x, y, z, w of the real part, then of the dual part, summed over the influences lane by lane
+      alignas(Simd::Traits<T>::kAlignment) T blended[8u][kLanes];
+
+      for(; (i + kLanes) <= count; i += kLanes)
+      {
+        // The gather stays scalar, the vertices of a block reference unrelated bones
+        for(std::size_t lane = 0u; lane < kLanes; lane++)
+        {
+          const std::array<std::uint32_t, 4u>& vertexBones = bones[i + lane];
+          const std::array<T, 4u>& vertexWeights          = weights[i + lane];
+          const Quaternion<T>& first                      = transforms[vertexBones[0]].GetReal();
+
+          T sum[8u] = {};
+          for(std::size_t j = 0u; j < 4u; j++)
+          {
+            const DualQuaternion<T>& transform = transforms[vertexBones[j]];
+            const Quaternion<T>& real          = transform.GetReal();
+            const Quaternion<T>& dual          = transform.GetDual();
+            const T dot    = (first.GetX() * real.GetX()) + (first.GetY() * real.GetY()) + (first.GetZ() * real.GetZ()) + (first.GetW() * real.GetW());
+            const T weight = (dot < static_cast<T>(0)) ? -vertexWeights[j] : vertexWeights[j];
+
+            sum[0u] += weight * real.GetX();
+            sum[1u] += weight * real.GetY();
+            sum[2u] += weight * real.GetZ();
+            sum[3u] += weight * real.GetW();
+            sum[4u] += weight * dual.GetX();
+            sum[5u] += weight * dual.GetY();
+            sum[6u] += weight * dual.GetZ();
+            sum[7u] += weight * dual.GetW();
+          }
+
+          // Same identity fallback as BlendInfluences
+          if(((sum[0u] * sum[0u]) + (sum[1u] * sum[1u]) + (sum[2u] * sum[2u]) + (sum[3u] * sum[3u])) == static_cast<T>(0))
+          {
+            for(std::size_t component = 0u; component < 8u; component++)
+            {
+              sum[component] = (component == 3u) ? static_cast<T>(1) : static_cast<T>(0);
+            }
+          }
+
+          for(std::size_t component = 0u; component < 8u; component++)
+          {
+            blended[component][lane] = sum[component];
+          }
+        }
+
+        auto rx = Simd::Load(blended[0u]);
+        auto ry = Simd::Load(blended[1u]);
+        auto rz = Simd::Load(blended[2u]);
+        auto rw = Simd::Load(blended[3u]);
+
+        const auto square  = Simd::Add(Simd::Add(Simd::Multiply(rx, rx), Simd::Multiply(ry, ry)), Simd::Add(Simd::Multiply(rz, rz), Simd::Multiply(rw, rw)));
+        const auto inverse = Simd::Divide(Simd::Broadcast(static_cast<T>(1)), Simd::Sqrt(square));
+
+        rx            = Simd::Multiply(rx, inverse);
+        ry            = Simd::Multiply(ry, inverse);
+        rz            = Simd::Multiply(rz, inverse);
+        rw            = Simd::Multiply(rw, inverse);
+        const auto dx = Simd::Multiply(Simd::Load(blended[4u]), inverse);
+        const auto dy = Simd::Multiply(Simd::Load(blended[5u]), inverse);
+        const auto dz = Simd::Multiply(Simd::Load(blended[6u]), inverse);
+        const auto dw = Simd::Multiply(Simd::Load(blended[7u]), inverse);
+
+        const auto two = Simd::Broadcast(static_cast<T>(2));
+
+        // Rotation as in Quaternion::Rotate, v + w t + u x t with t = 2 u x v
+        const auto rotate = [&](const T* xs, const T* ys, const T* zs, T* ox, T* oy, T* oz, bool translate)
+        {
+          const auto x = Simd::LoadUnaligned(xs + i);
+          const auto y = Simd::LoadUnaligned(ys + i);
+          const auto z = Simd::LoadUnaligned(zs + i);
+
+          const auto tx = Simd::Multiply(two, Simd::Subtract(Simd::Multiply(ry, z), Simd::Multiply(rz, y)));
+          const auto ty = Simd::Multiply(two, Simd::Subtract(Simd::Multiply(rz, x), Simd::Multiply(rx, z)));
+          const auto tz = Simd::Multiply(two, Simd::Subtract(Simd::Multiply(rx, y), Simd::Multiply(ry, x)));
+
+          auto px = Simd::Add(Simd::Add(x, Simd::Multiply(rw, tx)), Simd::Subtract(Simd::Multiply(ry, tz), Simd::Multiply(rz, ty)));
+          auto py = Simd::Add(Simd::Add(y, Simd::Multiply(rw, ty)), Simd::Subtract(Simd::Multiply(rz, tx), Simd::Multiply(rx, tz)));
+          auto pz = Simd::Add(Simd::Add(z, Simd::Multiply(rw, tz)), Simd::Subtract(Simd::Multiply(rx, ty), Simd::Multiply(ry, tx)));
+
+          // Translation as in DualQuaternion::GetTranslation, 2 (w_r v_d - w_d v_r + v_r x v_d)
+          if(translate)
+          {
+            const auto cx = Simd::Subtract(Simd::Multiply(ry, dz), Simd::Multiply(rz, dy));
+            const auto cy = Simd::Subtract(Simd::Multiply(rz, dx), Simd::Multiply(rx, dz));
+            const auto cz = Simd::Subtract(Simd::Multiply(rx, dy), Simd::Multiply(ry, dx));
+
+            px = Simd::Add(px, Simd::Multiply(two, Simd::Add(Simd::Subtract(Simd::Multiply(rw, dx), Simd::Multiply(dw, rx)), cx)));
+            py = Simd::Add(py, Simd::Multiply(two, Simd::Add(Simd::Subtract(Simd::Multiply(rw, dy), Simd::Multiply(dw, ry)), cy)));
+            pz = Simd::Add(pz, Simd::Multiply(two, Simd::Add(Simd::Subtract(Simd::Multiply(rw, dz), Simd::Multiply(dw, rz)), cz)));
+          }
+
+          Simd::StoreUnaligned(ox + i, px);
+          Simd::StoreUnaligned(oy + i, py);
+          Simd::StoreUnaligned(oz + i, pz);
+        };
+
+        rotate(positions.GetX().GetData(), positions.GetY().GetData(), positions.GetZ().GetData(), outPositions.GetX().GetData(),
+               outPositions.GetY().GetData(), outPositions.GetZ().GetData(), true);
+        if(normals != nullptr)
+        {
+          rotate(normals->GetX().GetData(), normals->GetY().GetData(), normals->GetZ().GetData(), outNormals->GetX().GetData(),
+                 outNormals->GetY().GetData(), outNormals->GetZ().GetData(), false);
+        }
+      }
+    }
+
+    for(; i < count; i++)
+    {
+      const DualQuaternion<T> blend = BlendInfluences(transforms, bones[i], weights[i]);
+      outPositions.Set(i, blend.TransformPoint(positions[i]));
+      if(normals != nullptr)
+      {
+        outNormals->Set(i, blend.TransformDirection((*normals)[i]));
+      }
+    }
+  }
+} // namespace Math::Detail
+
+namespace Math::Batch
+{
+  // Dual quaternion skinning: every vertex blends the transforms of up to four bones with Dlb and moves by the result.
+  // Unused influences take a zero weight and any valid bone, vertices without any weight are left unchanged. The outputs
+  // may alias the inputs.
+  template<class T>
+  void Skin(Math::Span<const DualQuaternion<T>> transforms,
+            Math::Span<const std::array<std::uint32_t, 4u>> bones,
+            Math::Span<const std::array<T, 4u>> weights,
+            const Vector3Array<T>& positions,
+            Vector3Array<T>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::DualQuaternion::Skin", positions.GetSize());
+    Math::Detail::Skin(transforms, bones, weights, positions, static_cast<const Vector3Array<T>*>(nullptr), out, static_cast<Vector3Array<T>*>(nullptr));
+  }
+
+  // Positions and normals under the same blend, normals are only rotated
+  template<class T>
+  void Skin(Math::Span<const DualQuaternion<T>> transforms,
+            Math::Span<const std::array<std::uint32_t, 4u>> bones,
+            Math::Span<const std::array<T, 4u>> weights,
+            const Vector3Array<T>& positions,
+            const Vector3Array<T>& normals,
+            Vector3Array<T>& outPositions,
+            Vector3Array<T>& outNormals)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::DualQuaternion::Skin", positions.GetSize());
+    Math::Detail::Skin(transforms, bones, weights, positions, &normals, outPositions, &outNormals);
+  }
+} // namespace Math::Batch
+
+#endif // __MATH__DUALQUATERNIONBATCH_HPP__
@@ -0,0 +1,113 @@
+#include "DualQuaternion.hpp"
+#include "DualQuaternionBatch.hpp"
+#include "Quaternion.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class DualQuaternionBatchTyped : public Test
+  {};
+
+  using DualQuaternionBatchTypes = Types<float, double>;
+  TYPED_TEST_SUITE(DualQuaternionBatchTyped, DualQuaternionBatchTypes);
+
+  template<class T>
+  static void ExpectNear(const Vector3<T>& actual, const Vector3<T>& expected)
+  {
+    const T tolerance = static_cast<T>(std::is_same_v<T, float> ? 1e-4 : 1e-10);
+    ASSERT_NEAR(actual.GetX(), expected.GetX(), tolerance);
+    ASSERT_NEAR(actual.GetY(), expected.GetY(), tolerance);
+    ASSERT_NEAR(actual.GetZ(), expected.GetZ(), tolerance);
+  }
+
+  // Bones along a bent chain, every other one stored negated, which is the same transform
+  template<class T>
+  static std::vector<DualQuaternion<T>> CreateBones(std::size_t count)
+  {
+    std::vector<DualQuaternion<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T value                     = static_cast<T>(i);
+      const Quaternion<T> rotation      = Quaternion<T>::FromAxisAngle(Vector3<T>(static_cast<T>(1), value, static_cast<T>(2)), value * static_cast<T>(0.3));
+      const DualQuaternion<T> transform = DualQuaternion<T>::FromRotationTranslation(rotation, Vector3<T>(value, static_cast<T>(1), -value));
+      result.push_back(((i % 2u) == 0u) ? transform : transform.Scale(static_cast<T>(-1)));
+    }
+
+    return result;
+  }
+
+  TYPED_TEST(DualQuaternionBatchTyped, Skin)
+  {
+    using T = TypeParam;
+
+    const std::vector<DualQuaternion<T>> transforms = CreateBones<T>(7u);
+
+    // An odd count so the last vertices take the scalar path
+    std::vector<Vector3<T>> positions;
+    std::vector<Vector3<T>> normals;
+    std::vector<std::array<std::uint32_t, 4u>> bones;
+    std::vector<std::array<T, 4u>> weights;
+    for(std::size_t i = 0u; i < 37u; i++)
+    {
+      const T value = static_cast<T>(i);
+      positions.push_back(Vector3<T>(value * static_cast<T>(0.1), static_cast<T>(2) - value, static_cast<T>(0.5)));
+      normals.push_back(Vector3<T>(static_cast<T>(1), value, static_cast<T>(-1)).ToNormalized());
+
+      const std::uint32_t bone = static_cast<std::uint32_t>(i % 7u);
+      bones.push_back({bone, (bone + 1u) % 7u, (bone + 3u) % 7u, 0u});
+      weights.push_back({static_cast<T>(0.5), static_cast<T>(0.25), static_cast<T>(0.25) - (static_cast<T>(i % 3u) * static_cast<T>(0.05)),
+                         static_cast<T>(i % 3u) * static_cast<T>(0.05)});
+    }
+
+    // Vertex 3 follows a single bone exactly
+    weights[3] = {static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)};
+
+    // Unweighted vertices stay in place, one in a packed block and one in the scalar tail
+    const std::array<T, 4u> unweighted = {static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)};
+    weights[5]                         = unweighted;
+    weights[36]                        = unweighted;
+
+    Vector3Array<T> skinned;
+    Math::Batch::Skin<T>(transforms, bones, weights, Vector3Array<T>(positions), skinned);
+    ASSERT_EQ(skinned.GetSize(), positions.size());
+
+    Vector3Array<T> skinnedPositions(positions);
+    Vector3Array<T> skinnedNormals(normals);
+    Math::Batch::Skin<T>(transforms, bones, weights, skinnedPositions, skinnedNormals, skinnedPositions, skinnedNormals);
+
+    for(std::size_t i = 0u; i < positions.size(); i++)
+    {
+      if(weights[i] == unweighted)
+      {
+        ASSERT_TRUE(skinned[i] == positions[i]);
+        ASSERT_TRUE(skinnedPositions[i] == positions[i]);
+        ASSERT_TRUE(skinnedNormals[i] == normals[i]);
+        continue;
+      }
+
+      std::vector<DualQuaternion<T>> influences;
+      for(std::uint32_t bone : bones[i])
+      {
+        influences.push_back(transforms[bone]);
+      }
+
+      const DualQuaternion<T> blend = DualQuaternion<T>::Dlb(influences, weights[i]);
+      ExpectNear(skinned[i], blend.TransformPoint(positions[i]));
+      ExpectNear(skinnedPositions[i], skinned[i]);
+      ExpectNear(skinnedNormals[i], blend.TransformDirection(normals[i]));
+    }
+
+    ExpectNear(skinned[3], transforms[3].TransformPoint(positions[3]));
+  }
+} // namespace UnitTest
@@ -0,0 +1,585 @@
+#ifndef __MATH__FIXED_HPP__
+#define __MATH__FIXED_HPP__
+
+#include "Common.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace Math::Overflow
+{
+  // Results beyond the range clamp to the nearest bound
+  struct Saturate
+  {};
+
+  // Results beyond the range wrap around modulo 2^(IntBits + FracBits) like two's complement integers
+  struct Wrap
+  {};
+} // namespace Math::Overflow
+
+namespace Math::Detail
+{
+  template<int Bits>
+  using FixedStorage = std::conditional_t<(Bits <= 8),
+                                          std::int8_t,
+                                          std::conditional_t<(Bits <= 16), std::int16_t, std::conditional_t<(Bits <= 32), std::int32_t, std::int64_t>>>;
+
+  // 64 x 64 -> 128 bit unsigned product as high and low words
+  constexpr void MultiplyWide(std::uint64_t a, std::uint64_t b, std::uint64_t& high, std::uint64_t& low)
+  {
+#if defined(__SIZEOF_INT128__)
+    const UInt128 product = static_cast<UInt128>(a) * b;
+    high                  = static_cast<std::uint64_t>(product >> 64u);
+    low                   = static_cast<std::uint64_t>(product);
+#else
+    constexpr std::uint64_t kMask = 0xFFFFFFFFu;
+
+    const std::uint64_t lowLow   = (a & kMask) * (b & kMask);
+    const std::uint64_t lowHigh  = (a & kMask) * (b >> 32u);
+    const std::uint64_t highLow  = (a >> 32u) * (b & kMask);
+    const std::uint64_t highHigh = (a >> 32u) * (b >> 32u);
+    const std::uint64_t middle   = (lowLow >> 32u) + (lowHigh & kMask) + (highLow & kMask);
+
+    high = highHigh + (lowHigh >> 32u) + (highLow >> 32u) + (middle >> 32u);
+    low  = (middle << 32u) | (lowLow & kMask);
+#endif
+  }
+
+  // (high, low) / divisor for high < divisor, the quotient fits 64 bits and the remainder is stored in high
+  constexpr std::uint64_t DivideWide(std::uint64_t& high, std::uint64_t low, std::uint64_t divisor)
+  {
+#if defined(__SIZEOF_INT128__)
+    const UInt128 dividend = (static_cast<UInt128>(high) << 64u) | low;
+    high                   = static_cast<std::uint64_t>(dividend % divisor);
+    return static_cast<std::uint64_t>(dividend / divisor);
+#else
+    // Restoring division, one quotient bit shifted into low per step
+    for(int i = 0; i < 64; i++)
+    {
+      const bool carry = (high >> 63u) != 0u;
+      high             = (high << 1u) | (low >> 63u);
+      low <<= 1u;
+      if(carry || (high >= divisor))
+      {
+        high -= divisor;
+        low |= 1u;
+      }
+    }
+
+    return low;
+#endif
+  }
+
+  // Rounded square root of the 128-bit value (high, low) digit by digit from topPosition, the even index of its top bit pair.
+  // The remainder stays below 4 * root, so the value must be below 2^122.
+  constexpr std::uint64_t SquareRootWide(std::uint64_t high, std::uint64_t low, int topPosition)
+  {
+    std::uint64_t root      = 0u;
+    std::uint64_t remainder = 0u;
+    for(int position = topPosition; position >= 0; position -= 2)
+    {
+      const std::uint64_t pair  = (position >= 64) ? ((high >> (position - 64)) & 3u) : ((low >> position) & 3u);
+      const std::uint64_t trial = (root << 2u) | 1u;
+      remainder                 = (remainder << 2u) | pair;
+      root <<= 1u;
+      if(remainder >= trial)
+      {
+        remainder -= trial;
+        root |= 1u;
+      }
+    }
+
+    // value - root^2 > root means value > (root + 1/2)^2 for integers
+    return (remainder > root) ? (root + 1u) : root;
+  }
+
+  /*
+   * Fixed point transcendental functions evaluate in Q3.60, a signed 64-bit integer with 60 fraction bits, using integer
+   * arithmetic only so their results are bit-identical on every platform.
+   */
+  constexpr int kQ60Bits            = 60;
+  constexpr std::int64_t kQ60One    = std::int64_t(1) << kQ60Bits;
+  constexpr std::int64_t kQ60HalfPi = 1811004864519280711;
+  constexpr std::int64_t kQ60Pi     = 3622009729038561421;
+
+  // Rounds value / 2^shift to nearest, ties away from zero
+  constexpr std::int64_t RoundShift(std::int64_t value, int shift)
+  {
+    if(shift == 0)
+    {
+      return value;
+    }
+
+    const std::uint64_t magnitude = (Magnitude(value) + (std::uint64_t(1) << (shift - 1))) >> shift;
+    return (value < 0) ? -static_cast<std::int64_t>(magnitude) : static_cast<std::int64_t>(magnitude);
+  }
+
+  // Product of two Q3.60 values, which must stay below 8 in magnitude
+  constexpr std::int64_t MultiplyQ60(std::int64_t a, std::int64_t b)
+  {
+    std::uint64_t high = 0u;
+    std::uint64_t low  = 0u;
+    MultiplyWide(Magnitude(a), Magnitude(b), high, low);
+
+    constexpr std::uint64_t kHalf = std::uint64_t(1) << (kQ60Bits - 1);
+    low += kHalf;
+    high += (low < kHalf) ? 1u : 0u;
+
+    const std::int64_t magnitude = static_cast<std::int64_t>((high << (64 - kQ60Bits)) | (low >> kQ60Bits));
+    return ((a < 0) != (b < 0)) ? -magnitude : magnitude;
+  }
+
+  // Taylor series of sin or cos in Q3.60, accurate for |value| up to 3pi/4
+  constexpr std::int64_t SineCosineQ60(std::int64_t value, bool cosine)
+  {
+    const std::int64_t square = MultiplyQ60(value, value);
+
+    std::int64_t term = cosine ? kQ60One : value;
+    std::int64_t sum  = term;
+    for(std::int64_t n = cosine ? 1 : 2; term != 0; n += 2)
+    {
+      term = MultiplyQ60(term, -square) / (n * (n + 1));
+      sum += term;
+    }
+
+    return sum;
+  }
+
+  // asin(x) = sum (2n)! / (4^n n!^2) x^(2n+1) / (2n+1) in Q3.60 for |value| <= 1/2, one bit of precision per step at worst
+  constexpr std::int64_t ArcSineQ60(std::int64_t value)
+  {
+    const std::int64_t square = MultiplyQ60(value, value);
+
+    std::int64_t power = value;
+    std::int64_t sum   = value;
+    for(std::int64_t n = 0; power != 0; n++)
+    {
+      power = (MultiplyQ60(power, square) / ((2 * n) + 2)) * ((2 * n) + 1);
+      sum += power / ((2 * n) + 3);
+    }
+
+    return sum;
+  }
+
+  // Square root of a non-negative Q3.60 value below 1
+  constexpr std::int64_t SqrtQ60(std::int64_t value)
+  {
+    const std::uint64_t bits = static_cast<std::uint64_t>(value);
+    return static_cast<std::int64_t>(SquareRootWide(bits >> (64 - kQ60Bits), bits << kQ60Bits, 120));
+  }
+} // namespace Math::Detail
+
+/*
+ * Signed fixed point number with IntBits integer bits, sign included, and FracBits fraction bits, stored in the
+ * narrowest integer that holds both, for example Fixed<16, 16> is Q16.16 in an int32_t. Every operation is integer
+ * arithmetic with round to nearest, ties away from zero, so results are bit-identical across compilers and machines.
+ *
+ * Overflow follows the policy: Math::Overflow::Saturate clamps to the range, Math::Overflow::Wrap wraps like two's
+ * complement integers. Conversions from floating point and division by zero always saturate since there is no
+ * meaningful wrapped result.
+ */
+template<int IntBits, int FracBits, class Overflow = Math::Overflow::Saturate>
+class Fixed
+{
+  static_assert((IntBits >= 1) && (FracBits >= 0) && ((IntBits + FracBits) <= 64), "Fixed holds at most 64 bits including the sign");
+  static_assert(std::is_same_v<Overflow, Math::Overflow::Saturate> || std::is_same_v<Overflow, Math::Overflow::Wrap>, "Unknown overflow policy");
+
+  public:
+  using Storage = Math::Detail::FixedStorage<IntBits + FracBits>;
+
+  static constexpr int kIntegerBits  = IntBits;
+  static constexpr int kFractionBits = FracBits;
+  static constexpr int kBits         = IntBits + FracBits;
+
+  static constexpr Fixed Min     = Fixed(std::int64_t(-1) - static_cast<std::int64_t>((std::uint64_t(1) << (kBits - 1)) - 1u), 0);
+  static constexpr Fixed Max     = Fixed(static_cast<std::int64_t>((std::uint64_t(1) << (kBits - 1)) - 1u), 0);
+  static constexpr Fixed Epsilon = Fixed(std::int64_t(1), 0);
+  static constexpr Fixed Zero    = Fixed(std::int64_t(0), 0);
+  static constexpr Fixed One     = Fixed(static_cast<std::int64_t>(std::uint64_t(1) << FracBits), 0);
+
+  static constexpr Fixed FromRaw(Storage raw) { return Fixed(static_cast<std::int64_t>(raw), 0); }
+
+  constexpr Storage GetRaw() const { return m_Raw; }
+
+  constexpr bool operator==(const Fixed& rhs) const { return m_Raw == rhs.m_Raw; }
+
+  constexpr bool operator!=(const Fixed& rhs) const { return m_Raw != rhs.m_Raw; }
+
+  constexpr bool operator<(const Fixed& rhs) const { return m_Raw < rhs.m_Raw; }
+
+  constexpr bool operator<=(const Fixed& rhs) const { return m_Raw <= rhs.m_Raw; }
+
+  constexpr bool operator>(const Fixed& rhs) const { return m_Raw > rhs.m_Raw; }
+
+  constexpr bool operator>=(const Fixed& rhs) const { return m_Raw >= rhs.m_Raw; }
+
+  constexpr Fixed operator+() const { return *this; }
+
+  constexpr Fixed operator-() const { return Zero - (*this); }
+
+  constexpr Fixed operator+(const Fixed& rhs) const
+  {
+    if constexpr(kBits < 64)
+    {
+      return FromWide(static_cast<std::int64_t>(m_Raw) + rhs.m_Raw);
+    }
+    else
+    {
+      // Signed overflow happened when both operands share a sign the wrapped sum does not have
+      const std::uint64_t sum = static_cast<std::uint64_t>(m_Raw) + static_cast<std::uint64_t>(rhs.m_Raw);
+      if constexpr(kSaturate)
+      {
+        if((((static_cast<std::uint64_t>(m_Raw) ^ sum) & (static_cast<std::uint64_t>(rhs.m_Raw) ^ sum)) >> 63u) != 0u)
+        {
+          return (m_Raw < 0) ? Min : Max;
+        }
+      }
+
+      return FromBits(sum);
+    }
+  }
+
+  constexpr Fixed operator-(const Fixed& rhs) const
+  {
+    if constexpr(kBits < 64)
+    {
+      return FromWide(static_cast<std::int64_t>(m_Raw) - rhs.m_Raw);
+    }
+    else
+    {
+      // Signed overflow happened when the operands differ in sign and the wrapped difference lost the sign of lhs
+      const std::uint64_t difference = static_cast<std::uint64_t>(m_Raw) - static_cast<std::uint64_t>(rhs.m_Raw);
+      if constexpr(kSaturate)
+      {
+        if((((static_cast<std::uint64_t>(m_Raw) ^ static_cast<std::uint64_t>(rhs.m_Raw)) & (static_cast<std::uint64_t>(m_Raw) ^ difference)) >> 63u) != 0u)
+        {
+          return (m_Raw < 0) ? Min : Max;
+        }
+      }
+
+      return FromBits(difference);
+    }
+  }
+
+  constexpr Fixed operator*(const Fixed& rhs) const
+  {
+    const bool negative = (m_Raw < 0) != (rhs.m_Raw < 0);
+    if constexpr(kBits <= 32)
+    {
+      const std::uint64_t product = Math::Detail::Magnitude(m_Raw) * Math::Detail::Magnitude(rhs.m_Raw);
+      return FromMagnitude(negative, (product + kHalf) >> FracBits, false);
+    }
+    else
+    {
+      std::uint64_t high = 0u;
+      std::uint64_t low  = 0u;
+      Math::Detail::MultiplyWide(Math::Detail::Magnitude(m_Raw), Math::Detail::Magnitude(rhs.m_Raw), high, low);
+      low += kHalf;
+      high += (low < kHalf) ? 1u : 0u;
+
+      if constexpr(FracBits == 0)
+      {
+        return FromMagnitude(negative, low, high != 0u);
+      }
+      else
+      {
+        return FromMagnitude(negative, (high << (64 - FracBits)) | (low >> FracBits), (high >> FracBits) != 0u);
+      }
+    }
+  }
+
+  constexpr Fixed operator/(const Fixed& rhs) const
+  {
+    if(rhs.m_Raw == 0)
+    {
+      return (m_Raw < 0) ? Min : ((m_Raw > 0) ? Max : Zero);
+    }
+
+    const bool negative       = (m_Raw < 0) != (rhs.m_Raw < 0);
+    const std::uint64_t lhs   = Math::Detail::Magnitude(m_Raw);
+    const std::uint64_t other = Math::Detail::Magnitude(rhs.m_Raw);
+    if constexpr(kBits <= 32)
+    {
+      const std::uint64_t dividend  = lhs << FracBits;
+      const std::uint64_t quotient  = dividend / other;
+      const std::uint64_t remainder = dividend % other;
+      return FromMagnitude(negative, quotient + ((remainder >= (other - remainder)) ? 1u : 0u), false);
+    }
+    else
+    {
+      // Long division of lhs << FracBits in two 64-bit steps, the first one only decides whether the quotient overflows
+      std::uint64_t high           = (FracBits == 0) ? 0u : (lhs >> ((64 - FracBits) % 64));
+      const std::uint64_t low      = lhs << FracBits;
+      const bool overflow          = high >= other;
+      high                         = high % other;
+      std::uint64_t quotient       = Math::Detail::DivideWide(high, low, other);
+      const std::uint64_t rounding = (high >= (other - high)) ? 1u : 0u;
+      quotient += rounding;
+      return FromMagnitude(negative, quotient, overflow || ((rounding != 0u) && (quotient == 0u)));
+    }
+  }
+
+  constexpr Fixed& operator+=(const Fixed& rhs) { return (*this) = (*this) + rhs; }
+
+  constexpr Fixed& operator-=(const Fixed& rhs) { return (*this) = (*this) - rhs; }
+
+  constexpr Fixed& operator*=(const Fixed& rhs) { return (*this) = (*this) * rhs; }
+
+  constexpr Fixed& operator/=(const Fixed& rhs) { return (*this) = (*this) / rhs; }
+
+  // Integer part rounded towards zero for integral types, the exact value rounded once for floating point types
+  template<class U, std::enable_if_t<std::is_arithmetic_v<U>, bool> = true>
+  constexpr explicit operator U() const
+  {
+    if constexpr(std::is_floating_point_v<U>)
+    {
+      return static_cast<U>(m_Raw) / static_cast<U>(std::uint64_t(1) << FracBits);
+    }
+    else
+    {
+      const std::int64_t integer = static_cast<std::int64_t>(Math::Detail::Magnitude(m_Raw) >> FracBits);
+      return static_cast<U>((m_Raw < 0) ? -integer : integer);
+    }
+  }
+
+  template<class U, std::enable_if_t<std::is_integral_v<U>, bool> = true>
+  constexpr explicit Fixed(U value)
+      : m_Raw(0)
+  {
+    constexpr std::int64_t kMaxInteger = static_cast<std::int64_t>(((std::uint64_t(1) << (kBits - 1)) - 1u) >> FracBits);
+    constexpr std::int64_t kMinInteger = -1 - kMaxInteger;
+
+    if constexpr(std::is_unsigned_v<U>)
+    {
+      const std::uint64_t integer = static_cast<std::uint64_t>(value);
+      (*this)                     = (kSaturate && (integer > static_cast<std::uint64_t>(kMaxInteger))) ? Max : FromBits(integer << FracBits);
+    }
+    else
+    {
+      const std::int64_t integer = static_cast<std::int64_t>(value);
+      if(kSaturate && ((integer > kMaxInteger) || (integer < kMinInteger)))
+      {
+        (*this) = (integer < 0) ? Min : Max;
+      }
+      else
+      {
+        (*this) = FromBits(static_cast<std::uint64_t>(integer) << FracBits);
+      }
+    }
+  }
+
+  template<class U, std::enable_if_t<std::is_floating_point_v<U>, bool> = true>
+  constexpr explicit Fixed(U value)
+      : m_Raw(0)
+  {
+    // Scaling by a power of two is exact, the one rounding step below is done on the integer and fraction parts
+    constexpr U kLimit = static_cast<U>(std::uint64_t(1) << (kBits - 1));
+    const U scaled     = value * static_cast<U>(std::uint64_t(1) << FracBits);
+    if(!(scaled == scaled))
+    {
+      return;
+    }
+
+    if(scaled >= kLimit)
+    {
+      (*this) = Max;
+    }
+    else if(scaled < -kLimit)
+    {
+      (*this) = Min;
+    }
+    else
+    {
+      const std::int64_t integer = static_cast<std::int64_t>(scaled);
+      const U fraction           = scaled - static_cast<U>(integer);
+      const std::int64_t rounded = integer + ((fraction >= static_cast<U>(0.5)) ? 1 : ((fraction <= static_cast<U>(-0.5)) ? -1 : 0));
+      (*this)                    = FromWide(rounded);
+    }
+  }
+
+  constexpr Fixed()
+      : m_Raw(0)
+  {}
+
+  private:
+  static constexpr bool kSaturate      = std::is_same_v<Overflow, Math::Overflow::Saturate>;
+  static constexpr std::uint64_t kHalf = (FracBits == 0) ? 0u : (std::uint64_t(1) << ((FracBits - 1) % 64));
+
+  constexpr Fixed(std::int64_t raw, int)
+      : m_Raw(static_cast<Storage>(raw))
+  {}
+
+  // Two's complement bits whose low kBits bits are the result, sign extended from bit kBits - 1
+  static constexpr Fixed FromBits(std::uint64_t bits)
+  {
+    constexpr std::uint64_t kSign = std::uint64_t(1) << (kBits - 1);
+    constexpr std::uint64_t kMask = (kBits == 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << (kBits % 64)) - 1u);
+    return Fixed(static_cast<std::int64_t>(((bits & kMask) ^ kSign) - kSign), 0);
+  }
+
+  // Result with the given sign and magnitude, overflow is set when the magnitude itself did not fit 64 bits
+  static constexpr Fixed FromMagnitude(bool negative, std::uint64_t magnitude, bool overflow)
+  {
+    constexpr std::uint64_t kLimit = std::uint64_t(1) << (kBits - 1);
+    if constexpr(kSaturate)
+    {
+      if(overflow || (magnitude > (negative ? kLimit : (kLimit - 1u))))
+      {
+        return negative ? Min : Max;
+      }
+    }
+
+    return FromBits(negative ? (0u - magnitude) : magnitude);
+  }
+
+  static constexpr Fixed FromWide(std::int64_t value) { return FromMagnitude(value < 0, Math::Detail::Magnitude(value), false); }
+
+  Storage m_Raw;
+};
+
+namespace Math::Detail
+{
+  template<class Type>
+  constexpr Type FromQ60(std::int64_t value)
+  {
+    const std::int64_t raw = RoundShift(value, kQ60Bits - Type::kFractionBits);
+    return (raw > static_cast<std::int64_t>(Type::Max.GetRaw())) ? Type::Max : Type::FromRaw(static_cast<typename Type::Storage>(raw));
+  }
+
+  template<class Type>
+  constexpr Type FixedSineCosine(Type value, bool cosine)
+  {
+    static_assert(Type::kFractionBits <= kQ60Bits, "Sin and Cos support at most 60 fraction bits");
+
+    constexpr int kShift            = kQ60Bits - Type::kFractionBits;
+    constexpr std::int64_t kQuarter = RoundShift(kQ60HalfPi, kShift);
+
+    // The quadrant only needs to be close, the remainder is computed to 60 bits in wrapping arithmetic since it is small
+    const std::int64_t raw      = value.GetRaw();
+    const bool roundAway        = (2u * Magnitude(raw % kQuarter)) >= static_cast<std::uint64_t>(kQuarter);
+    const std::int64_t quotient = (raw / kQuarter) + (roundAway ? ((raw < 0) ? -1 : 1) : 0);
+    const std::uint64_t nearest = static_cast<std::uint64_t>(quotient) * static_cast<std::uint64_t>(kQ60HalfPi);
+    const std::int64_t reduced  = static_cast<std::int64_t>((static_cast<std::uint64_t>(raw) << kShift) - nearest);
+    const std::int64_t quadrant = (((quotient % 4) + 4) + (cosine ? 1 : 0)) % 4;
+
+    const std::int64_t result = SineCosineQ60(reduced, (quadrant % 2) != 0);
+    return FromQ60<Type>((quadrant >= 2) ? -result : result);
+  }
+} // namespace Math::Detail
+
+namespace Math
+{
+  // Correctly rounded square root, negative values have none and give zero
+  template<int IntBits, int FracBits, class Overflow>
+  constexpr Fixed<IntBits, FracBits, Overflow> Sqrt(Fixed<IntBits, FracBits, Overflow> value)
+  {
+    using Type = Fixed<IntBits, FracBits, Overflow>;
+
+    // root(raw / 2^F) * 2^F == root(raw << F), whose radicand must stay below 2^122
+    constexpr int kRadicandBits = Type::kBits - 1 + FracBits;
+    static_assert(kRadicandBits <= 122, "Too many bits for the fixed point square root");
+
+    if(value.GetRaw() <= 0)
+    {
+      return Type::Zero;
+    }
+
+    const std::uint64_t raw  = static_cast<std::uint64_t>(value.GetRaw());
+    const std::uint64_t high = (FracBits == 0) ? 0u : (raw >> ((64 - FracBits) % 64));
+    const std::uint64_t root = Detail::SquareRootWide(high, raw << FracBits, (kRadicandBits - 1) & ~1);
+
+    // Roots of values below one approach one, which Fixed<1, F> cannot hold
+    return (root > static_cast<std::uint64_t>(Type::Max.GetRaw())) ? Type::Max : Type::FromRaw(static_cast<typename Type::Storage>(root));
+  }
+
+  /*
+   * Sine and cosine without floating point. The argument is reduced by the nearest quarter turn with pi/2 to 60 bits,
+   * so the error stays within an ulp or two of the format for arguments up to thousands of turns.
+   */
+  template<int IntBits, int FracBits, class Overflow>
+  constexpr Fixed<IntBits, FracBits, Overflow> Sin(Fixed<IntBits, FracBits, Overflow> value)
+  {
+    return Detail::FixedSineCosine(value, false);
+  }
+
+  template<int IntBits, int FracBits, class Overflow>
+  constexpr Fixed<IntBits, FracBits, Overflow> Cos(Fixed<IntBits, FracBits, Overflow> value)
+  {
+    return Detail::FixedSineCosine(value, true);
+  }
+
+  // Arc cosine without floating point, arguments outside [-1, 1] are clamped
+  template<int IntBits, int FracBits, class Overflow>
+  constexpr Fixed<IntBits, FracBits, Overflow> Acos(Fixed<IntBits, FracBits, Overflow> value)
+  {
+    using Type = Fixed<IntBits, FracBits, Overflow>;
+    static_assert(FracBits <= Detail::kQ60Bits, "Acos supports at most 60 fraction bits");
+
+    constexpr std::int64_t kOne  = std::int64_t(1) << FracBits;
+    constexpr std::int64_t kHalf = Detail::kQ60One / 2;
+
+    const std::int64_t raw = value.GetRaw();
+    std::int64_t angle     = 0;
+    if(raw <= -kOne)
+    {
+      angle = Detail::kQ60Pi;
+    }
+    else if(raw < kOne)
+    {
+      // Beyond +-1/2 the series converges slowly, acos(x) = 2 asin(sqrt((1 - x) / 2)) keeps its argument small
+      const std::int64_t x = raw * (std::int64_t(1) << (Detail::kQ60Bits - FracBits));
+      if(x > kHalf)
+      {
+        angle = 2 * Detail::ArcSineQ60(Detail::SqrtQ60((Detail::kQ60One - x) / 2));
+      }
+      else if(x < -kHalf)
+      {
+        angle = Detail::kQ60Pi - (2 * Detail::ArcSineQ60(Detail::SqrtQ60((Detail::kQ60One + x) / 2)));
+      }
+      else
+      {
+        angle = Detail::kQ60HalfPi - Detail::ArcSineQ60(x);
+      }
+    }
+
+    return Detail::FromQ60<Type>(angle);
+  }
+
+  template<int IntBits, int FracBits, class Overflow>
+  struct ScalarFunctions<Fixed<IntBits, FracBits, Overflow>>
+  {
+    using Type = Fixed<IntBits, FracBits, Overflow>;
+
+    static constexpr Type Sqrt(Type value) { return Math::Sqrt(value); }
+    static constexpr Type Sin(Type value) { return Math::Sin(value); }
+    static constexpr Type Cos(Type value) { return Math::Cos(value); }
+    static constexpr Type Acos(Type value) { return Math::Acos(value); }
+  };
+} // namespace Math
+
+// Integer-like limits of the storage type with the range and resolution of the fixed point format
+namespace std
+{
+  template<int IntBits, int FracBits, class Overflow>
+  class numeric_limits<Fixed<IntBits, FracBits, Overflow>> : public numeric_limits<typename Fixed<IntBits, FracBits, Overflow>::Storage>
+  {
+    using Type = Fixed<IntBits, FracBits, Overflow>;
+
+    public:
+    static constexpr bool is_integer = false;
+    static constexpr bool is_modulo  = std::is_same_v<Overflow, Math::Overflow::Wrap>;
+    static constexpr int digits      = Type::kBits - 1;
+    static constexpr int digits10    = ((Type::kBits - 1) * 301) / 1000;
+
+    static constexpr Type min() noexcept { return Type::Min; }
+    static constexpr Type max() noexcept { return Type::Max; }
+    static constexpr Type lowest() noexcept { return Type::Min; }
+    static constexpr Type epsilon() noexcept { return Type::Epsilon; }
+
+    // Rounding is to nearest, but half an ulp has no representation
+    static constexpr Type round_error() noexcept { return Type::Epsilon; }
+  };
+} // namespace std
+
+#endif // __MATH__FIXED_HPP__
@@ -0,0 +1,166 @@
+#include "Fixed.hpp"
+#include "Quaternion.hpp"
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  using Q16 = Fixed<16, 16>;
+  using Q32 = Fixed<32, 32>;
+
+  template<class T>
+  class FixedTyped : public Test
+  {};
+
+  using FixedTypes = Types<Q16, Q32, Fixed<16, 16, Math::Overflow::Wrap>, Fixed<8, 8>>;
+  TYPED_TEST_SUITE(FixedTyped, FixedTypes);
+
+  TYPED_TEST(FixedTyped, Arithmetic)
+  {
+    using T = TypeParam;
+
+    const T a(3.25);
+    const T b(-1.5);
+    ASSERT_EQ(static_cast<double>(a + b), 1.75);
+    ASSERT_EQ(static_cast<double>(a - b), 4.75);
+    ASSERT_EQ(static_cast<double>(a * b), -4.875);
+    ASSERT_EQ(static_cast<double>(b / T(4)), -0.375);
+    ASSERT_EQ(static_cast<double>(-a), -3.25);
+    ASSERT_EQ(static_cast<int>(a), 3);
+    ASSERT_EQ(static_cast<int>(b), -1);
+    ASSERT_TRUE((b < a) && (a > b) && (a != b) && (a == T(13) / T(4)));
+
+    // Products and quotients round to nearest, ties away from zero
+    const T ulp = T::Epsilon;
+    ASSERT_EQ((ulp * T(0.5)).GetRaw(), 1);
+    ASSERT_EQ((-ulp * T(0.5)).GetRaw(), -1);
+    ASSERT_EQ((ulp * T(0.25)).GetRaw(), 0);
+    ASSERT_EQ((T(1) / T(3)).GetRaw(), static_cast<typename T::Storage>(std::llround(std::ldexp(1.0 / 3.0, T::kFractionBits))));
+    ASSERT_EQ((T(-2) / T(3)).GetRaw(), static_cast<typename T::Storage>(std::llround(std::ldexp(-2.0 / 3.0, T::kFractionBits))));
+
+    // Every operation also runs in constant evaluation
+    constexpr T kProduct = (T(1.5) * T(2.5)) - (T(1) / T(8));
+    static_assert(kProduct == T(3.625));
+  }
+
+  TEST(Fixed, Overflow)
+  {
+    using Wrap16 = Fixed<16, 16, Math::Overflow::Wrap>;
+    using Wrap32 = Fixed<32, 32, Math::Overflow::Wrap>;
+
+    ASSERT_EQ(Q16::Max + Q16::Epsilon, Q16::Max);
+    ASSERT_EQ(Q16::Min - Q16::Epsilon, Q16::Min);
+    ASSERT_EQ(-Q16::Min, Q16::Max);
+    ASSERT_EQ(Q16(300) * Q16(300), Q16::Max);
+    ASSERT_EQ(Q16(-300) * Q16(300), Q16::Min);
+    ASSERT_EQ(Q16(30000) / Q16(0.5), Q16::Max);
+    ASSERT_EQ(Q16(1) / Q16(), Q16::Max);
+    ASSERT_EQ(Q16(-1) / Q16(), Q16::Min);
+    ASSERT_EQ(Q16(40000), Q16::Max);
+    ASSERT_EQ(Q16(-1e9), Q16::Min);
+
+    ASSERT_EQ(Wrap16::Max + Wrap16::Epsilon, Wrap16::Min);
+    ASSERT_EQ(-Wrap16::Min, Wrap16::Min);
+    ASSERT_EQ(static_cast<int>(Wrap16(300) * Wrap16(300)), 90000 - 65536);
+    ASSERT_EQ(static_cast<int>(Wrap16(40000)), 40000 - 65536);
+
+    ASSERT_EQ(Q32::Max + Q32::Epsilon, Q32::Max);
+    ASSERT_EQ(Q32::Min - Q32::Epsilon, Q32::Min);
+    ASSERT_EQ(Q32(70000) * Q32(70000), Q32::Max);
+    ASSERT_EQ(Q32(70000) * Q32(-70000), Q32::Min);
+    ASSERT_EQ(Q32(2000000000) / Q32(0.25), Q32::Max);
+    ASSERT_EQ(Wrap32::Max + Wrap32::Epsilon, Wrap32::Min);
+    ASSERT_EQ(static_cast<std::int64_t>(Wrap32(70000) * Wrap32(70000)), std::int64_t(4900000000) - (std::int64_t(1) << 32));
+    ASSERT_EQ(static_cast<std::int64_t>(Wrap32(-70000) * Wrap32(70000)), (std::int64_t(1) << 32) - std::int64_t(4900000000));
+
+    ASSERT_EQ(static_cast<double>(Q32(123456.5) * Q32(-0.25)), -30864.125);
+    ASSERT_EQ(static_cast<double>(Q32(-123456.5) / Q32(0.25)), -493826.0);
+  }
+
+  TYPED_TEST(FixedTyped, Sqrt)
+  {
+    using T = TypeParam;
+
+    constexpr T kRoot = Math::Sqrt(T(6.25));
+    static_assert(kRoot == T(2.5));
+    ASSERT_EQ(Math::Sqrt(T(-4)), T());
+    ASSERT_EQ(Math::Sqrt(T()), T());
+
+    const double resolution = std::ldexp(1.0, -T::kFractionBits);
+    const double largest    = static_cast<double>(T::Max);
+    for(double value = resolution; value < largest; value *= 1.37)
+    {
+      const T root = Math::Sqrt(T(value));
+      ASSERT_LE(std::fabs(static_cast<double>(root) - std::sqrt(static_cast<double>(T(value)))), resolution / 2.0);
+    }
+  }
+
+  TYPED_TEST(FixedTyped, Trigonometry)
+  {
+    using T = TypeParam;
+
+    // Within a few ulp of the format, plus the resolution of the argument scaled by the slope
+    const double resolution = std::ldexp(1.0, -T::kFractionBits);
+    const double tolerance  = 3.0 * resolution;
+    for(double angle = -100.0; angle < 100.0; angle += 0.37)
+    {
+      const T value       = T(angle);
+      const double actual = static_cast<double>(value);
+      ASSERT_NEAR(static_cast<double>(Math::Sin(value)), std::sin(actual), tolerance);
+      ASSERT_NEAR(static_cast<double>(Math::Cos(value)), std::cos(actual), tolerance);
+    }
+
+    for(double ratio = -1.0; ratio <= 1.0; ratio += 1.0 / 64.0)
+    {
+      ASSERT_NEAR(static_cast<double>(Math::Acos(T(ratio))), std::acos(ratio), tolerance);
+    }
+
+    ASSERT_EQ(static_cast<double>(Math::Acos(T(2))), 0.0);
+    static_assert(Math::Sin(T()) == T());
+    static_assert(Math::Cos(T()) == T(1));
+  }
+
+  TEST(Fixed, Limits)
+  {
+    static_assert(std::numeric_limits<Q16>::is_specialized && std::numeric_limits<Q16>::is_signed);
+    static_assert(!std::numeric_limits<Q16>::is_integer && !std::numeric_limits<Q16>::is_modulo);
+    static_assert(std::numeric_limits<Fixed<16, 16, Math::Overflow::Wrap>>::is_modulo);
+    static_assert(std::numeric_limits<Q32>::max().GetRaw() == std::numeric_limits<std::int64_t>::max());
+    static_assert(std::numeric_limits<Fixed<12, 4>>::max().GetRaw() == 32767);
+    static_assert(std::numeric_limits<Fixed<10, 4>>::min().GetRaw() == -8192);
+    static_assert(Math::kSignedScalar<Q16> && Math::kSignedScalar<float> && !Math::kSignedScalar<unsigned int>);
+
+    // Narrower formats than their storage wrap and saturate at their own width
+    ASSERT_EQ(static_cast<int>(Fixed<10, 4, Math::Overflow::Wrap>(512)), -512);
+    ASSERT_EQ((Fixed<10, 4>(512)), (Fixed<10, 4>::Max));
+  }
+
+  TEST(Fixed, Vector)
+  {
+    const Vector3<Q16> a(Q16(3), Q16(4), Q16(12));
+    ASSERT_EQ(a.GetMagnitude(), Q16(13));
+    ASSERT_EQ(Vector3<Q16>::DotProduct(a, Vector3<Q16>::One), Q16(19));
+    ASSERT_TRUE(Vector3<Q16>::CrossProduct(Vector3<Q16>::Right, Vector3<Q16>::Up) == Vector3<Q16>::Forward);
+    ASSERT_NEAR(static_cast<double>(a.ToNormalized().GetMagnitude()), 1.0, 4.0 / 65536.0);
+
+    constexpr Vector2<Q32> kPlanar = Vector2<Q32>(Q32(-6), Q32(8)).ToNormalized();
+    static_assert(kPlanar == Vector2<Q32>(Q32(-0.6), Q32(0.8)));
+
+    const Quaternion<Q32> rotation = Quaternion<Q32>::FromAxisAngle(Vector3<Q32>::Forward, Q32(1.5707963267948966));
+    const Vector3<Q32> up          = rotation.Rotate(Vector3<Q32>::Right);
+    ASSERT_NEAR(static_cast<double>(up.GetX()), 0.0, 1e-8);
+    ASSERT_NEAR(static_cast<double>(up.GetY()), 1.0, 1e-8);
+
+    const Quaternion<Q32> half = Quaternion<Q32>::Slerp(Quaternion<Q32>::Identity, rotation, Q32(0.5));
+    ASSERT_NEAR(static_cast<double>(half.GetW()), std::cos(0.3926990816987241), 1e-8);
+    ASSERT_NEAR(static_cast<double>(half.GetZ()), std::sin(0.3926990816987241), 1e-8);
+  }
+} // namespace UnitTest
@@ -0,0 +1,100 @@
+#ifndef __MATH__FRUSTUM_HPP__
+#define __MATH__FRUSTUM_HPP__
+
+#include "AABB.hpp"
+#include "Matrix4.hpp"
+#include "Plane.hpp"
+#include "Sphere.hpp"
+#include "Vector3.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+// Convex volume bounded by six normalized planes facing inwards
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class Frustum
+{
+  public:
+  static constexpr std::size_t kLeft   = 0u;
+  static constexpr std::size_t kRight  = 1u;
+  static constexpr std::size_t kBottom = 2u;
+  static constexpr std::size_t kTop    = 3u;
+  static constexpr std::size_t kNear   = 4u;
+  static constexpr std::size_t kFar    = 5u;
+
+  // Planes of a view-projection matrix mapping the view volume to the clip cube -w <= x, y, z <= w
+  static Frustum<T> FromMatrix(const Matrix4<T>& viewProjection)
+  {
+    const auto row = [&](std::size_t index, T sign)
+    {
+      const Vector3<T> normal(viewProjection.Get(3u, 0u) + (sign * viewProjection.Get(index, 0u)),
+                              viewProjection.Get(3u, 1u) + (sign * viewProjection.Get(index, 1u)),
+                              viewProjection.Get(3u, 2u) + (sign * viewProjection.Get(index, 2u)));
+      return Plane<T>(normal, viewProjection.Get(3u, 3u) + (sign * viewProjection.Get(index, 3u))).ToNormalized();
+    };
+
+    constexpr T kOne = static_cast<T>(1);
+    return Frustum<T>({row(0u, kOne), row(0u, -kOne), row(1u, kOne), row(1u, -kOne), row(2u, kOne), row(2u, -kOne)});
+  }
+
+  bool Contains(const Vector3<T>& point) const
+  {
+    for(const Plane<T>& plane : m_Planes)
+    {
+      if(plane.GetDistance(point) < static_cast<T>(0))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  template<class Volume>
+  Math::Containment Classify(const Volume& volume) const
+  {
+    Math::Containment result = Math::Containment::Inside;
+    for(const Plane<T>& plane : m_Planes)
+    {
+      const Math::Containment side = volume.Classify(plane);
+      if(side == Math::Containment::Outside)
+      {
+        return side;
+      }
+
+      result = (side == Math::Containment::Intersecting) ? side : result;
+    }
+
+    return result;
+  }
+
+  // Conservative like every plane-by-plane test: a volume near an edge, outside but behind no single plane, is kept
+  template<class Volume>
+  bool Intersects(const Volume& volume) const
+  {
+    for(const Plane<T>& plane : m_Planes)
+    {
+      if(volume.Classify(plane) == Math::Containment::Outside)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  const Plane<T>& GetPlane(std::size_t index) const { return m_Planes[index]; }
+  const std::array<Plane<T>, 6u>& GetPlanes() const { return m_Planes; }
+
+  explicit Frustum(const std::array<Plane<T>, 6u>& planes)
+      : m_Planes(planes)
+  {}
+
+  Frustum() = default;
+
+  private:
+  std::array<Plane<T>, 6u> m_Planes;
+};
+
+#endif // __MATH__FRUSTUM_HPP__
@@ -0,0 +1,79 @@
+#include "AABB.hpp"
+#include "Frustum.hpp"
+#include "Matrix4.hpp"
+#include "Sphere.hpp"
+#include "Vector3.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class FrustumTyped : public Test
+  {};
+
+  using FrustumTypes = Types<float, double>;
+  TYPED_TEST_SUITE(FrustumTyped, FrustumTypes);
+
+  // Right-handed perspective looking down -z, 90 degrees wide and high, near 1 and far 100
+  template<class T>
+  static Frustum<T> CreatePerspective()
+  {
+    constexpr T kNear = static_cast<T>(1);
+    constexpr T kFar  = static_cast<T>(100);
+
+    Matrix4<T> projection;
+    projection.Set(0u, 0u, static_cast<T>(1));
+    projection.Set(1u, 1u, static_cast<T>(1));
+    projection.Set(2u, 2u, -(kFar + kNear) / (kFar - kNear));
+    projection.Set(2u, 3u, -(static_cast<T>(2) * kFar * kNear) / (kFar - kNear));
+    projection.Set(3u, 2u, static_cast<T>(-1));
+    return Frustum<T>::FromMatrix(projection);
+  }
+
+  template<class T>
+  static Vector3<T> Make(double x, double y, double z)
+  {
+    return Vector3<T>(static_cast<T>(x), static_cast<T>(y), static_cast<T>(z));
+  }
+
+  TYPED_TEST(FrustumTyped, FromMatrix)
+  {
+    using T = TypeParam;
+
+    const Frustum<T> frustum = CreatePerspective<T>();
+    ASSERT_NEAR(frustum.GetPlane(Frustum<T>::kNear).GetDistance(Make<T>(0, 0, -3)), static_cast<T>(2), static_cast<T>(1e-5));
+    ASSERT_NEAR(frustum.GetPlane(Frustum<T>::kFar).GetDistance(Make<T>(0, 0, -3)), static_cast<T>(97), static_cast<T>(1e-3));
+    for(const Plane<T>& plane : frustum.GetPlanes())
+    {
+      ASSERT_NEAR(plane.GetNormal().GetMagnitude(), static_cast<T>(1), static_cast<T>(1e-6));
+    }
+
+    ASSERT_TRUE(frustum.Contains(Make<T>(0, 0, -10)));
+    ASSERT_TRUE(frustum.Contains(Make<T>(9, -9, -10)));
+    ASSERT_FALSE(frustum.Contains(Make<T>(11, 0, -10)));
+    ASSERT_FALSE(frustum.Contains(Make<T>(0, 0, 10)));
+    ASSERT_FALSE(frustum.Contains(Make<T>(0, 0, -0.5)));
+    ASSERT_FALSE(frustum.Contains(Make<T>(0, 0, -101)));
+  }
+
+  TYPED_TEST(FrustumTyped, Classify)
+  {
+    using T = TypeParam;
+
+    const Frustum<T> frustum = CreatePerspective<T>();
+
+    ASSERT_EQ(frustum.Classify(Sphere<T>(Make<T>(0, 0, -50), static_cast<T>(5))), Math::Containment::Inside);
+    ASSERT_EQ(frustum.Classify(Sphere<T>(Make<T>(0, 0, -100), static_cast<T>(5))), Math::Containment::Intersecting);
+    ASSERT_EQ(frustum.Classify(Sphere<T>(Make<T>(30, 0, -10), static_cast<T>(5))), Math::Containment::Outside);
+
+    ASSERT_EQ(frustum.Classify(AABB<T>(Make<T>(-1, -1, -20), Make<T>(1, 1, -10))), Math::Containment::Inside);
+    ASSERT_EQ(frustum.Classify(AABB<T>(Make<T>(-1, -1, -20), Make<T>(15, 1, -10))), Math::Containment::Intersecting);
+    ASSERT_EQ(frustum.Classify(AABB<T>(Make<T>(-1, -1, 1), Make<T>(1, 1, 2))), Math::Containment::Outside);
+
+    ASSERT_TRUE(frustum.Intersects(Sphere<T>(Make<T>(0, 0, -100), static_cast<T>(5))));
+    ASSERT_FALSE(frustum.Intersects(AABB<T>(Make<T>(20, 20, -2), Make<T>(30, 30, -1))));
+  }
+} // namespace UnitTest
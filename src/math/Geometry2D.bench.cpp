@@ -0,0 +1,119 @@
+#include "Benchmark.hpp"
+#include "Geometry2D.hpp"
+#include "Vector2.hpp"
+#include "Vector2Array.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Benchmark
+{
+  // Points scattered over (-100, 100)^2
+  template<class T>
+  static std::vector<Vector2<T>> CreatePlanarPoints(std::size_t count)
+  {
+    std::uint32_t state   = 12345u;
+    const auto coordinate = [&]()
+    {
+      state = (state * 1664525u) + 1013904223u;
+      return static_cast<T>((static_cast<double>(state >> 8u) / 83886.08) - 100.0);
+    };
+
+    std::vector<Vector2<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T x = coordinate();
+      result.push_back(Vector2<T>(x, coordinate()));
+    }
+
+    return result;
+  }
+
+  // A 256 vertex fence with a wavy outline, its bounds cover about a third of the points
+  template<class T>
+  static std::vector<Vector2<T>> CreateFence()
+  {
+    std::vector<Vector2<T>> result;
+    for(std::size_t i = 0u; i < 256u; i++)
+    {
+      const double angle  = static_cast<double>(i) * (2.0 * 3.14159265358979323846 / 256.0);
+      const double radius = 50.0 + (10.0 * std::sin(angle * 7.0));
+      result.push_back(Vector2<T>(static_cast<T>(radius * std::cos(angle)), static_cast<T>(radius * std::sin(angle))));
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static bool RegisterGeometry2D()
+  {
+    using V = Vector2<T>;
+
+    RegisterBatch(Name<T>("Geometry2D_InsidePolygonScalar"),
+                  [](std::size_t count)
+                  {
+                    return [points = CreatePlanarPoints<T>(count), fence = CreateFence<T>(), inside = std::vector<std::size_t>()]() mutable
+                    {
+                      inside.clear();
+                      for(std::size_t i = 0u; i < points.size(); i++)
+                      {
+                        if(Math::IsInsidePolygon(points[i], Math::Span<const V>(fence)))
+                        {
+                          inside.push_back(i);
+                        }
+                      }
+
+                      benchmark::DoNotOptimize(inside.data());
+                    };
+                  });
+    RegisterBatch(Name<T>("Geometry2D_InsidePolygonBatch"),
+                  [](std::size_t count)
+                  {
+                    const std::vector<V> points = CreatePlanarPoints<T>(count);
+                    return [array = Vector2Array<T>(Math::Span<const V>(points)), fence = CreateFence<T>(), inside = std::vector<std::size_t>()]() mutable
+                    {
+                      Math::Batch::IsInsidePolygon(Math::Span<const V>(fence), array, inside);
+                      benchmark::DoNotOptimize(inside.data());
+                    };
+                  });
+    RegisterBatch(Name<T>("Geometry2D_OrientationBatch"),
+                  [](std::size_t count)
+                  {
+                    const std::vector<V> points = CreatePlanarPoints<T>(count);
+                    return [array = Vector2Array<T>(Math::Span<const V>(points)), out = std::vector<T>(count)]() mutable
+                    { Math::Batch::Orientation(V::Zero, V::One, array, Math::Span<T>(out)); };
+                  });
+    RegisterBatch(Name<T>("Geometry2D_RobustOrientationScalar"),
+                  [](std::size_t count)
+                  {
+                    return [points = CreatePlanarPoints<T>(count), out = std::vector<T>(count)]() mutable
+                    {
+                      for(std::size_t i = 0u; i < points.size(); i++)
+                      {
+                        out[i] = Math::RobustOrientation(V::Zero, V::One, points[i]);
+                      }
+                    };
+                  });
+    RegisterBatch(Name<T>("Geometry2D_RobustOrientationBatch"),
+                  [](std::size_t count)
+                  {
+                    const std::vector<V> points = CreatePlanarPoints<T>(count);
+                    return [array = Vector2Array<T>(Math::Span<const V>(points)), out = std::vector<T>(count)]() mutable
+                    { Math::Batch::RobustOrientation(V::Zero, V::One, array, Math::Span<T>(out)); };
+                  });
+    RegisterBatch(Name<T>("Geometry2D_ConvexHull"),
+                  [](std::size_t count)
+                  {
+                    return [source = CreatePlanarPoints<T>(count), points = std::vector<V>(count), hull = std::vector<V>(count + 1u)]() mutable
+                    {
+                      points = source;
+                      benchmark::DoNotOptimize(Math::ConvexHull(Math::Span<V>(points), Math::Span<V>(hull)));
+                    };
+                  });
+    return true;
+  }
+
+  static const bool kGeometry2DRegistered = RegisterGeometry2D<float>() && RegisterGeometry2D<double>();
+} // namespace Benchmark
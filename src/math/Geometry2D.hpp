@@ -0,0 +1,376 @@
+#ifndef __MATH__GEOMETRY2D_HPP__
+#define __MATH__GEOMETRY2D_HPP__
+
+#include "Simd.hpp"
+#include "Span.hpp"
+#include "Vector2.hpp"
+#include "Vector2Array.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Planar predicates and kernels on Vector2
+ *
+ * Orientation(a, b, c) is twice the signed area of the triangle abc: positive when the points turn counter-clockwise,
+ * negative when they turn clockwise and zero when they are collinear. Rounding makes its sign unreliable for nearly
+ * collinear points. RobustOrientation keeps the rounded value when a forward error bound proves its sign and otherwise
+ * evaluates the determinant exactly as a floating point expansion, after J. R. Shewchuk, "Adaptive Precision
+ * Floating-Point Arithmetic and Fast Robust Geometric Predicates". The exact stage assumes the products neither
+ * overflow nor underflow. Polygon tests and the convex hull decide every turn through RobustOrientation.
+ */
+
+namespace Math::Detail
+{
+  // a + b == sum + error exactly
+  template<class T>
+  void TwoSum(T a, T b, T& sum, T& error)
+  {
+    sum              = a + b;
+    const T virtualB = sum - a;
+    const T virtualA = sum - virtualB;
+    error            = (a - virtualA) + (b - virtualB);
+  }
+
+  // a * b == product + error exactly, the fused multiply-add rounds only once
+  template<class T>
+  void TwoProduct(T a, T b, T& product, T& error)
+  {
+    product = a * b;
+    error   = std::fma(a, b, -product);
+  }
+
+  // Adds value to a nonoverlapping expansion ordered by increasing magnitude, which grows by one component
+  template<class T>
+  void GrowExpansion(T* expansion, std::size_t& length, T value)
+  {
+    T carry = value;
+    for(std::size_t i = 0u; i < length; i++)
+    {
+      TwoSum(carry, expansion[i], carry, expansion[i]);
+    }
+
+    expansion[length++] = carry;
+  }
+
+  // Relative error bound of the rounded determinant against |left| + |right|, (3 + 16u) u for the unit roundoff u
+  template<class T>
+  static constexpr T kOrientationBound = (static_cast<T>(3) + (static_cast<T>(8) * std::numeric_limits<T>::epsilon()))
+                                         * (std::numeric_limits<T>::epsilon() / static_cast<T>(2));
+
+  // The determinant as the exact sum of its six products. Returns the largest nonzero component of the expansion,
+  // which carries the sign of the exact value
+  template<class T>
+  T ExactOrientation(const Vector2<T>& a, const Vector2<T>& b, const Vector2<T>& c)
+  {
+    const T factors[6][2] = {{a.GetX(), b.GetY()},
+                             {-a.GetX(), c.GetY()},
+                             {-a.GetY(), b.GetX()},
+                             {a.GetY(), c.GetX()},
+                             {b.GetX(), c.GetY()},
+                             {-b.GetY(), c.GetX()}};
+
+    T expansion[12];
+    std::size_t length = 0u;
+    for(const auto& factor : factors)
+    {
+      T product = static_cast<T>(0);
+      T error   = static_cast<T>(0);
+      TwoProduct(factor[0], factor[1], product, error);
+      GrowExpansion(expansion, length, error);
+      GrowExpansion(expansion, length, product);
+    }
+
+    // Cancellation leaves zero components, the largest nonzero one decides
+    while((length > 1u) && (expansion[length - 1u] == static_cast<T>(0)))
+    {
+      length--;
+    }
+
+    return expansion[length - 1u];
+  }
+
+  // Whether the edge a -> b, already known to straddle the horizontal ray from a point towards +x, crosses it. side is
+  // the orientation of (b, point, a), a point on the edge itself does not cross.
+  template<class T>
+  bool CrossesRay(const Vector2<T>& a, const Vector2<T>& b, T side)
+  {
+    return (b.GetY() > a.GetY()) ? (side > static_cast<T>(0)) : (side < static_cast<T>(0));
+  }
+} // namespace Math::Detail
+
+namespace Math
+{
+  // Twice the signed area of abc, as (a - c) x (b - c)
+  template<class T>
+  constexpr T Orientation(const Vector2<T>& a, const Vector2<T>& b, const Vector2<T>& c)
+  {
+    return Vector2<T>::CrossProduct(a - c, b - c);
+  }
+
+  // Orientation with the sign of the exact result for floating point types, other types fall back to Orientation
+  template<class T>
+  T RobustOrientation(const Vector2<T>& a, const Vector2<T>& b, const Vector2<T>& c)
+  {
+    if constexpr(std::is_floating_point_v<T>)
+    {
+      const T left        = (a.GetX() - c.GetX()) * (b.GetY() - c.GetY());
+      const T right       = (a.GetY() - c.GetY()) * (b.GetX() - c.GetX());
+      const T determinant = left - right;
+      if(std::abs(determinant) >= (Detail::kOrientationBound<T> * (std::abs(left) + std::abs(right))))
+      {
+        return determinant;
+      }
+
+      return Detail::ExactOrientation(a, b, c);
+    }
+    else
+    {
+      return Orientation(a, b, c);
+    }
+  }
+
+  // Crossing number test against the polygon through the given vertices, closed implicitly, in either winding and
+  // possibly self intersecting (even-odd rule). Of two polygons sharing an edge, a point on it is inside exactly one.
+  template<class T>
+  bool IsInsidePolygon(const Vector2<T>& point, Math::Span<const Vector2<T>> polygon)
+  {
+    MATH_INSTRUMENT("Geometry2D::IsInsidePolygon");
+
+    bool inside             = false;
+    const std::size_t count = polygon.GetSize();
+    for(std::size_t i = 0u, j = count - 1u; i < count; j = i++)
+    {
+      const Vector2<T>& a = polygon[j];
+      const Vector2<T>& b = polygon[i];
+      if((a.GetY() > point.GetY()) != (b.GetY() > point.GetY()))
+      {
+        inside = inside != Detail::CrossesRay(a, b, RobustOrientation(b, point, a));
+      }
+    }
+
+    return inside;
+  }
+
+  // Convex hull by Andrew's monotone chain, counter-clockwise from the lowest x (then y) vertex and without collinear
+  // vertices. Sorts points in place, leaving the distinct ones at the front and the rest unspecified, and allocates
+  // nothing. hull needs room for one more vertex than there are points, returns the number written to its front.
+  template<class T>
+  std::size_t ConvexHull(Math::Span<Vector2<T>> points, Math::Span<Vector2<T>> hull)
+  {
+    MATH_INSTRUMENT_BATCH("Geometry2D::ConvexHull", points.GetSize());
+
+    assert(hull.GetSize() > points.GetSize());
+
+    std::sort(points.begin(),
+              points.end(),
+              [](const Vector2<T>& a, const Vector2<T>& b) { return (a.GetX() < b.GetX()) || ((a.GetX() == b.GetX()) && (a.GetY() < b.GetY())); });
+    const std::size_t count = static_cast<std::size_t>(std::unique(points.begin(), points.end()) - points.begin());
+    if(count < 3u)
+    {
+      std::copy(points.begin(), points.begin() + count, hull.begin());
+      return count;
+    }
+
+    // Pops every vertex that does not turn left, the lower chain first and then the upper one on top of it. The chains
+    // only share their end points, so the stack never holds more than count + 1 vertices.
+    std::size_t size = 0u;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      while((size >= 2u) && (RobustOrientation(hull[size - 2u], hull[size - 1u], points[i]) <= static_cast<T>(0)))
+      {
+        size--;
+      }
+
+      hull[size++] = points[i];
+    }
+
+    const std::size_t lower = size + 1u;
+    for(std::size_t i = count - 1u; i-- > 0u;)
+    {
+      while((size >= lower) && (RobustOrientation(hull[size - 2u], hull[size - 1u], points[i]) <= static_cast<T>(0)))
+      {
+        size--;
+      }
+
+      hull[size++] = points[i];
+    }
+
+    // The upper chain ends on the first vertex again
+    return size - 1u;
+  }
+} // namespace Math
+
+namespace Math::Batch
+{
+  // Orientation(a, b, point) for every point, out may be longer than points
+  template<class T>
+  void Orientation(const Vector2<T>& a, const Vector2<T>& b, const Vector2Array<T>& points, Math::Span<T> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Geometry2D::Orientation", points.GetSize());
+
+    assert(out.GetSize() >= points.GetSize());
+
+    const T* px             = points.GetX().GetData();
+    const T* py             = points.GetY().GetData();
+    T* o                    = out.GetData();
+    const std::size_t count = points.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      o[i] = ((a.GetX() - px[i]) * (b.GetY() - py[i])) - ((a.GetY() - py[i]) * (b.GetX() - px[i]));
+    }
+  }
+
+  // RobustOrientation(a, b, point) for every point. The filter runs packed, only lanes it cannot decide take the exact stage
+  template<class T>
+  void RobustOrientation(const Vector2<T>& a, const Vector2<T>& b, const Vector2Array<T>& points, Math::Span<T> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Geometry2D::RobustOrientation", points.GetSize());
+
+    assert(out.GetSize() >= points.GetSize());
+
+    const T* px             = points.GetX().GetData();
+    const T* py             = points.GetY().GetData();
+    T* o                    = out.GetData();
+    const std::size_t count = points.GetSize();
+
+    std::size_t i = 0u;
+    if constexpr(Math::Simd::Traits<T>::kEnabled && std::is_floating_point_v<T>)
+    {
+      constexpr std::size_t kLanes = Math::Simd::Traits<T>::kLanes;
+
+      const auto ax    = Simd::Broadcast(a.GetX());
+      const auto ay    = Simd::Broadcast(a.GetY());
+      const auto bx    = Simd::Broadcast(b.GetX());
+      const auto by    = Simd::Broadcast(b.GetY());
+      const auto zero  = Simd::Broadcast(static_cast<T>(0));
+      const auto bound = Simd::Broadcast(Math::Detail::kOrientationBound<T>);
+
+      for(; (i + kLanes) <= count; i += kLanes)
+      {
+        const auto x           = Simd::Load(px + i);
+        const auto y           = Simd::Load(py + i);
+        const auto left        = Simd::Multiply(Simd::Subtract(ax, x), Simd::Subtract(by, y));
+        const auto right       = Simd::Multiply(Simd::Subtract(ay, y), Simd::Subtract(bx, x));
+        const auto determinant = Simd::Subtract(left, right);
+        const auto magnitude   = Simd::Add(Simd::Max(left, Simd::Subtract(zero, left)), Simd::Max(right, Simd::Subtract(zero, right)));
+        Simd::StoreUnaligned(o + i, determinant);
+
+        // Lanes with |determinant| >= bound are decided, the rest are too close to collinear for the rounded value
+        const int decided = Simd::GreaterEqualMask(Simd::Max(determinant, Simd::Subtract(zero, determinant)), Simd::Multiply(bound, magnitude));
+        if(decided != 0xF)
+        {
+          for(std::size_t lane = 0u; lane < kLanes; lane++)
+          {
+            if(((decided >> lane) & 1) == 0)
+            {
+              o[i + lane] = Math::Detail::ExactOrientation(a, b, Vector2<T>(px[i + lane], py[i + lane]));
+            }
+          }
+        }
+      }
+    }
+
+    for(; i < count; i++)
+    {
+      o[i] = Math::RobustOrientation(a, b, Vector2<T>(px[i], py[i]));
+    }
+  }
+
+  // Points inside polygon as Math::IsInsidePolygon, out receives their indices in increasing order. Every block of points
+  // is first tested against the bounds of the polygon, the surviving ones walk all edges with the lanes crossing each
+  // edge toggled packed. Crossings the rounded side test cannot decide are settled by the exact stage lane by lane.
+  template<class T>
+  void IsInsidePolygon(Math::Span<const Vector2<T>> polygon, const Vector2Array<T>& points, std::vector<std::size_t>& inside)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Geometry2D::IsInsidePolygon", points.GetSize());
+
+    const T* px              = points.GetX().GetData();
+    const T* py              = points.GetY().GetData();
+    const std::size_t edges  = polygon.GetSize();
+    const Vector2<T>* vertex = polygon.GetData();
+
+    if(edges == 0u)
+    {
+      inside.clear();
+      return;
+    }
+
+    T minX = vertex[0].GetX();
+    T minY = vertex[0].GetY();
+    T maxX = minX;
+    T maxY = minY;
+    for(std::size_t i = 1u; i < edges; i++)
+    {
+      minX = std::min(minX, vertex[i].GetX());
+      minY = std::min(minY, vertex[i].GetY());
+      maxX = std::max(maxX, vertex[i].GetX());
+      maxY = std::max(maxY, vertex[i].GetY());
+    }
+
+    const auto packed = [&](std::size_t i)
+    {
+      const auto x = Simd::Load(px + i);
+      const auto y = Simd::Load(py + i);
+
+      const int bounded = Simd::GreaterEqualMask(x, Simd::Broadcast(minX)) & Simd::GreaterEqualMask(Simd::Broadcast(maxX), x)
+                          & Simd::GreaterEqualMask(y, Simd::Broadcast(minY)) & Simd::GreaterEqualMask(Simd::Broadcast(maxY), y);
+      if(bounded == 0)
+      {
+        return 0;
+      }
+
+      const auto zero  = Simd::Broadcast(static_cast<T>(0));
+      const auto bound = Simd::Broadcast(Math::Detail::kOrientationBound<T>);
+
+      int result = 0;
+      for(std::size_t e = 0u, previous = edges - 1u; e < edges; previous = e++)
+      {
+        const Vector2<T>& a = vertex[previous];
+        const Vector2<T>& b = vertex[e];
+
+        // Lanes whose y lies on different sides of the two end points, as in the scalar test
+        const int crossing = Simd::GreaterEqualMask(y, Simd::Broadcast(a.GetY())) ^ Simd::GreaterEqualMask(y, Simd::Broadcast(b.GetY()));
+
+        // The side of each point, as RobustOrientation(b, point, a)
+        const auto ax    = Simd::Broadcast(a.GetX());
+        const auto ay    = Simd::Broadcast(a.GetY());
+        const auto left  = Simd::Multiply(Simd::Broadcast(b.GetX() - a.GetX()), Simd::Subtract(y, ay));
+        const auto right = Simd::Multiply(Simd::Broadcast(b.GetY() - a.GetY()), Simd::Subtract(x, ax));
+        const auto side  = Simd::Subtract(left, right);
+
+        int toward = (b.GetY() > a.GetY()) ? (~Simd::GreaterEqualMask(zero, side) & 0xF) : (~Simd::GreaterEqualMask(side, zero) & 0xF);
+
+        const auto magnitude = Simd::Add(Simd::Max(left, Simd::Subtract(zero, left)), Simd::Max(right, Simd::Subtract(zero, right)));
+        const int undecided  = crossing & Simd::GreaterEqualMask(Simd::Multiply(bound, magnitude), Simd::Max(side, Simd::Subtract(zero, side)));
+        if(undecided != 0)
+        {
+          for(std::size_t lane = 0u; lane < 4u; lane++)
+          {
+            if(((undecided >> lane) & 1) != 0)
+            {
+              const Vector2<T> point(px[i + lane], py[i + lane]);
+              const int bit = 1 << lane;
+              toward        = Math::Detail::CrossesRay(a, b, Math::Detail::ExactOrientation(b, point, a)) ? (toward | bit) : (toward & ~bit);
+            }
+          }
+        }
+
+        result ^= crossing & toward;
+      }
+
+      return result & bounded;
+    };
+
+    const auto scalar = [&](std::size_t i) { return Math::IsInsidePolygon(Vector2<T>(px[i], py[i]), polygon); };
+
+    Math::Detail::CompactIndices<T>(points.GetSize(), inside, packed, scalar);
+  }
+} // namespace Math::Batch
+
+#endif // __MATH__GEOMETRY2D_HPP__
@@ -0,0 +1,191 @@
+#include "Geometry2D.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class Geometry2DTyped : public Test
+  {};
+
+  using Geometry2DTypes = Types<float, double>;
+  TYPED_TEST_SUITE(Geometry2DTyped, Geometry2DTypes);
+
+  // Deterministic points in [-scale, scale)^2
+  template<class T>
+  static std::vector<Vector2<T>> CreatePoints(std::size_t count, std::uint32_t seed, T scale)
+  {
+    std::uint32_t state   = seed;
+    const auto coordinate = [&]()
+    {
+      state = (state * 1664525u) + 1013904223u;
+      return ((static_cast<T>(state >> 8u) / static_cast<T>(1u << 24u)) * static_cast<T>(2) - static_cast<T>(1)) * scale;
+    };
+
+    std::vector<Vector2<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T x = coordinate();
+      result.push_back(Vector2<T>(x, coordinate()));
+    }
+
+    return result;
+  }
+
+  TYPED_TEST(Geometry2DTyped, Orientation)
+  {
+    using T = TypeParam;
+
+    const Vector2<T> a(static_cast<T>(0), static_cast<T>(0));
+    const Vector2<T> b(static_cast<T>(4), static_cast<T>(0));
+    const Vector2<T> c(static_cast<T>(0), static_cast<T>(3));
+    ASSERT_EQ(Math::Orientation(a, b, c), static_cast<T>(12));
+    ASSERT_EQ(Math::Orientation(a, c, b), static_cast<T>(-12));
+    ASSERT_EQ(Math::Orientation(a, b, Vector2<T>(static_cast<T>(8), static_cast<T>(0))), static_cast<T>(0));
+    ASSERT_EQ(Math::RobustOrientation(a, b, c), static_cast<T>(12));
+
+    // Points a few units in the last place off the diagonal through (12, 12) and (24, 24), where the rounded
+    // determinant often has the wrong sign. The exact sign of each one is that of y - x.
+    const T step = std::numeric_limits<T>::epsilon() / static_cast<T>(2);
+    const Vector2<T> first(static_cast<T>(12), static_cast<T>(12));
+    const Vector2<T> second(static_cast<T>(24), static_cast<T>(24));
+
+    Vector2Array<T> points;
+    std::vector<int> expected;
+    for(int i = 0; i < 16; i++)
+    {
+      for(int j = 0; j < 16; j++)
+      {
+        points.PushBack(Vector2<T>(static_cast<T>(0.5) + (static_cast<T>(i) * step), static_cast<T>(0.5) + (static_cast<T>(j) * step)));
+        expected.push_back((j > i) ? 1 : ((j < i) ? -1 : 0));
+      }
+    }
+
+    std::vector<T> robust(points.GetSize());
+    Math::Batch::RobustOrientation(first, second, points, Math::Span<T>(robust));
+
+    std::size_t wrong = 0u;
+    for(std::size_t i = 0u; i < points.GetSize(); i++)
+    {
+      const auto sign = [](T value) { return (value > static_cast<T>(0)) ? 1 : ((value < static_cast<T>(0)) ? -1 : 0); };
+
+      ASSERT_EQ(sign(Math::RobustOrientation(first, second, points[i])), expected[i]);
+      ASSERT_EQ(sign(Math::RobustOrientation(points[i], first, second)), expected[i]);
+      ASSERT_EQ(sign(robust[i]), expected[i]);
+      wrong += (sign(Math::Orientation(first, second, points[i])) != expected[i]) ? 1u : 0u;
+    }
+
+    ASSERT_GT(wrong, 0u);
+
+    std::vector<T> fast(points.GetSize());
+    Math::Batch::Orientation(a, b, points, Math::Span<T>(fast));
+    for(std::size_t i = 0u; i < points.GetSize(); i++)
+    {
+      ASSERT_EQ(fast[i], Math::Orientation(a, b, points[i]));
+    }
+  }
+
+  TYPED_TEST(Geometry2DTyped, IsInsidePolygon)
+  {
+    using T = TypeParam;
+
+    const auto v = [](int x, int y) { return Vector2<T>(static_cast<T>(x), static_cast<T>(y)); };
+
+    // An L shape, clockwise
+    const std::vector<Vector2<T>> shape = {v(0, 0), v(0, 4), v(2, 4), v(2, 2), v(4, 2), v(4, 0)};
+    const Math::Span<const Vector2<T>> polygon(shape);
+    ASSERT_TRUE(Math::IsInsidePolygon(v(1, 3), polygon));
+    ASSERT_TRUE(Math::IsInsidePolygon(v(3, 1), polygon));
+    ASSERT_TRUE(Math::IsInsidePolygon(v(1, 2), polygon));
+    ASSERT_FALSE(Math::IsInsidePolygon(v(3, 3), polygon));
+    ASSERT_FALSE(Math::IsInsidePolygon(v(5, 1), polygon));
+    ASSERT_FALSE(Math::IsInsidePolygon(v(-1, 2), polygon));
+
+    // A point on the edge two squares share is inside exactly one of them, whatever their winding
+    const std::vector<Vector2<T>> left  = {v(0, 0), v(2, 0), v(2, 2), v(0, 2)};
+    const std::vector<Vector2<T>> right = {v(2, 0), v(2, 2), v(4, 2), v(4, 0)};
+    for(const Vector2<T>& point : {v(2, 1), Vector2<T>(static_cast<T>(2), static_cast<T>(0.25))})
+    {
+      ASSERT_NE(Math::IsInsidePolygon(point, Math::Span<const Vector2<T>>(left)), Math::IsInsidePolygon(point, Math::Span<const Vector2<T>>(right)));
+    }
+
+    // A self intersecting star against scattered points, with a few on its edges and vertices
+    std::vector<Vector2<T>> star;
+    for(std::size_t i = 0u; i < 5u; i++)
+    {
+      const T angle = static_cast<T>(i * 2u) * static_cast<T>(2.0 * 3.14159265358979323846 / 5.0);
+      star.push_back(Vector2<T>(std::cos(angle), std::sin(angle)) * static_cast<T>(3));
+    }
+
+    std::vector<Vector2<T>> scattered = CreatePoints<T>(1001u, 7u, static_cast<T>(4));
+    scattered.insert(scattered.end(), star.begin(), star.end());
+    scattered.push_back((star[0] + star[1]) * static_cast<T>(0.5));
+    scattered.push_back(Vector2<T>::Zero);
+
+    const Vector2Array<T> points(scattered);
+    std::vector<std::size_t> inside;
+    Math::Batch::IsInsidePolygon(Math::Span<const Vector2<T>>(star), points, inside);
+
+    std::vector<std::size_t> expected;
+    for(std::size_t i = 0u; i < scattered.size(); i++)
+    {
+      if(Math::IsInsidePolygon(scattered[i], Math::Span<const Vector2<T>>(star)))
+      {
+        expected.push_back(i);
+      }
+    }
+
+    ASSERT_EQ(inside, expected);
+    ASSERT_GT(inside.size(), 0u);
+    ASSERT_LT(inside.size(), scattered.size());
+
+    Math::Batch::IsInsidePolygon(Math::Span<const Vector2<T>>(), points, inside);
+    ASSERT_TRUE(inside.empty());
+  }
+
+  TYPED_TEST(Geometry2DTyped, ConvexHull)
+  {
+    using T = TypeParam;
+
+    const auto v = [](int x, int y) { return Vector2<T>(static_cast<T>(x), static_cast<T>(y)); };
+
+    // A square with interior points, points along its edges and repeated corners
+    std::vector<Vector2<T>> square = {v(1, 1), v(0, 0), v(2, 0), v(4, 0), v(4, 4), v(2, 2), v(0, 4), v(4, 2), v(0, 0), v(4, 4), v(3, 1)};
+    std::vector<Vector2<T>> hull(square.size() + 1u);
+    ASSERT_EQ(Math::ConvexHull(Math::Span<Vector2<T>>(square), Math::Span<Vector2<T>>(hull)), 4u);
+    ASSERT_TRUE(hull[0] == v(0, 0));
+    ASSERT_TRUE(hull[1] == v(4, 0));
+    ASSERT_TRUE(hull[2] == v(4, 4));
+    ASSERT_TRUE(hull[3] == v(0, 4));
+
+    std::vector<Vector2<T>> line = {v(3, 3), v(1, 1), v(2, 2), v(1, 1)};
+    ASSERT_EQ(Math::ConvexHull(Math::Span<Vector2<T>>(line), Math::Span<Vector2<T>>(hull)), 2u);
+    ASSERT_TRUE(hull[0] == v(1, 1));
+    ASSERT_TRUE(hull[1] == v(3, 3));
+
+    // Every point lies on the inner side of every hull edge, and every hull vertex turns strictly left
+    std::vector<Vector2<T>> points         = CreatePoints<T>(2000u, 3u, static_cast<T>(100));
+    const std::vector<Vector2<T>> original = points;
+    hull.resize(points.size() + 1u);
+
+    const std::size_t count = Math::ConvexHull(Math::Span<Vector2<T>>(points), Math::Span<Vector2<T>>(hull));
+    ASSERT_GE(count, 3u);
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const Vector2<T>& a = hull[i];
+      const Vector2<T>& b = hull[(i + 1u) % count];
+      ASSERT_GT(Math::RobustOrientation(a, b, hull[(i + 2u) % count]), static_cast<T>(0));
+      for(const Vector2<T>& point : original)
+      {
+        ASSERT_GE(Math::RobustOrientation(a, b, point), static_cast<T>(0));
+      }
+    }
+  }
+} // namespace UnitTest
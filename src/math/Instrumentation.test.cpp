@@ -0,0 +1,152 @@
+// The library sites are only compiled in with MATH_INSTRUMENTATION, otherwise this file turns it on for its own sites
+// alone and includes nothing else of the library, so every other translation unit keeps the plain definitions
+#if defined(MATH_INSTRUMENTATION)
+  #include "Common.hpp"
+  #include "CommonBatch.hpp"
+  #include "Vector3.hpp"
+  #define MATH_INSTRUMENTATION_LIBRARY
+#else
+  #define MATH_INSTRUMENTATION
+#endif
+
+#include "Instrumentation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  static Math::Instrumentation::SiteReport FindSite(const std::vector<Math::Instrumentation::SiteReport>& reports, const char* name)
+  {
+    for(const Math::Instrumentation::SiteReport& report : reports)
+    {
+      if(std::strcmp(report.name, name) == 0)
+      {
+        return report;
+      }
+    }
+
+    return Math::Instrumentation::SiteReport{name, 0u, 0u, 0.0, 0.0};
+  }
+
+  static std::uint64_t InstrumentedInner(std::uint64_t value)
+  {
+    MATH_INSTRUMENT("Test::Inner");
+
+    volatile std::uint64_t result = value;
+    for(std::uint64_t i = 0u; i < 64u; i++)
+    {
+      result = (result * 6364136223846793005u) + 1442695040888963407u;
+    }
+
+    return result;
+  }
+
+  static std::uint64_t InstrumentedOuter(std::uint64_t value)
+  {
+    MATH_INSTRUMENT("Test::Outer");
+    return InstrumentedInner(value) ^ InstrumentedInner(value + 1u);
+  }
+
+  static void InstrumentedBatch(std::vector<std::uint64_t>& values)
+  {
+    MATH_INSTRUMENT_BATCH("Test::Batch", values.size());
+    for(std::uint64_t& value : values)
+    {
+      value = InstrumentedInner(value);
+    }
+  }
+
+  TEST(Instrumentation, Counters)
+  {
+    Math::Instrumentation::Reset();
+
+    std::uint64_t sum = 0u;
+    for(std::uint64_t i = 0u; i < 1000u; i++)
+    {
+      sum += InstrumentedOuter(i);
+    }
+
+    std::vector<std::uint64_t> values(100u, 7u);
+    for(std::size_t i = 0u; i < 3u; i++)
+    {
+      InstrumentedBatch(values);
+    }
+
+    // Counts of exited threads are kept
+    std::thread worker(
+      [&]()
+      {
+        for(std::uint64_t i = 0u; i < 500u; i++)
+        {
+          InstrumentedInner(i);
+        }
+      });
+    worker.join();
+
+    const std::vector<Math::Instrumentation::SiteReport> reports = Math::Instrumentation::Snapshot();
+    const Math::Instrumentation::SiteReport outer                = FindSite(reports, "Test::Outer");
+    const Math::Instrumentation::SiteReport inner                = FindSite(reports, "Test::Inner");
+    const Math::Instrumentation::SiteReport batch                = FindSite(reports, "Test::Batch");
+    ASSERT_NE(sum, 0u);
+
+    ASSERT_EQ(outer.calls, 1000u);
+    ASSERT_EQ(outer.elements, 0u);
+    ASSERT_EQ(inner.calls, 2000u + 300u + 500u);
+    ASSERT_EQ(batch.calls, 3u);
+    ASSERT_EQ(batch.elements, 300u);
+
+    // Timing is sampled, only its presence and the bounds of the shares are stable
+    ASSERT_GT(outer.ticks, 0.0);
+    ASSERT_GT(inner.ticks, 0.0);
+    ASSERT_GT(batch.ticks, 0.0);
+    ASSERT_GT(outer.share, 0.0);
+    ASSERT_GT(batch.share, 0.0);
+    ASSERT_LT(outer.share + batch.share, 1.5);
+    ASSERT_GE(reports.front().ticks, reports.back().ticks);
+
+    const std::string text = Math::Instrumentation::Format(reports);
+    ASSERT_NE(text.find("Test::Outer: 1000 calls, "), std::string::npos);
+    ASSERT_NE(text.find("Test::Batch: 3 calls, 300 elements, "), std::string::npos);
+    ASSERT_NE(text.find("% of math time"), std::string::npos);
+
+    Math::Instrumentation::Reset();
+    ASSERT_EQ(FindSite(Math::Instrumentation::Snapshot(), "Test::Outer").calls, 0u);
+    ASSERT_EQ(Math::Instrumentation::Format(Math::Instrumentation::Snapshot()).find("Test::"), std::string::npos);
+  }
+
+#if defined(MATH_INSTRUMENTATION_LIBRARY)
+  TEST(Instrumentation, LibrarySites)
+  {
+    Math::Instrumentation::Reset();
+
+    std::size_t primes = 0u;
+    for(std::uint32_t i = 0u; i < 1000u; i++)
+    {
+      primes += Math::IsPrime(i) ? 1u : 0u;
+    }
+
+    const Vector3<float> normal = Vector3<float>(3.0f, 0.0f, 4.0f).ToNormalized();
+
+    std::vector<float> values(37u, 2.0f);
+    Math::Batch::Clamp01(Math::Span<float>(values));
+
+    const std::vector<Math::Instrumentation::SiteReport> reports = Math::Instrumentation::Snapshot();
+    ASSERT_EQ(primes, 168u);
+    ASSERT_EQ(FindSite(reports, "IsPrime").calls, 1000u);
+    ASSERT_GT(FindSite(reports, "IsPrime").ticks, 0.0);
+    ASSERT_EQ(normal.GetZ(), 0.8f);
+    ASSERT_EQ(FindSite(reports, "Vector3::ToNormalized").calls, 1u);
+    ASSERT_EQ(FindSite(reports, "Batch::Clamp").calls, 1u);
+    ASSERT_EQ(FindSite(reports, "Batch::Clamp").elements, 37u);
+  }
+#endif
+} // namespace UnitTest
@@ -0,0 +1,242 @@
+#ifndef __MATH__KDTREE_HPP__
+#define __MATH__KDTREE_HPP__
+
+#include "Span.hpp"
+#include "Spatial.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Balanced k-d tree stored implicitly in one flat array. The points of a subtree occupy a range [lo, hi) whose middle
+ * element is the splitting point: the lower half lies at or below it on the split axis and the upper half at or above.
+ * Ranges of at most kLeafSize points are leaves and are scanned linearly. Coordinates are kept as three arrays in tree
+ * order, so the scans stream through memory and no node holds a pointer.
+ */
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class KdTree
+{
+  public:
+  static constexpr std::size_t kLeafSize = 8u;
+
+  void Build(Math::Span<const Vector3<T>> points)
+  {
+    const std::size_t count = points.GetSize();
+    m_Index.resize(count);
+    std::iota(m_Index.begin(), m_Index.end(), std::size_t(0u));
+    m_Axis.assign(count, 0u);
+
+    Split(points, 0u, count);
+
+    m_X.resize(count);
+    m_Y.resize(count);
+    m_Z.resize(count);
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const Vector3<T>& point = points[m_Index[i]];
+      m_X[i]                  = point.GetX();
+      m_Y[i]                  = point.GetY();
+      m_Z[i]                  = point.GetZ();
+    }
+  }
+
+  std::size_t GetSize() const { return m_Index.size(); }
+  bool IsEmpty() const { return m_Index.empty(); }
+
+  // Index of the closest point, Math::kNoPoint when the tree is empty
+  std::size_t Nearest(const Vector3<T>& query) const
+  {
+    Math::Detail::NearestCandidate<T> result;
+    Search(query, 0u, GetSize(), result);
+    return result.index;
+  }
+
+  // Indices of the count closest points, closest first
+  void Nearest(const Vector3<T>& query, std::size_t count, std::vector<std::size_t>& out) const
+  {
+    Math::Detail::NeighborHeap<T> heap(std::min(count, GetSize()));
+    if(count != 0u)
+    {
+      Search(query, 0u, GetSize(), heap);
+    }
+
+    heap.Extract(out);
+  }
+
+  // Indices of the points within radius of query, in no particular order
+  void Radius(const Vector3<T>& query, T radius, std::vector<std::size_t>& out) const
+  {
+    out.clear();
+    if(radius >= static_cast<T>(0))
+    {
+      CollectRadius(query, radius * radius, 0u, GetSize(), out);
+    }
+  }
+
+  // Indices of the points inside the closed box [min, max], in no particular order
+  void Box(const Vector3<T>& min, const Vector3<T>& max, std::vector<std::size_t>& out) const
+  {
+    out.clear();
+    CollectBox(min, max, 0u, GetSize(), out);
+  }
+
+  KdTree() = default;
+
+  explicit KdTree(Math::Span<const Vector3<T>> points) { Build(points); }
+
+  private:
+  static T GetAxis(const Vector3<T>& point, std::uint8_t axis) { return (axis == 0u) ? point.GetX() : ((axis == 1u) ? point.GetY() : point.GetZ()); }
+
+  T GetCoordinate(std::size_t position, std::uint8_t axis) const { return (axis == 0u) ? m_X[position] : ((axis == 1u) ? m_Y[position] : m_Z[position]); }
+
+  // Splits [lo, hi) of m_Index on the axis of widest spread, then both halves
+  void Split(Math::Span<const Vector3<T>> points, std::size_t lo, std::size_t hi)
+  {
+    if((hi - lo) <= kLeafSize)
+    {
+      return;
+    }
+
+    Vector3<T> min = points[m_Index[lo]];
+    Vector3<T> max = min;
+    for(std::size_t i = lo + 1u; i < hi; i++)
+    {
+      const Vector3<T>& point = points[m_Index[i]];
+      min = Vector3<T>(std::min(min.GetX(), point.GetX()), std::min(min.GetY(), point.GetY()), std::min(min.GetZ(), point.GetZ()));
+      max = Vector3<T>(std::max(max.GetX(), point.GetX()), std::max(max.GetY(), point.GetY()), std::max(max.GetZ(), point.GetZ()));
+    }
+
+    const Vector3<T> extent = max - min;
+    std::uint8_t axis       = (extent.GetY() > extent.GetX()) ? 1u : 0u;
+    axis                    = (extent.GetZ() > GetAxis(extent, axis)) ? 2u : axis;
+
+    const std::size_t middle = lo + ((hi - lo) / 2u);
+    std::nth_element(m_Index.begin() + static_cast<std::ptrdiff_t>(lo), m_Index.begin() + static_cast<std::ptrdiff_t>(middle),
+                     m_Index.begin() + static_cast<std::ptrdiff_t>(hi),
+                     [&](std::size_t a, std::size_t b) { return GetAxis(points[a], axis) < GetAxis(points[b], axis); });
+    m_Axis[middle] = axis;
+
+    Split(points, lo, middle);
+    Split(points, middle + 1u, hi);
+  }
+
+  template<class Candidates>
+  void Search(const Vector3<T>& query, std::size_t lo, std::size_t hi, Candidates& candidates) const
+  {
+    if((hi - lo) <= kLeafSize)
+    {
+      for(std::size_t i = lo; i < hi; i++)
+      {
+        candidates.Offer(Math::Detail::SquareDistance(query, m_X[i], m_Y[i], m_Z[i]), m_Index[i]);
+      }
+
+      return;
+    }
+
+    const std::size_t middle = lo + ((hi - lo) / 2u);
+    const std::uint8_t axis  = m_Axis[middle];
+    const T delta            = GetAxis(query, axis) - GetCoordinate(middle, axis);
+    candidates.Offer(Math::Detail::SquareDistance(query, m_X[middle], m_Y[middle], m_Z[middle]), m_Index[middle]);
+
+    // Nearer half first so the bound is tight when the farther one is considered
+    if(delta < static_cast<T>(0))
+    {
+      Search(query, lo, middle, candidates);
+      if((delta * delta) <= candidates.GetBound())
+      {
+        Search(query, middle + 1u, hi, candidates);
+      }
+    }
+    else
+    {
+      Search(query, middle + 1u, hi, candidates);
+      if((delta * delta) <= candidates.GetBound())
+      {
+        Search(query, lo, middle, candidates);
+      }
+    }
+  }
+
+  void CollectRadius(const Vector3<T>& query, T squareRadius, std::size_t lo, std::size_t hi, std::vector<std::size_t>& out) const
+  {
+    if((hi - lo) <= kLeafSize)
+    {
+      for(std::size_t i = lo; i < hi; i++)
+      {
+        if(Math::Detail::SquareDistance(query, m_X[i], m_Y[i], m_Z[i]) <= squareRadius)
+        {
+          out.push_back(m_Index[i]);
+        }
+      }
+
+      return;
+    }
+
+    const std::size_t middle = lo + ((hi - lo) / 2u);
+    const std::uint8_t axis  = m_Axis[middle];
+    const T delta            = GetAxis(query, axis) - GetCoordinate(middle, axis);
+    if(Math::Detail::SquareDistance(query, m_X[middle], m_Y[middle], m_Z[middle]) <= squareRadius)
+    {
+      out.push_back(m_Index[middle]);
+    }
+
+    if((delta <= static_cast<T>(0)) || ((delta * delta) <= squareRadius))
+    {
+      CollectRadius(query, squareRadius, lo, middle, out);
+    }
+
+    if((delta >= static_cast<T>(0)) || ((delta * delta) <= squareRadius))
+    {
+      CollectRadius(query, squareRadius, middle + 1u, hi, out);
+    }
+  }
+
+  void CollectBox(const Vector3<T>& min, const Vector3<T>& max, std::size_t lo, std::size_t hi, std::vector<std::size_t>& out) const
+  {
+    if((hi - lo) <= kLeafSize)
+    {
+      for(std::size_t i = lo; i < hi; i++)
+      {
+        if(Math::Detail::IsInBox(min, max, m_X[i], m_Y[i], m_Z[i]))
+        {
+          out.push_back(m_Index[i]);
+        }
+      }
+
+      return;
+    }
+
+    const std::size_t middle = lo + ((hi - lo) / 2u);
+    const std::uint8_t axis  = m_Axis[middle];
+    const T split            = GetCoordinate(middle, axis);
+    if(Math::Detail::IsInBox(min, max, m_X[middle], m_Y[middle], m_Z[middle]))
+    {
+      out.push_back(m_Index[middle]);
+    }
+
+    if(GetAxis(min, axis) <= split)
+    {
+      CollectBox(min, max, lo, middle, out);
+    }
+
+    if(GetAxis(max, axis) >= split)
+    {
+      CollectBox(min, max, middle + 1u, hi, out);
+    }
+  }
+
+  std::vector<T> m_X;
+  std::vector<T> m_Y;
+  std::vector<T> m_Z;
+  std::vector<std::size_t> m_Index;
+  std::vector<std::uint8_t> m_Axis;
+};
+
+#endif // __MATH__KDTREE_HPP__
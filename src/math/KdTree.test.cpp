@@ -0,0 +1,60 @@
+#include "KdTree.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  TEST(KdTree, Degenerate)
+  {
+    // Identical points tie on every query, the lower indices win
+    const std::vector<Vector3<double>> same(50u, Vector3<double>(1.0, 2.0, 3.0));
+    const KdTree<double> tree(same);
+    ASSERT_EQ(tree.Nearest(Vector3<double>::Zero), 0u);
+
+    std::vector<std::size_t> out;
+    tree.Nearest(Vector3<double>::Zero, 4u, out);
+    ASSERT_EQ(out, (std::vector<std::size_t>{0u, 1u, 2u, 3u}));
+    tree.Radius(Vector3<double>(1.0, 2.0, 3.0), 0.0, out);
+    ASSERT_EQ(out.size(), same.size());
+  }
+
+  TEST(KdTree, Line)
+  {
+    // Points along one axis in reverse order, so every split is on x and the tree reorders all of them
+    std::vector<Vector3<float>> line;
+    for(int i = 999; i >= 0; i--)
+    {
+      line.push_back(Vector3<float>(static_cast<float>(i), 0.0f, 0.0f));
+    }
+
+    KdTree<float> tree;
+    ASSERT_TRUE(tree.IsEmpty());
+    tree.Build(line);
+    ASSERT_EQ(tree.GetSize(), line.size());
+
+    for(int i = 0; i < 1000; i += 37)
+    {
+      ASSERT_EQ(tree.Nearest(Vector3<float>(static_cast<float>(i) + 0.25f, 3.0f, -1.0f)), static_cast<std::size_t>(999 - i));
+    }
+
+    std::vector<std::size_t> out;
+    tree.Box(Vector3<float>(10.0f, -1.0f, -1.0f), Vector3<float>(13.0f, 1.0f, 1.0f), out);
+    std::sort(out.begin(), out.end());
+    ASSERT_EQ(out, (std::vector<std::size_t>{986u, 987u, 988u, 989u}));
+
+    tree.Nearest(Vector3<float>(500.4f, 0.0f, 0.0f), 3u, out);
+    ASSERT_EQ(out, (std::vector<std::size_t>{499u, 498u, 500u}));
+
+    // Rebuilding replaces the previous points
+    tree.Build(Math::Span<const Vector3<float>>(line).Subspan(0u, 3u));
+    ASSERT_EQ(tree.GetSize(), 3u);
+    ASSERT_EQ(tree.Nearest(Vector3<float>::Zero), 2u);
+  }
+} // namespace UnitTest
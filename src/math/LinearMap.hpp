@@ -0,0 +1,205 @@
+#ifndef __MATH__LINEARMAP_HPP__
+#define __MATH__LINEARMAP_HPP__
+
+#include "CommonBatch.hpp"
+#include "Simd.hpp"
+#include "Span.hpp"
+
+#include <cassert>
+#include <type_traits>
+
+/*
+ * Affine map value * scale + offset with an optional clamp of the result, the precomputed form of Math::Normalize for
+ * ranges that stay fixed. Applying it costs one multiply-add, which the compiler fuses where the target has FMA.
+ */
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class LinearMap
+{
+  public:
+  static constexpr LinearMap<T> Identity = LinearMap<T>(static_cast<T>(1), static_cast<T>(0));
+
+  // Maps inMin to outMin and inMax to outMax, a clamped map keeps results between outMin and outMax
+  static constexpr LinearMap<T> FromRanges(T inMin, T inMax, T outMin, T outMax, bool clamp = false)
+  {
+    assert(inMin != inMax);
+
+    const T scale  = (outMax - outMin) / (inMax - inMin);
+    LinearMap<T> result(scale, outMin - (inMin * scale));
+    if(clamp)
+    {
+      result = result.ToClamped((outMin < outMax) ? outMin : outMax, (outMin < outMax) ? outMax : outMin);
+    }
+
+    return result;
+  }
+
+  static constexpr LinearMap<T> Normalize01(T min, T max, bool clamp = false) { return FromRanges(min, max, static_cast<T>(0), static_cast<T>(1), clamp); }
+
+  static constexpr LinearMap<T> Normalize11(T min, T max, bool clamp = false) { return FromRanges(min, max, static_cast<T>(-1), static_cast<T>(1), clamp); }
+
+  static constexpr LinearMap<T> Denormalize01(T min, T max, bool clamp = false) { return FromRanges(static_cast<T>(0), static_cast<T>(1), min, max, clamp); }
+
+  static constexpr LinearMap<T> Denormalize11(T min, T max, bool clamp = false) { return FromRanges(static_cast<T>(-1), static_cast<T>(1), min, max, clamp); }
+
+  constexpr T operator()(T value) const { return Apply(value); }
+
+  constexpr T Apply(T value) const
+  {
+    const T result = (value * m_Scale) + m_Offset;
+    if(!m_Clamped)
+    {
+      return result;
+    }
+
+    // Same comparisons as Math::Clamp so a NaN result becomes the lower bound
+    const T upper = (m_Max < result) ? m_Max : result;
+    return (m_Min < upper) ? upper : m_Min;
+  }
+
+  /*
+   * (this * inner)(value) == (*this)(inner(value)). A clamp is monotonic, so clamping the inner result and then mapping
+   * equals mapping and clamping to the image of the inner bounds, which makes the composition exact with clamping too.
+   */
+  constexpr LinearMap<T> operator*(const LinearMap<T>& inner) const
+  {
+    LinearMap<T> result(m_Scale * inner.m_Scale, (inner.m_Offset * m_Scale) + m_Offset);
+    if(!inner.m_Clamped)
+    {
+      return m_Clamped ? result.ToClamped(m_Min, m_Max) : result;
+    }
+
+    const T first  = ToUnclamped()(inner.m_Min);
+    const T second = ToUnclamped()(inner.m_Max);
+    T min          = (first < second) ? first : second;
+    T max          = (first < second) ? second : first;
+    if(m_Clamped)
+    {
+      // Disjoint bounds leave a constant, the outer bound nearest to the mapped inner range
+      min = (min < m_Min) ? m_Min : ((min > m_Max) ? m_Max : min);
+      max = (max > m_Max) ? m_Max : ((max < m_Min) ? m_Min : max);
+    }
+
+    return result.ToClamped(min, max);
+  }
+
+  // Maps results back to their inputs, the inverse of a clamped map clamps to the preimage of its bounds
+  constexpr LinearMap<T> ToInverse() const
+  {
+    assert(m_Scale != static_cast<T>(0));
+
+    const LinearMap<T> result(static_cast<T>(1) / m_Scale, -m_Offset / m_Scale);
+    if(!m_Clamped)
+    {
+      return result;
+    }
+
+    const T first  = result(m_Min);
+    const T second = result(m_Max);
+    return result.ToClamped((first < second) ? first : second, (first < second) ? second : first);
+  }
+
+  constexpr LinearMap<T> ToClamped(T min, T max) const
+  {
+    assert(!(max < min));
+
+    LinearMap<T> result(m_Scale, m_Offset);
+    result.m_Min     = min;
+    result.m_Max     = max;
+    result.m_Clamped = true;
+    return result;
+  }
+
+  constexpr LinearMap<T> ToUnclamped() const { return LinearMap<T>(m_Scale, m_Offset); }
+
+  constexpr T GetScale() const { return m_Scale; }
+
+  constexpr T GetOffset() const { return m_Offset; }
+
+  constexpr bool IsClamped() const { return m_Clamped; }
+
+  constexpr T GetMin() const { return m_Min; }
+
+  constexpr T GetMax() const { return m_Max; }
+
+  constexpr LinearMap(T scale, T offset)
+      : m_Scale(scale)
+      , m_Offset(offset)
+      , m_Min(static_cast<T>(0))
+      , m_Max(static_cast<T>(0))
+      , m_Clamped(false)
+  {}
+
+  constexpr LinearMap()
+      : LinearMap(static_cast<T>(1), static_cast<T>(0))
+  {}
+
+  private:
+  T m_Scale;
+  T m_Offset;
+  T m_Min;
+  T m_Max;
+  bool m_Clamped;
+};
+
+namespace Math::Batch
+{
+  // out[i] = map(in[i]), the output may alias or overlap the input
+  template<class T>
+  void Apply(const LinearMap<T>& map, Math::Span<const T> in, Math::Span<T> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::LinearMap::Apply", in.GetSize());
+
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      const auto scale  = Math::Simd::Broadcast(map.GetScale());
+      const auto offset = Math::Simd::Broadcast(map.GetOffset());
+      const auto low    = Math::Simd::Broadcast(map.GetMin());
+      const auto high   = Math::Simd::Broadcast(map.GetMax());
+
+      if(map.IsClamped())
+      {
+        Math::Detail::UnaryKernel(in,
+                                  out,
+                                  [&](auto value)
+                                  {
+                                    if constexpr(std::is_same_v<decltype(value), T>)
+                                    {
+                                      return map(value);
+                                    }
+                                    else
+                                    {
+                                      return Math::Simd::Max(Math::Simd::Min(high, Math::Simd::Add(Math::Simd::Multiply(value, scale), offset)), low);
+                                    }
+                                  });
+      }
+      else
+      {
+        Math::Detail::UnaryKernel(in,
+                                  out,
+                                  [&](auto value)
+                                  {
+                                    if constexpr(std::is_same_v<decltype(value), T>)
+                                    {
+                                      return map(value);
+                                    }
+                                    else
+                                    {
+                                      return Math::Simd::Add(Math::Simd::Multiply(value, scale), offset);
+                                    }
+                                  });
+      }
+    }
+    else
+    {
+      Math::Detail::UnaryKernel(in, out, [&](T value) { return map(value); });
+    }
+  }
+
+  template<class T>
+  void Apply(const LinearMap<T>& map, Math::Span<T> values)
+  {
+    Apply(map, Math::Span<const T>(values), values);
+  }
+} // namespace Math::Batch
+
+#endif // __MATH__LINEARMAP_HPP__
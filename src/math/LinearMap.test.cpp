@@ -0,0 +1,110 @@
+#include "LinearMap.hpp"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class LinearMapTyped : public Test
+  {};
+
+  using LinearMapTypes = Types<float, double>;
+  TYPED_TEST_SUITE(LinearMapTyped, LinearMapTypes);
+
+  TEST(LinearMap, Constexpr)
+  {
+    constexpr LinearMap<double> map = LinearMap<double>::Normalize01(0.0, 10.0);
+    static_assert(map(5.0) == 0.5);
+    static_assert(map.ToInverse()(0.5) == 5.0);
+    static_assert((map * LinearMap<double>::Identity)(5.0) == 0.5);
+    static_assert(LinearMap<double>::Normalize11(0.0, 4.0, true)(6.0) == 1.0);
+  }
+
+  TYPED_TEST(LinearMapTyped, Apply)
+  {
+    using T = TypeParam;
+
+    const T tolerance              = static_cast<T>(16) * std::numeric_limits<T>::epsilon();
+    const LinearMap<T> map         = LinearMap<T>::FromRanges(T(-3), T(5), T(10), T(-30));
+    const LinearMap<T> normalize01 = LinearMap<T>::Normalize01(T(-3), T(5));
+    const LinearMap<T> normalize11 = LinearMap<T>::Normalize11(T(-3), T(5));
+
+    for(int i = -20; i <= 20; i++)
+    {
+      const T value = static_cast<T>(i) * static_cast<T>(0.5);
+      ASSERT_NEAR(map(value), Math::Normalize(value, T(-3), T(5), T(10), T(-30)), tolerance * T(64));
+      ASSERT_NEAR(normalize01(value), Math::Normalize01(value, T(-3), T(5)), tolerance * T(4));
+      ASSERT_NEAR(normalize11(value), Math::Normalize11(value, T(-3), T(5)), tolerance * T(4));
+      ASSERT_NEAR(LinearMap<T>::Denormalize01(T(-3), T(5))(value), Math::Denormalize01(value, T(-3), T(5)), tolerance * T(16));
+      ASSERT_NEAR(LinearMap<T>::Denormalize11(T(-3), T(5))(value), Math::Denormalize11(value, T(-3), T(5)), tolerance * T(16));
+
+      const T clamped = LinearMap<T>::FromRanges(T(-3), T(5), T(10), T(-30), true)(value);
+      ASSERT_NEAR(clamped, Math::Clamp(Math::Normalize(value, T(-3), T(5), T(10), T(-30)), T(-30), T(10)), tolerance * T(64));
+    }
+  }
+
+  TYPED_TEST(LinearMapTyped, Compose)
+  {
+    using T = TypeParam;
+
+    const T tolerance        = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+    const LinearMap<T> first = LinearMap<T>::FromRanges(T(-3), T(5), T(0), T(2));
+    const LinearMap<T> then  = LinearMap<T>::FromRanges(T(0), T(2), T(100), T(50));
+    const LinearMap<T> both  = then * first;
+    const LinearMap<T> back  = both.ToInverse();
+
+    for(int i = -20; i <= 20; i++)
+    {
+      const T value = static_cast<T>(i) * static_cast<T>(0.5);
+      ASSERT_NEAR(both(value), then(first(value)), tolerance * T(16));
+      ASSERT_NEAR(back(both(value)), value, tolerance);
+    }
+
+    // Clamping survives composition and inversion
+    const LinearMap<T> unit     = LinearMap<T>::Normalize01(T(0), T(10), true);
+    const LinearMap<T> widen    = LinearMap<T>::FromRanges(T(0), T(1), T(-5), T(5), true).ToClamped(T(-2), T(8));
+    const LinearMap<T> disjoint = LinearMap<T>(T(1), T(0)).ToClamped(T(3), T(4)) * unit;
+
+    for(int i = -20; i <= 40; i++)
+    {
+      const T value = static_cast<T>(i) * static_cast<T>(0.5);
+      ASSERT_NEAR((widen * unit)(value), widen(unit(value)), tolerance * T(16));
+      ASSERT_EQ(disjoint(value), T(3));
+      ASSERT_NEAR(unit.ToInverse()(value), Math::Clamp(value * T(10), T(0), T(10)), tolerance * T(16));
+    }
+  }
+
+  TYPED_TEST(LinearMapTyped, Batch)
+  {
+    using T = TypeParam;
+
+    const LinearMap<T> maps[] = {LinearMap<T>::Normalize11(T(-3), T(5)), LinearMap<T>::Normalize11(T(-3), T(5), true)};
+
+    std::vector<T> values;
+    for(std::size_t i = 0u; i < 37u; i++)
+    {
+      values.push_back((static_cast<T>(i) * static_cast<T>(0.5)) - static_cast<T>(6));
+    }
+
+    for(const LinearMap<T>& map : maps)
+    {
+      std::vector<T> mapped(values.size());
+      std::vector<T> inPlace = values;
+      Math::Batch::Apply(map, Math::Span<const T>(values), Math::Span<T>(mapped));
+      Math::Batch::Apply(map, Math::Span<T>(inPlace));
+
+      // The packed kernel may contract into fused multiply-adds differently from the scalar tail
+      const T tolerance = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+      for(std::size_t i = 0u; i < values.size(); i++)
+      {
+        ASSERT_NEAR(mapped[i], map(values[i]), tolerance);
+        ASSERT_EQ(inPlace[i], mapped[i]);
+      }
+    }
+  }
+} // namespace UnitTest
@@ -0,0 +1,126 @@
+#ifndef __MATH__MATRIX3_HPP__
+#define __MATH__MATRIX3_HPP__
+
+#include "Quaternion.hpp"
+#include "Vector3.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+// Column-major 3x3 matrix, each column is a Vector3 and inherits its packed register layout
+template<class T, std::enable_if_t<std::is_arithmetic_v<T> && std::is_signed_v<T>, bool> = true>
+class Matrix3
+{
+  public:
+  static constexpr Matrix3<T> Zero     = Matrix3<T>(Vector3<T>::Zero, Vector3<T>::Zero, Vector3<T>::Zero);
+  static constexpr Matrix3<T> Identity = Matrix3<T>(Vector3<T>::Right, Vector3<T>::Up, Vector3<T>::Forward);
+
+  // Rotation matrix of a unit quaternion
+  static Matrix3<T> FromQuaternion(const Quaternion<T>& rotation)
+  {
+    constexpr T kOne = static_cast<T>(1);
+    constexpr T kTwo = static_cast<T>(2);
+
+    const T x = rotation.GetX();
+    const T y = rotation.GetY();
+    const T z = rotation.GetZ();
+    const T w = rotation.GetW();
+
+    const T xx = x * x;
+    const T yy = y * y;
+    const T zz = z * z;
+    const T xy = x * y;
+    const T xz = x * z;
+    const T yz = y * z;
+    const T wx = w * x;
+    const T wy = w * y;
+    const T wz = w * z;
+
+    return Matrix3<T>(Vector3<T>(kOne - (kTwo * (yy + zz)), kTwo * (xy + wz), kTwo * (xz - wy)),
+                      Vector3<T>(kTwo * (xy - wz), kOne - (kTwo * (xx + zz)), kTwo * (yz + wx)),
+                      Vector3<T>(kTwo * (xz + wy), kTwo * (yz - wx), kOne - (kTwo * (xx + yy))));
+  }
+
+  bool operator==(const Matrix3<T>& rhs) const
+  {
+    return (m_Columns[0] == rhs.m_Columns[0]) && (m_Columns[1] == rhs.m_Columns[1]) && (m_Columns[2] == rhs.m_Columns[2]);
+  }
+
+  bool operator!=(const Matrix3<T>& rhs) const { return !((*this) == rhs); }
+
+  Matrix3<T> operator*(const Matrix3<T>& rhs) const { return Matrix3<T>((*this) * rhs.m_Columns[0], (*this) * rhs.m_Columns[1], (*this) * rhs.m_Columns[2]); }
+
+  Vector3<T> operator*(const Vector3<T>& rhs) const
+  {
+    return (m_Columns[0] * rhs.GetX()) + (m_Columns[1] * rhs.GetY()) + (m_Columns[2] * rhs.GetZ());
+  }
+
+  Matrix3<T> ToTransposed() const
+  {
+    return Matrix3<T>(Vector3<T>(m_Columns[0].GetX(), m_Columns[1].GetX(), m_Columns[2].GetX()),
+                      Vector3<T>(m_Columns[0].GetY(), m_Columns[1].GetY(), m_Columns[2].GetY()),
+                      Vector3<T>(m_Columns[0].GetZ(), m_Columns[1].GetZ(), m_Columns[2].GetZ()));
+  }
+
+  // Quaternion of a pure rotation matrix, branching on the largest diagonal term to keep the square root well conditioned
+  Quaternion<T> ToQuaternion() const
+  {
+    constexpr T kOne     = static_cast<T>(1);
+    constexpr T kTwo     = static_cast<T>(2);
+    constexpr T kQuarter = static_cast<T>(0.25);
+
+    const T m00 = Get(0u, 0u);
+    const T m11 = Get(1u, 1u);
+    const T m22 = Get(2u, 2u);
+    const T m01 = Get(0u, 1u);
+    const T m10 = Get(1u, 0u);
+    const T m02 = Get(0u, 2u);
+    const T m20 = Get(2u, 0u);
+    const T m12 = Get(1u, 2u);
+    const T m21 = Get(2u, 1u);
+
+    const T trace = m00 + m11 + m22;
+    if(trace > static_cast<T>(0))
+    {
+      const T s = static_cast<T>(std::sqrt(trace + kOne)) * kTwo;
+      return Quaternion<T>((m21 - m12) / s, (m02 - m20) / s, (m10 - m01) / s, kQuarter * s);
+    }
+    else if((m00 > m11) && (m00 > m22))
+    {
+      const T s = static_cast<T>(std::sqrt(kOne + m00 - m11 - m22)) * kTwo;
+      return Quaternion<T>(kQuarter * s, (m01 + m10) / s, (m02 + m20) / s, (m21 - m12) / s);
+    }
+    else if(m11 > m22)
+    {
+      const T s = static_cast<T>(std::sqrt(kOne + m11 - m00 - m22)) * kTwo;
+      return Quaternion<T>((m01 + m10) / s, kQuarter * s, (m12 + m21) / s, (m02 - m20) / s);
+    }
+    else
+    {
+      const T s = static_cast<T>(std::sqrt(kOne + m22 - m00 - m11)) * kTwo;
+      return Quaternion<T>((m02 + m20) / s, (m12 + m21) / s, kQuarter * s, (m10 - m01) / s);
+    }
+  }
+
+  T Get(std::size_t row, std::size_t column) const
+  {
+    const Vector3<T>& value = m_Columns[column];
+    return (row == 0u) ? value.GetX() : ((row == 1u) ? value.GetY() : value.GetZ());
+  }
+
+  constexpr const Vector3<T>& GetColumn(std::size_t column) const { return m_Columns[column]; }
+
+  constexpr Matrix3(const Vector3<T>& column0, const Vector3<T>& column1, const Vector3<T>& column2)
+      : m_Columns {column0, column1, column2}
+  {}
+
+  constexpr Matrix3()
+      : m_Columns {}
+  {}
+
+  private:
+  Vector3<T> m_Columns[3];
+};
+
+#endif // __MATH__MATRIX3_HPP__
@@ -0,0 +1,70 @@
+#include "Matrix3.hpp"
+
+#include <cmath>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class Matrix3Typed : public Test
+  {};
+
+  using Matrix3Types = Types<float, double>;
+  TYPED_TEST_SUITE(Matrix3Typed, Matrix3Types);
+
+  TYPED_TEST(Matrix3Typed, Product)
+  {
+    using T = TypeParam;
+
+    const Matrix3<T> a(Vector3<T>(static_cast<T>(1), static_cast<T>(4), static_cast<T>(7)),
+                       Vector3<T>(static_cast<T>(2), static_cast<T>(5), static_cast<T>(8)),
+                       Vector3<T>(static_cast<T>(3), static_cast<T>(6), static_cast<T>(10)));
+
+    ASSERT_TRUE((a * Matrix3<T>::Identity) == a);
+    ASSERT_TRUE((Matrix3<T>::Identity * a) == a);
+    ASSERT_EQ(a.Get(0u, 1u), static_cast<T>(2));
+    ASSERT_EQ(a.ToTransposed().Get(0u, 1u), static_cast<T>(4));
+
+    const Vector3<T> product = a * Vector3<T>(static_cast<T>(1), static_cast<T>(-1), static_cast<T>(2));
+    ASSERT_TRUE(product == Vector3<T>(static_cast<T>(5), static_cast<T>(11), static_cast<T>(19)));
+
+    const Matrix3<T> square = a * a;
+    ASSERT_EQ(square.Get(0u, 0u), static_cast<T>(30));
+    ASSERT_EQ(square.Get(1u, 2u), static_cast<T>(102));
+    ASSERT_EQ(square.Get(2u, 1u), static_cast<T>(134));
+  }
+
+  TYPED_TEST(Matrix3Typed, Quaternion)
+  {
+    using T = TypeParam;
+
+    const T tolerance = static_cast<T>(16) * std::numeric_limits<T>::epsilon();
+    const Vector3<T> value(static_cast<T>(3), static_cast<T>(-1), static_cast<T>(2));
+
+    // Angles past pi exercise every branch of the matrix to quaternion conversion
+    for(int angle = -31; angle <= 31; angle += 3)
+    {
+      const Vector3<T> axis(static_cast<T>(angle % 5), static_cast<T>(1), static_cast<T>(-2));
+      const Quaternion<T> rotation = Quaternion<T>::FromAxisAngle(axis, static_cast<T>(angle) / static_cast<T>(10));
+      const Matrix3<T> matrix      = Matrix3<T>::FromQuaternion(rotation);
+
+      const Vector3<T> expected = rotation.Rotate(value);
+      const Vector3<T> actual   = matrix * value;
+      ASSERT_NEAR(actual.GetX(), expected.GetX(), tolerance * static_cast<T>(8));
+      ASSERT_NEAR(actual.GetY(), expected.GetY(), tolerance * static_cast<T>(8));
+      ASSERT_NEAR(actual.GetZ(), expected.GetZ(), tolerance * static_cast<T>(8));
+
+      // Both signs of a quaternion describe the same rotation
+      const Quaternion<T> converted = matrix.ToQuaternion();
+      const T sign                  = (Quaternion<T>::DotProduct(converted, rotation) < static_cast<T>(0)) ? static_cast<T>(-1) : static_cast<T>(1);
+      ASSERT_NEAR(converted.GetX() * sign, rotation.GetX(), tolerance);
+      ASSERT_NEAR(converted.GetY() * sign, rotation.GetY(), tolerance);
+      ASSERT_NEAR(converted.GetZ() * sign, rotation.GetZ(), tolerance);
+      ASSERT_NEAR(converted.GetW() * sign, rotation.GetW(), tolerance);
+    }
+  }
+} // namespace UnitTest
@@ -0,0 +1,142 @@
+#ifndef __MATH__MATRIX4_HPP__
+#define __MATH__MATRIX4_HPP__
+
+#include "Matrix3.hpp"
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+#include "Vector3.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+// Column-major 4x4 matrix, every column fills one aligned four-lane register
+template<class T, std::enable_if_t<std::is_arithmetic_v<T> && std::is_signed_v<T>, bool> = true>
+class alignas(Math::Simd::Traits<T>::kAlignment) Matrix4
+{
+  public:
+  static constexpr Matrix4<T> Zero     = Matrix4<T>();
+  static constexpr Matrix4<T> Identity = Matrix4<T>(Matrix3<T>::Identity, Vector3<T>::Zero);
+
+  static Matrix4<T> FromQuaternion(const Quaternion<T>& rotation) { return Matrix4<T>(Matrix3<T>::FromQuaternion(rotation), Vector3<T>::Zero); }
+
+  // Rigid transform applying the rotation first and the translation second
+  static Matrix4<T> FromRotationTranslation(const Quaternion<T>& rotation, const Vector3<T>& translation)
+  {
+    return Matrix4<T>(Matrix3<T>::FromQuaternion(rotation), translation);
+  }
+
+  bool operator==(const Matrix4<T>& rhs) const
+  {
+    for(std::size_t i = 0u; i < 16u; i++)
+    {
+      if(m_Data[i] != rhs.m_Data[i])
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  bool operator!=(const Matrix4<T>& rhs) const { return !((*this) == rhs); }
+
+  Matrix4<T> operator*(const Matrix4<T>& rhs) const
+  {
+    const Register column0 = Math::Simd::Load(m_Data);
+    const Register column1 = Math::Simd::Load(m_Data + 4);
+    const Register column2 = Math::Simd::Load(m_Data + 8);
+    const Register column3 = Math::Simd::Load(m_Data + 12);
+
+    Matrix4<T> result;
+    for(std::size_t j = 0u; j < 4u; j++)
+    {
+      const T* other = rhs.m_Data + (j * 4u);
+      const Register sum01 =
+        Math::Simd::Add(Math::Simd::Multiply(column0, Math::Simd::Broadcast(other[0])), Math::Simd::Multiply(column1, Math::Simd::Broadcast(other[1])));
+      const Register sum23 =
+        Math::Simd::Add(Math::Simd::Multiply(column2, Math::Simd::Broadcast(other[2])), Math::Simd::Multiply(column3, Math::Simd::Broadcast(other[3])));
+      Math::Simd::Store(result.m_Data + (j * 4u), Math::Simd::Add(sum01, sum23));
+    }
+
+    return result;
+  }
+
+  // Affine transform of a point, the projective row is ignored
+  Vector3<T> TransformPoint(const Vector3<T>& value) const
+  {
+    const Register sum = Math::Simd::Add(Math::Simd::Add(Math::Simd::Multiply(Math::Simd::Load(m_Data), Math::Simd::Broadcast(value.GetX())),
+                                                         Math::Simd::Multiply(Math::Simd::Load(m_Data + 4), Math::Simd::Broadcast(value.GetY()))),
+                                         Math::Simd::Add(Math::Simd::Multiply(Math::Simd::Load(m_Data + 8), Math::Simd::Broadcast(value.GetZ())),
+                                                         Math::Simd::Load(m_Data + 12)));
+    return ToVector3(sum);
+  }
+
+  Vector3<T> TransformDirection(const Vector3<T>& value) const
+  {
+    const Register sum = Math::Simd::Add(Math::Simd::Add(Math::Simd::Multiply(Math::Simd::Load(m_Data), Math::Simd::Broadcast(value.GetX())),
+                                                         Math::Simd::Multiply(Math::Simd::Load(m_Data + 4), Math::Simd::Broadcast(value.GetY()))),
+                                         Math::Simd::Multiply(Math::Simd::Load(m_Data + 8), Math::Simd::Broadcast(value.GetZ())));
+    return ToVector3(sum);
+  }
+
+  Matrix4<T> ToTransposed() const
+  {
+    Matrix4<T> result;
+    for(std::size_t column = 0u; column < 4u; column++)
+    {
+      for(std::size_t row = 0u; row < 4u; row++)
+      {
+        result.m_Data[(row * 4u) + column] = m_Data[(column * 4u) + row];
+      }
+    }
+
+    return result;
+  }
+
+  Quaternion<T> ToQuaternion() const { return GetMatrix3().ToQuaternion(); }
+
+  Matrix3<T> GetMatrix3() const
+  {
+    return Matrix3<T>(Vector3<T>(m_Data[0], m_Data[1], m_Data[2]), Vector3<T>(m_Data[4], m_Data[5], m_Data[6]), Vector3<T>(m_Data[8], m_Data[9], m_Data[10]));
+  }
+
+  Vector3<T> GetTranslation() const { return Vector3<T>(m_Data[12], m_Data[13], m_Data[14]); }
+
+  T Get(std::size_t row, std::size_t column) const { return m_Data[(column * 4u) + row]; }
+
+  void Set(std::size_t row, std::size_t column, T value) { m_Data[(column * 4u) + row] = value; }
+
+  constexpr Matrix4(const Matrix3<T>& linear, const Vector3<T>& translation)
+      : m_Data {}
+  {
+    for(std::size_t column = 0u; column < 3u; column++)
+    {
+      m_Data[(column * 4u) + 0u] = linear.GetColumn(column).GetX();
+      m_Data[(column * 4u) + 1u] = linear.GetColumn(column).GetY();
+      m_Data[(column * 4u) + 2u] = linear.GetColumn(column).GetZ();
+    }
+
+    m_Data[12] = translation.GetX();
+    m_Data[13] = translation.GetY();
+    m_Data[14] = translation.GetZ();
+    m_Data[15] = static_cast<T>(1);
+  }
+
+  constexpr Matrix4()
+      : m_Data {}
+  {}
+
+  private:
+  using Register = typename Math::Simd::Traits<T>::Register;
+
+  static Vector3<T> ToVector3(Register value)
+  {
+    alignas(Math::Simd::Traits<T>::kAlignment) T lanes[Math::Simd::Traits<T>::kLanes];
+    Math::Simd::Store(lanes, value);
+    return Vector3<T>(lanes[0], lanes[1], lanes[2]);
+  }
+
+  T m_Data[16];
+};
+
+#endif // __MATH__MATRIX4_HPP__
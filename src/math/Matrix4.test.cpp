@@ -0,0 +1,100 @@
+#include "Matrix4.hpp"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class Matrix4Typed : public Test
+  {};
+
+  using Matrix4Types = Types<float, double>;
+  TYPED_TEST_SUITE(Matrix4Typed, Matrix4Types);
+
+  TYPED_TEST(Matrix4Typed, Constructor)
+  {
+    using T = TypeParam;
+
+    for(std::size_t row = 0u; row < 4u; row++)
+    {
+      for(std::size_t column = 0u; column < 4u; column++)
+      {
+        ASSERT_EQ(Matrix4<T>::Zero.Get(row, column), static_cast<T>(0));
+        ASSERT_EQ(Matrix4<T>::Identity.Get(row, column), (row == column) ? static_cast<T>(1) : static_cast<T>(0));
+      }
+    }
+  }
+
+  TYPED_TEST(Matrix4Typed, Product)
+  {
+    using T = TypeParam;
+
+    Matrix4<T> a;
+    Matrix4<T> b;
+    for(std::size_t row = 0u; row < 4u; row++)
+    {
+      for(std::size_t column = 0u; column < 4u; column++)
+      {
+        a.Set(row, column, static_cast<T>((row * 4u) + column + 1u));
+        b.Set(row, column, static_cast<T>(row) - static_cast<T>(column));
+      }
+    }
+
+    ASSERT_TRUE((a * Matrix4<T>::Identity) == a);
+    ASSERT_TRUE((Matrix4<T>::Identity * a) == a);
+
+    const Matrix4<T> product = a * b;
+    for(std::size_t row = 0u; row < 4u; row++)
+    {
+      for(std::size_t column = 0u; column < 4u; column++)
+      {
+        T expected = static_cast<T>(0);
+        for(std::size_t k = 0u; k < 4u; k++)
+        {
+          expected += a.Get(row, k) * b.Get(k, column);
+        }
+
+        ASSERT_EQ(product.Get(row, column), expected);
+        ASSERT_EQ(a.ToTransposed().Get(row, column), a.Get(column, row));
+      }
+    }
+  }
+
+  TYPED_TEST(Matrix4Typed, Transform)
+  {
+    using T = TypeParam;
+
+    const T tolerance = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+    const Vector3<T> axis(static_cast<T>(1), static_cast<T>(2), static_cast<T>(-1));
+    const Quaternion<T> rotation = Quaternion<T>::FromAxisAngle(axis, static_cast<T>(1.2));
+    const Vector3<T> translation(static_cast<T>(10), static_cast<T>(-5), static_cast<T>(2));
+    const Matrix4<T> transform = Matrix4<T>::FromRotationTranslation(rotation, translation);
+    const Vector3<T> value(static_cast<T>(3), static_cast<T>(-1), static_cast<T>(2));
+
+    const Vector3<T> point     = transform.TransformPoint(value);
+    const Vector3<T> direction = transform.TransformDirection(value);
+    const Vector3<T> expected  = rotation.Rotate(value);
+
+    ASSERT_NEAR(point.GetX(), expected.GetX() + translation.GetX(), tolerance);
+    ASSERT_NEAR(point.GetY(), expected.GetY() + translation.GetY(), tolerance);
+    ASSERT_NEAR(point.GetZ(), expected.GetZ() + translation.GetZ(), tolerance);
+    ASSERT_NEAR(direction.GetX(), expected.GetX(), tolerance);
+    ASSERT_NEAR(direction.GetY(), expected.GetY(), tolerance);
+    ASSERT_NEAR(direction.GetZ(), expected.GetZ(), tolerance);
+
+    ASSERT_TRUE(transform.GetTranslation() == translation);
+    ASSERT_NEAR(transform.ToQuaternion().GetW(), rotation.GetW(), tolerance);
+
+    // Composition applies the right-hand transform first
+    const Matrix4<T> twice = transform * transform;
+    const Vector3<T> again = transform.TransformPoint(point);
+    const Vector3<T> once  = twice.TransformPoint(value);
+    ASSERT_NEAR(once.GetX(), again.GetX(), tolerance * static_cast<T>(8));
+    ASSERT_NEAR(once.GetY(), again.GetY(), tolerance * static_cast<T>(8));
+    ASSERT_NEAR(once.GetZ(), again.GetZ(), tolerance * static_cast<T>(8));
+  }
+} // namespace UnitTest
@@ -0,0 +1,70 @@
+#include "Benchmark.hpp"
+#include "Matrix3.hpp"
+#include "Matrix4.hpp"
+#include "MatrixBatch.hpp"
+#include "Quaternion.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Benchmark
+{
+  template<class T>
+  static std::vector<Vector3<T>> CreateTransformPoints(std::size_t count)
+  {
+    std::vector<Vector3<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      result.push_back(Vector3<T>(CreateScalar<T>(3u * i), CreateScalar<T>((3u * i) + 1u), CreateScalar<T>((3u * i) + 2u)));
+    }
+
+    return result;
+  }
+
+  // kernel(values, out) once over an array and once over a span of count points
+  template<class T, class ArrayKernel, class SpanKernel>
+  static void RegisterTransform(const char* name, ArrayKernel arrayKernel, SpanKernel spanKernel)
+  {
+    using V = Vector3<T>;
+
+    RegisterBatch(Name<T>(name) + "_Array",
+                  [arrayKernel](std::size_t count)
+                  {
+                    const std::vector<V> points = CreateTransformPoints<T>(count);
+                    return [arrayKernel, values = Vector3Array<T>(Math::Span<const V>(points)), out = Vector3Array<T>(count)]() mutable
+                    { arrayKernel(values, out); };
+                  });
+    RegisterBatch(Name<T>(name) + "_Span",
+                  [spanKernel](std::size_t count)
+                  {
+                    return [spanKernel, values = CreateTransformPoints<T>(count), out = std::vector<V>(count)]() mutable
+                    { spanKernel(Math::Span<const V>(values), Math::Span<V>(out)); };
+                  });
+  }
+
+  template<class T>
+  static bool RegisterMatrixBatch()
+  {
+    const Quaternion<T> rotation = Quaternion<T>::FromAxisAngle(Vector3<T>(1, 2, 3), static_cast<T>(0.7));
+    const Matrix4<T> transform   = Matrix4<T>::FromRotationTranslation(rotation, Vector3<T>(4, -5, 6));
+    const Matrix3<T> linear      = Matrix3<T>::FromQuaternion(rotation);
+
+    RegisterTransform<T>(
+      "MatrixBatch_TransformPoints",
+      [=](const auto& values, auto& out) { Math::Batch::TransformPoints(transform, values, out); },
+      [=](auto values, auto out) { Math::Batch::TransformPoints(transform, values, out); });
+    RegisterTransform<T>(
+      "MatrixBatch_TransformDirections",
+      [=](const auto& values, auto& out) { Math::Batch::TransformDirections(transform, values, out); },
+      [=](auto values, auto out) { Math::Batch::TransformDirections(transform, values, out); });
+    RegisterTransform<T>(
+      "MatrixBatch_Transform3",
+      [=](const auto& values, auto& out) { Math::Batch::Transform(linear, values, out); },
+      [=](auto values, auto out) { Math::Batch::Transform(linear, values, out); });
+    return true;
+  }
+
+  static const bool kMatrixBatchRegistered = RegisterMatrixBatch<float>() && RegisterMatrixBatch<double>();
+} // namespace Benchmark
@@ -0,0 +1,144 @@
+#ifndef __MATH__MATRIXBATCH_HPP__
+#define __MATH__MATRIXBATCH_HPP__
+
+#include "Matrix3.hpp"
+#include "Matrix4.hpp"
+#include "Simd.hpp"
+#include "Span.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <cassert>
+#include <cstddef>
+
+namespace Math::Detail
+{
+  // Shared SoA kernel: out = linear * value (+ translation), four vectors per register with a scalar tail
+  template<class T, bool Translate>
+  void TransformArray(const Matrix4<T>& transform, const Vector3Array<T>& values, Vector3Array<T>& out)
+  {
+    const std::size_t count = values.GetSize();
+    out.Resize(count);
+
+    const T* vx = values.GetX().GetData();
+    const T* vy = values.GetY().GetData();
+    const T* vz = values.GetZ().GetData();
+    T* ox       = out.GetX().GetData();
+    T* oy       = out.GetY().GetData();
+    T* oz       = out.GetZ().GetData();
+
+    std::size_t i = 0u;
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      constexpr std::size_t kLanes = Math::Simd::Traits<T>::kLanes;
+      constexpr T kTranslate       = Translate ? static_cast<T>(1) : static_cast<T>(0);
+
+      const auto m00 = Math::Simd::Broadcast(transform.Get(0u, 0u));
+      const auto m10 = Math::Simd::Broadcast(transform.Get(1u, 0u));
+      const auto m20 = Math::Simd::Broadcast(transform.Get(2u, 0u));
+      const auto m01 = Math::Simd::Broadcast(transform.Get(0u, 1u));
+      const auto m11 = Math::Simd::Broadcast(transform.Get(1u, 1u));
+      const auto m21 = Math::Simd::Broadcast(transform.Get(2u, 1u));
+      const auto m02 = Math::Simd::Broadcast(transform.Get(0u, 2u));
+      const auto m12 = Math::Simd::Broadcast(transform.Get(1u, 2u));
+      const auto m22 = Math::Simd::Broadcast(transform.Get(2u, 2u));
+      const auto m03 = Math::Simd::Broadcast(transform.Get(0u, 3u) * kTranslate);
+      const auto m13 = Math::Simd::Broadcast(transform.Get(1u, 3u) * kTranslate);
+      const auto m23 = Math::Simd::Broadcast(transform.Get(2u, 3u) * kTranslate);
+
+      for(; (i + kLanes) <= count; i += kLanes)
+      {
+        const auto x = Math::Simd::LoadUnaligned(vx + i);
+        const auto y = Math::Simd::LoadUnaligned(vy + i);
+        const auto z = Math::Simd::LoadUnaligned(vz + i);
+
+        const auto xy0 = Math::Simd::Add(Math::Simd::Multiply(m00, x), Math::Simd::Multiply(m01, y));
+        const auto xy1 = Math::Simd::Add(Math::Simd::Multiply(m10, x), Math::Simd::Multiply(m11, y));
+        const auto xy2 = Math::Simd::Add(Math::Simd::Multiply(m20, x), Math::Simd::Multiply(m21, y));
+
+        Math::Simd::StoreUnaligned(ox + i, Math::Simd::Add(xy0, Math::Simd::Add(Math::Simd::Multiply(m02, z), m03)));
+        Math::Simd::StoreUnaligned(oy + i, Math::Simd::Add(xy1, Math::Simd::Add(Math::Simd::Multiply(m12, z), m13)));
+        Math::Simd::StoreUnaligned(oz + i, Math::Simd::Add(xy2, Math::Simd::Add(Math::Simd::Multiply(m22, z), m23)));
+      }
+    }
+
+    for(; i < count; i++)
+    {
+      const Vector3<T> value  = Vector3<T>(vx[i], vy[i], vz[i]);
+      const Vector3<T> result = Translate ? transform.TransformPoint(value) : transform.TransformDirection(value);
+      ox[i]                   = result.GetX();
+      oy[i]                   = result.GetY();
+      oz[i]                   = result.GetZ();
+    }
+  }
+} // namespace Math::Detail
+
+namespace Math::Batch
+{
+  // The output of every transform below may alias its input
+
+  template<class T>
+  void TransformPoints(const Matrix4<T>& transform, const Vector3Array<T>& values, Vector3Array<T>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Matrix::TransformPoints", values.GetSize());
+    Math::Detail::TransformArray<T, true>(transform, values, out);
+  }
+
+  template<class T>
+  void TransformDirections(const Matrix4<T>& transform, const Vector3Array<T>& values, Vector3Array<T>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Matrix::TransformDirections", values.GetSize());
+    Math::Detail::TransformArray<T, false>(transform, values, out);
+  }
+
+  template<class T>
+  void TransformPoints(const Matrix4<T>& transform, Math::Span<const Vector3<T>> values, Math::Span<Vector3<T>> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Matrix::TransformPoints", values.GetSize());
+
+    assert(out.GetSize() >= values.GetSize());
+
+    const std::size_t count = values.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = transform.TransformPoint(values[i]);
+    }
+  }
+
+  template<class T>
+  void TransformDirections(const Matrix4<T>& transform, Math::Span<const Vector3<T>> values, Math::Span<Vector3<T>> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Matrix::TransformDirections", values.GetSize());
+
+    assert(out.GetSize() >= values.GetSize());
+
+    const std::size_t count = values.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = transform.TransformDirection(values[i]);
+    }
+  }
+
+  template<class T>
+  void Transform(const Matrix3<T>& transform, const Vector3Array<T>& values, Vector3Array<T>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Matrix::Transform", values.GetSize());
+    Math::Detail::TransformArray<T, false>(Matrix4<T>(transform, Vector3<T>::Zero), values, out);
+  }
+
+  template<class T>
+  void Transform(const Matrix3<T>& transform, Math::Span<const Vector3<T>> values, Math::Span<Vector3<T>> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Matrix::Transform", values.GetSize());
+
+    assert(out.GetSize() >= values.GetSize());
+
+    const std::size_t count = values.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = transform * values[i];
+    }
+  }
+} // namespace Math::Batch
+
+#endif // __MATH__MATRIXBATCH_HPP__
@@ -0,0 +1,66 @@
+#include "MatrixBatch.hpp"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class MatrixBatchTyped : public Test
+  {};
+
+  using MatrixBatchTypes = Types<float, double>;
+  TYPED_TEST_SUITE(MatrixBatchTyped, MatrixBatchTypes);
+
+  TYPED_TEST(MatrixBatchTyped, Transform)
+  {
+    using T = TypeParam;
+
+    const T tolerance = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+    const Vector3<T> axis(static_cast<T>(1), static_cast<T>(2), static_cast<T>(-1));
+    const Quaternion<T> rotation = Quaternion<T>::FromAxisAngle(axis, static_cast<T>(1.2));
+    const Vector3<T> translation(static_cast<T>(10), static_cast<T>(-5), static_cast<T>(2));
+    const Matrix4<T> transform = Matrix4<T>::FromRotationTranslation(rotation, translation);
+
+    std::vector<Vector3<T>> values;
+    for(std::size_t i = 0u; i < 37u; i++)
+    {
+      const T value = static_cast<T>(i);
+      values.push_back(Vector3<T>(value - static_cast<T>(8), value * static_cast<T>(0.5), static_cast<T>(3) - value));
+    }
+
+    Vector3Array<T> points(values);
+    Vector3Array<T> directions(values);
+    Vector3Array<T> linear(values);
+    Math::Batch::TransformPoints(transform, points, points);
+    Math::Batch::TransformDirections(transform, directions, directions);
+    Math::Batch::Transform(transform.GetMatrix3(), linear, linear);
+
+    std::vector<Vector3<T>> pointValues(values.size());
+    std::vector<Vector3<T>> directionValues(values.size());
+    Math::Batch::TransformPoints(transform, Math::Span<const Vector3<T>>(values), Math::Span<Vector3<T>>(pointValues));
+    Math::Batch::TransformDirections(transform, Math::Span<const Vector3<T>>(values), Math::Span<Vector3<T>>(directionValues));
+
+    for(std::size_t i = 0u; i < values.size(); i++)
+    {
+      const Vector3<T> expectedPoint     = transform.TransformPoint(values[i]);
+      const Vector3<T> expectedDirection = transform.TransformDirection(values[i]);
+
+      ASSERT_TRUE(pointValues[i] == expectedPoint);
+      ASSERT_TRUE(directionValues[i] == expectedDirection);
+      ASSERT_NEAR(points[i].GetX(), expectedPoint.GetX(), tolerance);
+      ASSERT_NEAR(points[i].GetY(), expectedPoint.GetY(), tolerance);
+      ASSERT_NEAR(points[i].GetZ(), expectedPoint.GetZ(), tolerance);
+      ASSERT_NEAR(directions[i].GetX(), expectedDirection.GetX(), tolerance);
+      ASSERT_NEAR(directions[i].GetY(), expectedDirection.GetY(), tolerance);
+      ASSERT_NEAR(directions[i].GetZ(), expectedDirection.GetZ(), tolerance);
+      ASSERT_NEAR(linear[i].GetX(), expectedDirection.GetX(), tolerance);
+      ASSERT_NEAR(linear[i].GetY(), expectedDirection.GetY(), tolerance);
+      ASSERT_NEAR(linear[i].GetZ(), expectedDirection.GetZ(), tolerance);
+    }
+  }
+} // namespace UnitTest
@@ -0,0 +1,148 @@
+#include "Benchmark.hpp"
+#include "Common.hpp"
+#include "CommonBatch.hpp"
+#include "Parallel.hpp"
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Benchmark
+{
+  // Sizes well past the last level cache, against a pool of one, two and every hardware thread
+  static void ParallelSizes(benchmark::internal::Benchmark* benchmark)
+  {
+    const std::int64_t hardware = static_cast<std::int64_t>(std::max(std::thread::hardware_concurrency(), 1u));
+    std::vector<std::int64_t> pools = {1};
+    if(hardware > 2)
+    {
+      pools.push_back(2);
+    }
+
+    if(hardware > 1)
+    {
+      pools.push_back(hardware);
+    }
+
+    for(const std::int64_t count : {std::int64_t(1) << 16, std::int64_t(1) << 20, std::int64_t(1) << 24})
+    {
+      for(const std::int64_t threads : pools)
+      {
+        benchmark->Args({count, threads});
+      }
+    }
+
+    benchmark->ArgNames({"count", "threads"})->UseRealTime();
+  }
+
+  // setup(count, pool) prepares the inputs and returns the call that runs the kernel once over all of them
+  template<class Setup>
+  static void RegisterParallel(const std::string& name, Setup setup)
+  {
+    benchmark::RegisterBenchmark(name.c_str(),
+                                 [setup](benchmark::State& state)
+                                 {
+                                   const std::size_t count = static_cast<std::size_t>(state.range(0));
+                                   Math::Parallel::ThreadPool pool(static_cast<unsigned int>(state.range(1)));
+                                   auto run = setup(count, pool);
+                                   for(auto _ : state)
+                                   {
+                                     run();
+                                     benchmark::ClobberMemory();
+                                   }
+
+                                   SetItems(state, count);
+                                 })
+      ->Apply(ParallelSizes);
+  }
+
+  template<class T>
+  static std::vector<Vector3<T>> CreateVectors(std::size_t count)
+  {
+    std::vector<Vector3<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      result.push_back(Vector3<T>(CreateScalar<T>(i), CreateScalar<T>(i + 1u), CreateScalar<T>(i + 2u)));
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static bool RegisterParallelKernels()
+  {
+    RegisterParallel(Name<T>("Parallel_Normalize"),
+                     [](std::size_t count, Math::Parallel::ThreadPool& pool)
+                     {
+                       return [values = CreateVectors<T>(count), out = std::vector<Vector3<T>>(count), &pool]() mutable
+                       {
+                         Math::Parallel::Transform(
+                           Math::Span<const Vector3<T>>(values), Math::Span<Vector3<T>>(out), [](const Vector3<T>& value) { return value.ToNormalized(); },
+                           Math::Parallel::kDefaultGrain, pool);
+                       };
+                     });
+
+    RegisterParallel(Name<T>("Parallel_Rotate"),
+                     [](std::size_t count, Math::Parallel::ThreadPool& pool)
+                     {
+                       const Quaternion<T> rotation = Quaternion<T>(CreateScalar<T>(1u), CreateScalar<T>(2u), CreateScalar<T>(3u), 1).ToNormalized();
+                       return [values = CreateVectors<T>(count), out = std::vector<Vector3<T>>(count), rotation, &pool]() mutable
+                       {
+                         Math::Parallel::Transform(
+                           Math::Span<const Vector3<T>>(values), Math::Span<Vector3<T>>(out),
+                           [&](Math::Span<const Vector3<T>> in, Math::Span<Vector3<T>> result) { Math::Batch::Rotate(rotation, in, result); },
+                           Math::Parallel::kDefaultGrain, pool);
+                       };
+                     });
+
+    RegisterParallel(Name<T>("Parallel_Normalize01"),
+                     [](std::size_t count, Math::Parallel::ThreadPool& pool)
+                     {
+                       return [values = CreateScalars<T>(count), out = std::vector<T>(count), &pool]() mutable
+                       {
+                         Math::Parallel::Transform(
+                           Math::Span<const T>(values), Math::Span<T>(out),
+                           [](Math::Span<const T> in, Math::Span<T> result)
+                           { Math::Batch::Normalize01(in, result, static_cast<T>(-100), static_cast<T>(100)); },
+                           Math::Parallel::kDefaultGrain, pool);
+                       };
+                     });
+
+    return true;
+  }
+
+  static bool RegisterParallelPrimes()
+  {
+    RegisterParallel("Parallel_IsPrime<uint64>",
+                     [](std::size_t count, Math::Parallel::ThreadPool& pool)
+                     {
+                       return [count, &pool]()
+                       {
+                         const std::uint64_t first = std::uint64_t(1u) << 40u;
+                         benchmark::DoNotOptimize(Math::Parallel::Reduce(
+                           std::size_t(0u), count, std::size_t(0u),
+                           [first](std::size_t lo, std::size_t hi)
+                           {
+                             std::size_t result = 0u;
+                             for(std::size_t i = lo; i < hi; i++)
+                             {
+                               result += Math::IsPrime(first + i) ? 1u : 0u;
+                             }
+
+                             return result;
+                           },
+                           [](std::size_t a, std::size_t b) { return a + b; }, Math::Parallel::kDefaultGrain, pool));
+                       };
+                     });
+
+    return true;
+  }
+
+  static const bool kParallelRegistered = RegisterParallelKernels<float>() && RegisterParallelKernels<double>() && RegisterParallelPrimes();
+} // namespace Benchmark
@@ -0,0 +1,450 @@
+#ifndef __MATH__PARALLEL_HPP__
+#define __MATH__PARALLEL_HPP__
+
+#include "Span.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * Work-stealing loops over index ranges. A range is cut into blocks of grain indices and each worker owns a deque of
+ * block ranges: it halves the range it holds, pushing the upper half where others can steal it, until one block is
+ * left to run. The calling thread works as worker 0 and every call returns once all of its blocks ran.
+ *
+ * Block boundaries only depend on the range and the grain, never on the thread count or the schedule, so Reduce gives
+ * the same result on any pool. Bodies must not throw. A body that starts another loop on the same pool runs it inline.
+ */
+namespace Math::Detail
+{
+  struct ParallelJob
+  {
+    void (*run)(void* body, std::size_t lo, std::size_t hi);
+    void* body;
+    std::size_t begin;
+    std::size_t end;
+    std::size_t grain;
+    std::atomic<std::size_t> remaining;
+  };
+
+  // Half open range of block indices
+  struct ParallelTask
+  {
+    std::size_t first;
+    std::size_t last;
+  };
+
+  // The owner pushes and pops at the back, thieves take from the front where the largest ranges are
+  class WorkQueue
+  {
+    public:
+    void Push(const ParallelTask& task)
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Tasks.push_back(task);
+    }
+
+    bool Pop(ParallelTask& task)
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      if(m_Tasks.empty())
+      {
+        return false;
+      }
+
+      task = m_Tasks.back();
+      m_Tasks.pop_back();
+      return true;
+    }
+
+    bool Steal(ParallelTask& task)
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      if(m_Tasks.empty())
+      {
+        return false;
+      }
+
+      task = m_Tasks.front();
+      m_Tasks.pop_front();
+      return true;
+    }
+
+    private:
+    std::mutex m_Mutex;
+    std::deque<ParallelTask> m_Tasks;
+  };
+
+  struct WorkerState
+  {
+    const void* pool   = nullptr;
+    unsigned int index = 0u;
+  };
+
+  inline WorkerState& CurrentWorker()
+  {
+    thread_local WorkerState state;
+    return state;
+  }
+
+  // Calls body(lo, hi) on consecutive blocks of [begin, end)
+  template<class Body>
+  void ForEachBlock(std::size_t begin, std::size_t end, std::size_t grain, Body& body)
+  {
+    for(std::size_t lo = begin; lo < end;)
+    {
+      const std::size_t hi = ((end - lo) > grain) ? (lo + grain) : end;
+      body(lo, hi);
+      lo = hi;
+    }
+  }
+} // namespace Math::Detail
+
+namespace Math::Parallel
+{
+  // Indices per block when the caller does not choose, enough work to hide the cost of a steal for cheap kernels
+  constexpr std::size_t kDefaultGrain = 4096u;
+
+  class ThreadPool
+  {
+    public:
+    // Shared pool with one worker per hardware thread, started on first use
+    static ThreadPool& GetDefault()
+    {
+      static ThreadPool pool;
+      return pool;
+    }
+
+    // Workers including the calling thread
+    unsigned int GetThreadCount() const { return static_cast<unsigned int>(m_Queues.size()); }
+
+    // Calls body(lo, hi) for every block of [begin, end), from any worker and in any order
+    template<class Body>
+    void Run(std::size_t begin, std::size_t end, std::size_t grain, Body&& body)
+    {
+      if(end <= begin)
+      {
+        return;
+      }
+
+      grain                        = std::max<std::size_t>(grain, 1u);
+      const std::size_t blockCount = ((end - begin) / grain) + ((((end - begin) % grain) != 0u) ? 1u : 0u);
+      if((blockCount == 1u) || (m_Queues.size() == 1u) || (Detail::CurrentWorker().pool == this))
+      {
+        Detail::ForEachBlock(begin, end, grain, body);
+        return;
+      }
+
+      using B = std::remove_reference_t<Body>;
+      Detail::ParallelJob job;
+      job.run   = [](void* context, std::size_t lo, std::size_t hi) { (*static_cast<B*>(context))(lo, hi); };
+      job.body  = const_cast<void*>(static_cast<const void*>(std::addressof(body)));
+      job.begin = begin;
+      job.end   = end;
+      job.grain = grain;
+      job.remaining.store(blockCount, std::memory_order_relaxed);
+
+      // Outside threads take turns, the pool runs one job at a time
+      std::lock_guard<std::mutex> turn(m_RunMutex);
+      RunJob(job, blockCount);
+    }
+
+    // Zero uses every hardware thread, the calling thread counts as one of them
+    explicit ThreadPool(unsigned int threadCount = 0u)
+    {
+      if(threadCount == 0u)
+      {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+      }
+
+      for(unsigned int i = 0u; i < threadCount; i++)
+      {
+        m_Queues.push_back(std::make_unique<Detail::WorkQueue>());
+      }
+
+      for(unsigned int i = 1u; i < threadCount; i++)
+      {
+        m_Threads.emplace_back([this, i]() { Work(i); });
+      }
+    }
+
+    ~ThreadPool()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+      }
+
+      m_Wake.notify_all();
+      for(std::thread& thread : m_Threads)
+      {
+        thread.join();
+      }
+    }
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    private:
+    void RunJob(Detail::ParallelJob& job, std::size_t blockCount)
+    {
+      Detail::WorkerState& state       = Detail::CurrentWorker();
+      const Detail::WorkerState caller = state;
+      state.pool                       = this;
+      state.index                      = 0u;
+
+      m_Queues[0]->Push(Detail::ParallelTask{0u, blockCount});
+      {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Job = &job;
+        m_Generation++;
+      }
+
+      m_Wake.notify_all();
+      Participate(job, 0u);
+
+      // Late workers must not see the job once it leaves this frame
+      {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Job = nullptr;
+        m_Idle.wait(lock, [this]() { return m_Active == 0u; });
+      }
+
+      state = caller;
+    }
+
+    void Work(unsigned int index)
+    {
+      Detail::WorkerState& state = Detail::CurrentWorker();
+      state.pool                 = this;
+      state.index                = index;
+
+      std::uint64_t seen = 0u;
+      while(true)
+      {
+        Detail::ParallelJob* job = nullptr;
+        {
+          std::unique_lock<std::mutex> lock(m_Mutex);
+          m_Wake.wait(lock, [&]() { return m_Stop || ((m_Job != nullptr) && (m_Generation != seen)); });
+          if(m_Stop)
+          {
+            return;
+          }
+
+          seen = m_Generation;
+          job  = m_Job;
+          m_Active++;
+        }
+
+        Participate(*job, index);
+        {
+          std::lock_guard<std::mutex> lock(m_Mutex);
+          m_Active--;
+        }
+
+        m_Idle.notify_one();
+      }
+    }
+
+    bool Acquire(unsigned int index, Detail::ParallelTask& task)
+    {
+      if(m_Queues[index]->Pop(task))
+      {
+        return true;
+      }
+
+      const std::size_t count = m_Queues.size();
+      for(std::size_t offset = 1u; offset < count; offset++)
+      {
+        if(m_Queues[(index + offset) % count]->Steal(task))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    void Participate(Detail::ParallelJob& job, unsigned int index)
+    {
+      Detail::ParallelTask task;
+      while(job.remaining.load(std::memory_order_acquire) != 0u)
+      {
+        if(!Acquire(index, task))
+        {
+          std::this_thread::yield();
+          continue;
+        }
+
+        while((task.last - task.first) > 1u)
+        {
+          const std::size_t middle = task.first + ((task.last - task.first) / 2u);
+          m_Queues[index]->Push(Detail::ParallelTask{middle, task.last});
+          task.last = middle;
+        }
+
+        const std::size_t lo = job.begin + (task.first * job.grain);
+        const std::size_t hi = ((job.end - lo) > job.grain) ? (lo + job.grain) : job.end;
+        job.run(job.body, lo, hi);
+        job.remaining.fetch_sub(1u, std::memory_order_acq_rel);
+      }
+    }
+
+    std::vector<std::unique_ptr<Detail::WorkQueue>> m_Queues;
+    std::vector<std::thread> m_Threads;
+    std::mutex m_RunMutex;
+    std::mutex m_Mutex;
+    std::condition_variable m_Wake;
+    std::condition_variable m_Idle;
+    Detail::ParallelJob* m_Job = nullptr;
+    std::uint64_t m_Generation = 0u;
+    unsigned int m_Active      = 0u;
+    bool m_Stop                = false;
+  };
+
+  // Worker running the calling code, zero outside of any pool
+  inline unsigned int GetWorkerIndex()
+  {
+    return Detail::CurrentWorker().index;
+  }
+
+  // One value per worker of a pool on its own cache line, so workers can update their slot without contention
+  template<class T>
+  class Scratch
+  {
+    public:
+    T& Local()
+    {
+      assert(GetWorkerIndex() < m_Slots.size());
+      return m_Slots[GetWorkerIndex()].value;
+    }
+
+    T& operator[](std::size_t index)
+    {
+      assert(index < m_Slots.size());
+      return m_Slots[index].value;
+    }
+
+    std::size_t GetSize() const { return m_Slots.size(); }
+
+    explicit Scratch(const ThreadPool& pool = ThreadPool::GetDefault(), const T& initial = T())
+        : m_Slots(pool.GetThreadCount(), Slot{initial})
+    {}
+
+    private:
+    struct alignas(64) Slot
+    {
+      T value;
+    };
+
+    std::vector<Slot> m_Slots;
+  };
+
+  // body(lo, hi) for every block of [begin, end), or body(index) for every index
+  template<class Body>
+  void For(std::size_t begin, std::size_t end, Body&& body, std::size_t grain = kDefaultGrain, ThreadPool& pool = ThreadPool::GetDefault())
+  {
+    if constexpr(std::is_invocable_v<Body&, std::size_t, std::size_t>)
+    {
+      pool.Run(begin, end, grain, body);
+    }
+    else
+    {
+      pool.Run(begin, end, grain,
+               [&body](std::size_t lo, std::size_t hi)
+               {
+                 for(std::size_t i = lo; i < hi; i++)
+                 {
+                   body(i);
+                 }
+               });
+    }
+  }
+
+  // out[i] = op(in[i]), or op(in, out) on matching subspans so batch kernels run per block
+  template<class T, class U, class Op>
+  void Transform(Math::Span<const T> in, Math::Span<U> out, Op&& op, std::size_t grain = kDefaultGrain, ThreadPool& pool = ThreadPool::GetDefault())
+  {
+    assert(in.GetSize() == out.GetSize());
+    pool.Run(0u, in.GetSize(), grain,
+             [&](std::size_t lo, std::size_t hi)
+             {
+               if constexpr(std::is_invocable_v<Op&, Math::Span<const T>, Math::Span<U>>)
+               {
+                 op(in.Subspan(lo, hi - lo), out.Subspan(lo, hi - lo));
+               }
+               else
+               {
+                 for(std::size_t i = lo; i < hi; i++)
+                 {
+                   out[i] = op(in[i]);
+                 }
+               }
+             });
+  }
+
+  // map(lo, hi) per block, folded with combine in block order starting from identity
+  template<class T, class Map, class Combine>
+  T Reduce(std::size_t begin,
+           std::size_t end,
+           T identity,
+           Map&& map,
+           Combine&& combine,
+           std::size_t grain = kDefaultGrain,
+           ThreadPool& pool  = ThreadPool::GetDefault())
+  {
+    if(end <= begin)
+    {
+      return identity;
+    }
+
+    // Wrapped so that partials of bool do not share bytes
+    struct Partial
+    {
+      T value;
+    };
+
+    grain                        = std::max<std::size_t>(grain, 1u);
+    const std::size_t blockCount = ((end - begin) / grain) + ((((end - begin) % grain) != 0u) ? 1u : 0u);
+    std::vector<Partial> partials(blockCount, Partial{identity});
+    pool.Run(begin, end, grain, [&](std::size_t lo, std::size_t hi) { partials[(lo - begin) / grain].value = map(lo, hi); });
+
+    T result = identity;
+    for(const Partial& partial : partials)
+    {
+      result = combine(result, partial.value);
+    }
+
+    return result;
+  }
+
+  template<class T, class Combine>
+  T Reduce(Math::Span<const T> values, T identity, Combine&& combine, std::size_t grain = kDefaultGrain, ThreadPool& pool = ThreadPool::GetDefault())
+  {
+    return Reduce(
+      std::size_t(0u), values.GetSize(), identity,
+      [&](std::size_t lo, std::size_t hi)
+      {
+        T result = identity;
+        for(std::size_t i = lo; i < hi; i++)
+        {
+          result = combine(result, values[i]);
+        }
+
+        return result;
+      },
+      combine, grain, pool);
+  }
+} // namespace Math::Parallel
+
+#endif // __MATH__PARALLEL_HPP__
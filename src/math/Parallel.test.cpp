@@ -0,0 +1,217 @@
+#include "Common.hpp"
+#include "CommonBatch.hpp"
+#include "Parallel.hpp"
+#include "Precision.hpp"
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "Sieve.hpp"
+#include "Vector3.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  TEST(Parallel, For)
+  {
+    Math::Parallel::ThreadPool pool(4u);
+    ASSERT_EQ(pool.GetThreadCount(), 4u);
+
+    // Every index exactly once, with a ragged last block
+    std::vector<std::atomic<int>> visits(100003u);
+    Math::Parallel::For(0u, visits.size(), [&](std::size_t i) { visits[i]++; }, 64u, pool);
+    for(const std::atomic<int>& visit : visits)
+    {
+      ASSERT_EQ(visit.load(), 1);
+    }
+
+    // Blocks stay within the range and the grain
+    std::atomic<std::size_t> covered(0u);
+    Math::Parallel::For(
+      10u, 1000u,
+      [&](std::size_t lo, std::size_t hi)
+      {
+        ASSERT_LT(lo, hi);
+        ASSERT_GE(lo, 10u);
+        ASSERT_LE(hi, 1000u);
+        ASSERT_LE(hi - lo, 7u);
+        covered += hi - lo;
+      },
+      7u, pool);
+    ASSERT_EQ(covered.load(), 990u);
+
+    // Empty ranges and a zero grain
+    Math::Parallel::For(5u, 5u, [](std::size_t) { FAIL(); }, 1u, pool);
+    Math::Parallel::For(9u, 3u, [](std::size_t) { FAIL(); }, 1u, pool);
+    covered = 0u;
+    Math::Parallel::For(0u, 50u, [&](std::size_t lo, std::size_t hi) { covered += hi - lo; }, 0u, pool);
+    ASSERT_EQ(covered.load(), 50u);
+  }
+
+  TEST(Parallel, Nested)
+  {
+    Math::Parallel::ThreadPool pool(3u);
+
+    // An inner loop on the same pool runs inline on the worker that started it
+    std::vector<std::atomic<int>> visits(64u * 64u);
+    Math::Parallel::For(
+      0u, 64u,
+      [&](std::size_t row)
+      {
+        const unsigned int worker = Math::Parallel::GetWorkerIndex();
+        Math::Parallel::For(
+          0u, 64u,
+          [&](std::size_t column)
+          {
+            ASSERT_EQ(Math::Parallel::GetWorkerIndex(), worker);
+            visits[(row * 64u) + column]++;
+          },
+          4u, pool);
+      },
+      1u, pool);
+
+    for(const std::atomic<int>& visit : visits)
+    {
+      ASSERT_EQ(visit.load(), 1);
+    }
+
+    // Back on the calling thread, outside of any worker
+    ASSERT_EQ(Math::Parallel::GetWorkerIndex(), 0u);
+  }
+
+  TEST(Parallel, Scratch)
+  {
+    Math::Parallel::ThreadPool pool(4u);
+    Math::Parallel::Scratch<std::uint64_t> sums(pool);
+    ASSERT_EQ(sums.GetSize(), 4u);
+
+    Math::Parallel::For(
+      0u, 1000000u,
+      [&](std::size_t i)
+      {
+        ASSERT_LT(Math::Parallel::GetWorkerIndex(), pool.GetThreadCount());
+        sums.Local() += i;
+      },
+      1000u, pool);
+
+    std::uint64_t total = 0u;
+    for(std::size_t i = 0u; i < sums.GetSize(); i++)
+    {
+      total += sums[i];
+    }
+
+    ASSERT_EQ(total, std::uint64_t(999999u) * 1000000u / 2u);
+  }
+
+  TEST(Parallel, Reduce)
+  {
+    // Floating point sums do not depend on the thread count
+    std::vector<double> values(250001u);
+    for(std::size_t i = 0u; i < values.size(); i++)
+    {
+      values[i] = 1.0 / static_cast<double>(i + 1u);
+    }
+
+    const auto add = [](double a, double b) { return a + b; };
+    Math::Parallel::ThreadPool single(1u);
+    Math::Parallel::ThreadPool many(5u);
+    const double expected = Math::Parallel::Reduce(Math::Span<const double>(values), 0.0, add, 1000u, single);
+    ASSERT_EQ(Math::Parallel::Reduce(Math::Span<const double>(values), 0.0, add, 1000u, many), expected);
+    ASSERT_NEAR(expected, std::accumulate(values.begin(), values.end(), 0.0), 1e-9);
+
+    ASSERT_EQ(Math::Parallel::Reduce(Math::Span<const double>(), 2.5, add, 1000u, many), 2.5);
+
+    const bool allPositive = Math::Parallel::Reduce(
+      std::size_t(0u), values.size(), true,
+      [&](std::size_t lo, std::size_t hi)
+      {
+        bool result = true;
+        for(std::size_t i = lo; i < hi; i++)
+        {
+          result = result && (values[i] > 0.0);
+        }
+
+        return result;
+      },
+      [](bool a, bool b) { return a && b; }, 100u, many);
+    ASSERT_TRUE(allPositive);
+  }
+
+  TEST(Parallel, Kernels)
+  {
+    Math::Parallel::ThreadPool pool(4u);
+
+    // IsPrime over a range against the segmented sieve
+    const std::size_t primes = Math::Parallel::Reduce(
+      std::size_t(0u), std::size_t(200000u), std::size_t(0u),
+      [](std::size_t lo, std::size_t hi)
+      {
+        std::size_t count = 0u;
+        for(std::size_t i = lo; i < hi; i++)
+        {
+          count += Math::IsPrime(static_cast<std::uint64_t>(i)) ? 1u : 0u;
+        }
+
+        return count;
+      },
+      [](std::size_t a, std::size_t b) { return a + b; }, 1000u, pool);
+    ASSERT_EQ(primes, Math::CountPrimes(0u, 200000u, 1u));
+
+    // Vector normalization element by element
+    std::vector<Vector3<float>> vectors;
+    for(std::size_t i = 0u; i < 10000u; i++)
+    {
+      const float value = static_cast<float>(i);
+      vectors.push_back(Vector3<float>(value - 5000.0f, 1.0f + (value * 0.5f), 3.0f));
+    }
+
+    std::vector<Vector3<float>> normalized(vectors.size());
+    Math::Parallel::Transform(
+      Math::Span<const Vector3<float>>(vectors), Math::Span<Vector3<float>>(normalized), [](const Vector3<float>& value) { return value.ToNormalized(); },
+      256u, pool);
+
+    // Quaternion rotation as a batch kernel per block
+    const Quaternion<float> rotation = Quaternion<float>(0.1f, 0.7f, -0.2f, 0.6f).ToNormalized();
+    std::vector<Vector3<float>> rotated(vectors.size());
+    Math::Parallel::Transform(
+      Math::Span<const Vector3<float>>(vectors), Math::Span<Vector3<float>>(rotated),
+      [&](Math::Span<const Vector3<float>> in, Math::Span<Vector3<float>> out) { Math::Batch::Rotate(rotation, in, out); }, 256u, pool);
+
+    for(std::size_t i = 0u; i < vectors.size(); i++)
+    {
+      ASSERT_TRUE(normalized[i] == vectors[i].ToNormalized());
+      ASSERT_TRUE(rotated[i] == rotation.Rotate(vectors[i]));
+    }
+
+    // Normalize over a buffer, in place
+    std::vector<double> buffer(30001u);
+    std::iota(buffer.begin(), buffer.end(), 0.0);
+    Math::Parallel::Transform(
+      Math::Span<const double>(buffer), Math::Span<double>(buffer),
+      [](Math::Span<const double> in, Math::Span<double> out) { Math::Batch::Normalize01(in, out, 0.0, 30000.0); }, 1024u, pool);
+
+    for(std::size_t i = 0u; i < buffer.size(); i++)
+    {
+      ASSERT_EQ(buffer[i], Math::Normalize01(static_cast<double>(i), 0.0, 30000.0));
+    }
+  }
+
+  TEST(Parallel, DefaultPool)
+  {
+    Math::Parallel::ThreadPool& pool = Math::Parallel::ThreadPool::GetDefault();
+    ASSERT_GE(pool.GetThreadCount(), 1u);
+    ASSERT_EQ(&pool, &Math::Parallel::ThreadPool::GetDefault());
+
+    std::vector<int> values(50000u, 1);
+    std::vector<int> doubled(values.size());
+    Math::Parallel::Transform(Math::Span<const int>(values), Math::Span<int>(doubled), [](int value) { return value * 2; });
+    ASSERT_EQ(Math::Parallel::Reduce(Math::Span<const int>(doubled), 0, [](int a, int b) { return a + b; }), 100000);
+  }
+} // namespace UnitTest
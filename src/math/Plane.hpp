@@ -0,0 +1,76 @@
+#ifndef __MATH__PLANE_HPP__
+#define __MATH__PLANE_HPP__
+
+#include "Common.hpp"
+#include "Vector3.hpp"
+
+#include <type_traits>
+
+namespace Math
+{
+  // Where a volume lies relative to a half-space or a frustum
+  enum class Containment
+  {
+    Outside,
+    Intersecting,
+    Inside
+  };
+} // namespace Math
+
+// Plane of the points p with Dot(normal, p) + offset = 0, the side the normal points to is the inside half-space
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class Plane
+{
+  public:
+  static constexpr Plane<T> FromPointNormal(const Vector3<T>& point, const Vector3<T>& normal)
+  {
+    return Plane<T>(normal, -Vector3<T>::DotProduct(normal, point));
+  }
+
+  // Counter-clockwise a, b, c seen from the inside
+  static Plane<T> FromPoints(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c)
+  {
+    return FromPointNormal(a, Vector3<T>::CrossProduct(b - a, c - a).ToNormalized());
+  }
+
+  constexpr bool operator==(const Plane<T>& rhs) const { return (m_Normal == rhs.m_Normal) && (m_Offset == rhs.m_Offset); }
+  constexpr bool operator!=(const Plane<T>& rhs) const { return !((*this) == rhs); }
+
+  // Signed, and scaled by the normal length unless the plane is normalized
+  constexpr T GetDistance(const Vector3<T>& point) const { return Vector3<T>::DotProduct(m_Normal, point) + m_Offset; }
+
+  constexpr Math::Containment Classify(const Vector3<T>& point) const
+  {
+    const T distance = GetDistance(point);
+    return (distance > static_cast<T>(0)) ? Math::Containment::Inside
+                                          : ((distance < static_cast<T>(0)) ? Math::Containment::Outside : Math::Containment::Intersecting);
+  }
+
+  // Unit normal with the offset scaled alike, so distances become Euclidean
+  Plane<T> ToNormalized() const
+  {
+    const T magnitude = m_Normal.GetMagnitude();
+    return (magnitude != static_cast<T>(0)) ? Plane<T>(m_Normal / magnitude, m_Offset / magnitude) : *this;
+  }
+
+  constexpr Plane<T> ToFlipped() const { return Plane<T>(-m_Normal, -m_Offset); }
+
+  constexpr const Vector3<T>& GetNormal() const { return m_Normal; }
+  constexpr T GetOffset() const { return m_Offset; }
+
+  constexpr Plane(const Vector3<T>& normal, T offset)
+      : m_Normal(normal)
+      , m_Offset(offset)
+  {}
+
+  constexpr Plane()
+      : m_Normal(Vector3<T>::Up)
+      , m_Offset(static_cast<T>(0))
+  {}
+
+  private:
+  Vector3<T> m_Normal;
+  T m_Offset;
+};
+
+#endif // __MATH__PLANE_HPP__
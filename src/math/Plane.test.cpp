@@ -0,0 +1,55 @@
+#include "Plane.hpp"
+#include "Vector3.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class PlaneTyped : public Test
+  {};
+
+  using PlaneTypes = Types<float, double>;
+  TYPED_TEST_SUITE(PlaneTyped, PlaneTypes);
+
+  TYPED_TEST(PlaneTyped, Distance)
+  {
+    using T = TypeParam;
+
+    // z = 2, facing +z
+    const Plane<T> plane = Plane<T>::FromPointNormal(Vector3<T>(static_cast<T>(5), static_cast<T>(-1), static_cast<T>(2)), Vector3<T>::Forward);
+    ASSERT_EQ(plane.GetOffset(), static_cast<T>(-2));
+    ASSERT_EQ(plane.GetDistance(Vector3<T>(static_cast<T>(7), static_cast<T>(3), static_cast<T>(5))), static_cast<T>(3));
+    ASSERT_EQ(plane.GetDistance(Vector3<T>::Zero), static_cast<T>(-2));
+
+    ASSERT_EQ(plane.Classify(Vector3<T>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(3))), Math::Containment::Inside);
+    ASSERT_EQ(plane.Classify(Vector3<T>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(1))), Math::Containment::Outside);
+    ASSERT_EQ(plane.Classify(Vector3<T>(static_cast<T>(9), static_cast<T>(9), static_cast<T>(2))), Math::Containment::Intersecting);
+
+    const Plane<T> flipped = plane.ToFlipped();
+    ASSERT_EQ(flipped.GetDistance(Vector3<T>::Zero), static_cast<T>(2));
+    ASSERT_TRUE(flipped.ToFlipped() == plane);
+  }
+
+  TYPED_TEST(PlaneTyped, Construction)
+  {
+    using T = TypeParam;
+
+    // Counter-clockwise seen from above gives an upward normal
+    const Plane<T> floor = Plane<T>::FromPoints(Vector3<T>(static_cast<T>(0), static_cast<T>(1), static_cast<T>(0)),
+                                                Vector3<T>(static_cast<T>(0), static_cast<T>(1), static_cast<T>(1)),
+                                                Vector3<T>(static_cast<T>(1), static_cast<T>(1), static_cast<T>(0)));
+    ASSERT_TRUE(floor.GetNormal() == Vector3<T>::Up);
+    ASSERT_EQ(floor.GetDistance(Vector3<T>(static_cast<T>(4), static_cast<T>(3), static_cast<T>(-4))), static_cast<T>(2));
+
+    const Plane<T> scaled(Vector3<T>(static_cast<T>(0), static_cast<T>(3), static_cast<T>(4)), static_cast<T>(10));
+    const Plane<T> normalized = scaled.ToNormalized();
+    ASSERT_TRUE(normalized.GetNormal() == Vector3<T>(static_cast<T>(0), static_cast<T>(0.6), static_cast<T>(0.8)));
+    ASSERT_EQ(normalized.GetOffset(), static_cast<T>(2));
+
+    constexpr Plane<T> kDefault;
+    static_assert(kDefault.GetDistance(Vector3<T>(static_cast<T>(1), static_cast<T>(2), static_cast<T>(3))) == static_cast<T>(2));
+  }
+} // namespace UnitTest
@@ -0,0 +1,332 @@
+#ifndef __MATH__POINTCLOUD_HPP__
+#define __MATH__POINTCLOUD_HPP__
+
+#include "Span.hpp"
+#include "Vector3.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MATH_DETAIL_POINTCLOUD_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+ * Binary point cloud, version 1
+ *
+ * A 64 byte header followed by the points exactly as Vector3<T> lays them out in memory, SIMD padding lane included
+ * and zeroed. The header records the scalar type, the element size and alignment of the writer, and the data starts
+ * on a 64 byte boundary, so a reader built with the same layout maps the file and hands out the points in place.
+ * Files are in the byte order of the writer, a reader of the other order rejects them.
+ */
+
+namespace Math
+{
+  enum class PointCloudType : std::uint32_t
+  {
+    Float32 = 1u,
+    Float64 = 2u
+  };
+
+  namespace Detail
+  {
+    struct PointCloudHeader
+    {
+      char m_Magic[8];
+      std::uint32_t m_Version;
+      std::uint32_t m_ByteOrder;
+      std::uint32_t m_Type;
+      std::uint32_t m_ElementSize;
+      std::uint32_t m_ElementAlignment;
+      std::uint32_t m_Reserved;
+      std::uint64_t m_Count;
+      std::uint64_t m_DataOffset;
+      std::uint8_t m_Padding[16];
+    };
+
+    static_assert(std::is_trivially_copyable_v<PointCloudHeader> && (sizeof(PointCloudHeader) == 64u));
+
+    static constexpr char kPointCloudMagic[8]        = {'M', 'A', 'T', 'H', 'P', 'C', 'L', '\0'};
+    static constexpr std::uint32_t kPointCloudVersion = 1u;
+    static constexpr std::uint32_t kPointCloudOrder   = 0x01020304u;
+    static constexpr std::uint64_t kPointCloudOffset  = 64u;
+
+    template<class T>
+    static constexpr bool kPointCloudScalar = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    template<class T>
+    static constexpr PointCloudType kPointCloudType = std::is_same_v<T, float> ? PointCloudType::Float32 : PointCloudType::Float64;
+
+    template<class T>
+    PointCloudHeader CreatePointCloudHeader(std::uint64_t count)
+    {
+      static_assert(alignof(Vector3<T>) <= kPointCloudOffset);
+
+      PointCloudHeader header;
+      std::memset(&header, 0, sizeof(header));
+      std::memcpy(header.m_Magic, kPointCloudMagic, sizeof(kPointCloudMagic));
+      header.m_Version          = kPointCloudVersion;
+      header.m_ByteOrder        = kPointCloudOrder;
+      header.m_Type             = static_cast<std::uint32_t>(kPointCloudType<T>);
+      header.m_ElementSize      = static_cast<std::uint32_t>(sizeof(Vector3<T>));
+      header.m_ElementAlignment = static_cast<std::uint32_t>(alignof(Vector3<T>));
+      header.m_Count            = count;
+      header.m_DataOffset       = kPointCloudOffset;
+      return header;
+    }
+
+    // True when the points of a file of fileSize bytes can be used in place as Vector3<T>
+    template<class T>
+    bool IsPointCloudReadable(const PointCloudHeader& header, std::uint64_t fileSize)
+    {
+      const PointCloudHeader expected = CreatePointCloudHeader<T>(header.m_Count);
+      if((std::memcmp(header.m_Magic, expected.m_Magic, sizeof(header.m_Magic)) != 0) || (header.m_Version != expected.m_Version)
+         || (header.m_ByteOrder != expected.m_ByteOrder) || (header.m_Type != expected.m_Type) || (header.m_ElementSize != expected.m_ElementSize)
+         || (header.m_ElementAlignment != expected.m_ElementAlignment))
+      {
+        return false;
+      }
+
+      // Divides rather than multiplies so a corrupt count cannot overflow past the size check
+      return (header.m_DataOffset >= sizeof(PointCloudHeader)) && ((header.m_DataOffset % alignof(Vector3<T>)) == 0u) && (header.m_DataOffset <= fileSize)
+             && (header.m_Count <= ((fileSize - header.m_DataOffset) / sizeof(Vector3<T>)));
+    }
+  } // namespace Detail
+} // namespace Math
+
+// Streams points to a file, the count in the header is filled in by Close
+template<class T, std::enable_if_t<Math::Detail::kPointCloudScalar<T>, bool> = true>
+class PointCloudWriter
+{
+  public:
+  static constexpr std::size_t kBufferSize = 4096u;
+
+  bool Open(const char* path)
+  {
+    Close();
+    m_File = std::fopen(path, "wb");
+    if(m_File == nullptr)
+    {
+      return false;
+    }
+
+    m_Count = 0u;
+    m_Good  = true;
+    m_Buffer.clear();
+    return WriteHeader();
+  }
+
+  bool Write(const Vector3<T>& point) { return Write(Math::Span<const Vector3<T>>(&point, 1u)); }
+
+  bool Write(Math::Span<const Vector3<T>> points)
+  {
+    assert(IsOpen());
+    for(const Vector3<T>& point : points)
+    {
+      // The padding lane is always zero, so points go to the file byte for byte
+      m_Buffer.push_back(point);
+
+      if(m_Buffer.size() == kBufferSize)
+      {
+        Flush();
+      }
+    }
+
+    return m_Good;
+  }
+
+  // Patches the count into the header, false when any write since Open failed
+  bool Close()
+  {
+    if(!IsOpen())
+    {
+      return false;
+    }
+
+    Flush();
+    m_Good = m_Good && (std::fseek(m_File, 0L, SEEK_SET) == 0) && WriteHeader();
+    m_Good = (std::fclose(m_File) == 0) && m_Good;
+    m_File = nullptr;
+    return m_Good;
+  }
+
+  bool IsOpen() const { return m_File != nullptr; }
+  std::size_t GetCount() const { return m_Count + m_Buffer.size(); }
+
+  PointCloudWriter(const PointCloudWriter&)            = delete;
+  PointCloudWriter& operator=(const PointCloudWriter&) = delete;
+
+  explicit PointCloudWriter(const char* path)
+      : PointCloudWriter()
+  {
+    Open(path);
+  }
+
+  PointCloudWriter()
+      : m_File(nullptr)
+      , m_Count(0u)
+      , m_Good(false)
+  {
+    m_Buffer.reserve(kBufferSize);
+  }
+
+  ~PointCloudWriter() { Close(); }
+
+  private:
+  bool WriteHeader()
+  {
+    const Math::Detail::PointCloudHeader header = Math::Detail::CreatePointCloudHeader<T>(m_Count);
+    m_Good = m_Good && (std::fwrite(&header, sizeof(header), 1u, m_File) == 1u);
+    return m_Good;
+  }
+
+  void Flush()
+  {
+    if(!m_Buffer.empty())
+    {
+      m_Good = m_Good && (std::fwrite(m_Buffer.data(), sizeof(Vector3<T>), m_Buffer.size(), m_File) == m_Buffer.size());
+      m_Count += m_Buffer.size();
+      m_Buffer.clear();
+    }
+  }
+
+  std::FILE* m_File;
+  std::vector<Vector3<T>> m_Buffer;
+  std::size_t m_Count;
+  bool m_Good;
+};
+
+// Maps a file written by PointCloudWriter<T> and exposes its points without copying them. Where mmap is missing the
+// points are read into memory instead, behind the same interface
+template<class T, std::enable_if_t<Math::Detail::kPointCloudScalar<T>, bool> = true>
+class PointCloudReader
+{
+  public:
+  // False when the file cannot be read or was written with another scalar type, element layout or byte order
+  bool Open(const char* path)
+  {
+    Close();
+
+#ifdef MATH_DETAIL_POINTCLOUD_MMAP
+    const int file = ::open(path, O_RDONLY);
+    if(file < 0)
+    {
+      return false;
+    }
+
+    struct stat status;
+    const bool sized = (::fstat(file, &status) == 0) && (static_cast<std::uint64_t>(status.st_size) >= sizeof(Math::Detail::PointCloudHeader));
+    void* mapping    = sized ? ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+    ::close(file);
+    if(mapping == MAP_FAILED)
+    {
+      return false;
+    }
+
+    m_Mapping     = mapping;
+    m_MappingSize = static_cast<std::size_t>(status.st_size);
+
+    Math::Detail::PointCloudHeader header;
+    std::memcpy(&header, m_Mapping, sizeof(header));
+    if(!Math::Detail::IsPointCloudReadable<T>(header, m_MappingSize))
+    {
+      Close();
+      return false;
+    }
+
+    m_Points = Math::Span<const Vector3<T>>(reinterpret_cast<const Vector3<T>*>(static_cast<const unsigned char*>(m_Mapping) + header.m_DataOffset),
+                                            static_cast<std::size_t>(header.m_Count));
+    return true;
+#else
+    std::FILE* file = std::fopen(path, "rb");
+    if(file == nullptr)
+    {
+      return false;
+    }
+
+    Math::Detail::PointCloudHeader header;
+    const bool read = (std::fread(&header, sizeof(header), 1u, file) == 1u) && (std::fseek(file, 0L, SEEK_END) == 0);
+    const long size = read ? std::ftell(file) : -1L;
+    bool result     = (size >= 0L) && Math::Detail::IsPointCloudReadable<T>(header, static_cast<std::uint64_t>(size))
+                  && (std::fseek(file, static_cast<long>(header.m_DataOffset), SEEK_SET) == 0);
+    if(result)
+    {
+      m_Storage.resize(static_cast<std::size_t>(header.m_Count));
+      result   = (std::fread(m_Storage.data(), sizeof(Vector3<T>), m_Storage.size(), file) == m_Storage.size());
+      m_Points = Math::Span<const Vector3<T>>(m_Storage.data(), m_Storage.size());
+    }
+
+    std::fclose(file);
+    if(!result)
+    {
+      Close();
+    }
+
+    return result;
+#endif
+  }
+
+  void Close()
+  {
+#ifdef MATH_DETAIL_POINTCLOUD_MMAP
+    if(m_Mapping != nullptr)
+    {
+      ::munmap(m_Mapping, m_MappingSize);
+    }
+
+    m_Mapping     = nullptr;
+    m_MappingSize = 0u;
+#else
+    m_Storage.clear();
+#endif
+    m_Points = Math::Span<const Vector3<T>>();
+  }
+
+  // Valid until Close, Open or destruction
+  Math::Span<const Vector3<T>> GetPoints() const { return m_Points; }
+  std::size_t GetSize() const { return m_Points.GetSize(); }
+
+  PointCloudReader(const PointCloudReader&)            = delete;
+  PointCloudReader& operator=(const PointCloudReader&) = delete;
+
+  explicit PointCloudReader(const char* path)
+      : PointCloudReader()
+  {
+    Open(path);
+  }
+
+  PointCloudReader()
+#ifdef MATH_DETAIL_POINTCLOUD_MMAP
+      : m_Mapping(nullptr)
+      , m_MappingSize(0u)
+      , m_Points()
+#else
+      : m_Storage()
+      , m_Points()
+#endif
+  {}
+
+  ~PointCloudReader() { Close(); }
+
+  private:
+#ifdef MATH_DETAIL_POINTCLOUD_MMAP
+  void* m_Mapping;
+  std::size_t m_MappingSize;
+#else
+  std::vector<Vector3<T>> m_Storage;
+#endif
+  Math::Span<const Vector3<T>> m_Points;
+};
+
+#undef MATH_DETAIL_POINTCLOUD_MMAP
+
+#endif // __MATH__POINTCLOUD_HPP__
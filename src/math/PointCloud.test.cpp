@@ -0,0 +1,154 @@
+#include "PointCloud.hpp"
+#include "Fixed.hpp"
+#include "Quaternion.hpp"
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class PointCloudTyped : public Test
+  {};
+
+  using PointCloudTypes = Types<float, double>;
+  TYPED_TEST_SUITE(PointCloudTyped, PointCloudTypes);
+
+  template<class T>
+  static std::string CreatePath(const char* name)
+  {
+    return TempDir() + "math_" + name + "_" + std::to_string(sizeof(T)) + ".pcl";
+  }
+
+  template<class T>
+  static std::vector<Vector3<T>> CreatePoints(std::size_t count)
+  {
+    std::vector<Vector3<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T value = static_cast<T>(i);
+      result.push_back(Vector3<T>(value, -value * static_cast<T>(0.5), value + static_cast<T>(0.25)));
+    }
+
+    return result;
+  }
+
+  TEST(PointCloud, TriviallyCopyable)
+  {
+    ASSERT_TRUE(std::is_trivially_copyable_v<Vector2<int>>);
+    ASSERT_TRUE(std::is_trivially_copyable_v<Vector3<int>>);
+    ASSERT_TRUE((std::is_trivially_copyable_v<Vector2<Fixed<16, 16>>>));
+    ASSERT_TRUE(std::is_standard_layout_v<Quaternion<float>>);
+
+    // Bulk copies of whole arrays now go through memcpy
+    const std::vector<Vector3<float>> points = CreatePoints<float>(5u);
+    std::vector<Vector3<float>> copy(points.size());
+    std::memcpy(static_cast<void*>(copy.data()), points.data(), points.size() * sizeof(Vector3<float>));
+    ASSERT_EQ(copy, points);
+  }
+
+  TYPED_TEST(PointCloudTyped, RoundTrip)
+  {
+    using T = TypeParam;
+
+    // Spans several writer buffers and ends on a partial one
+    const std::string path                = CreatePath<T>("roundtrip");
+    const std::vector<Vector3<T>> points = CreatePoints<T>((2u * PointCloudWriter<T>::kBufferSize) + 123u);
+    {
+      PointCloudWriter<T> writer(path.c_str());
+      ASSERT_TRUE(writer.IsOpen());
+      ASSERT_TRUE(writer.Write(Math::Span<const Vector3<T>>(points).Subspan(0u, 100u)));
+      ASSERT_TRUE(writer.Write(points[100]));
+      ASSERT_TRUE(writer.Write(Math::Span<const Vector3<T>>(points).Subspan(101u)));
+      ASSERT_EQ(writer.GetCount(), points.size());
+      ASSERT_TRUE(writer.Close());
+      ASSERT_FALSE(writer.IsOpen());
+    }
+
+    PointCloudReader<T> reader(path.c_str());
+    ASSERT_EQ(reader.GetSize(), points.size());
+
+    const Math::Span<const Vector3<T>> loaded = reader.GetPoints();
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(loaded.GetData()) % alignof(Vector3<T>), 0u);
+    for(std::size_t i = 0u; i < points.size(); i++)
+    {
+      ASSERT_EQ(loaded[i], points[i]);
+    }
+
+    reader.Close();
+    ASSERT_TRUE(reader.GetPoints().IsEmpty());
+    std::remove(path.c_str());
+  }
+
+  TYPED_TEST(PointCloudTyped, Empty)
+  {
+    using T = TypeParam;
+
+    const std::string path = CreatePath<T>("empty");
+    {
+      PointCloudWriter<T> writer(path.c_str());
+      ASSERT_TRUE(writer.Close());
+    }
+
+    PointCloudReader<T> reader;
+    ASSERT_TRUE(reader.Open(path.c_str()));
+    ASSERT_EQ(reader.GetSize(), 0u);
+    std::remove(path.c_str());
+  }
+
+  TYPED_TEST(PointCloudTyped, Rejects)
+  {
+    using T     = TypeParam;
+    using Other = std::conditional_t<std::is_same_v<T, float>, double, float>;
+
+    PointCloudReader<T> reader;
+    ASSERT_FALSE(reader.Open(CreatePath<T>("missing").c_str()));
+
+    // Written as the other scalar type
+    const std::string path = CreatePath<T>("rejects");
+    {
+      const std::vector<Vector3<Other>> points = CreatePoints<Other>(10u);
+      PointCloudWriter<Other> writer(path.c_str());
+      writer.Write(points);
+    }
+
+    ASSERT_FALSE(reader.Open(path.c_str()));
+    ASSERT_TRUE(PointCloudReader<Other>(path.c_str()).GetSize() == 10u);
+
+    // Truncated in the middle of the points
+    {
+      const std::vector<Vector3<T>> points = CreatePoints<T>(10u);
+      PointCloudWriter<T> writer(path.c_str());
+      writer.Write(points);
+    }
+
+    std::vector<unsigned char> bytes(64u + (5u * sizeof(Vector3<T>)));
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(std::fread(bytes.data(), 1u, bytes.size(), file), bytes.size());
+    std::fclose(file);
+    file = std::fopen(path.c_str(), "wb");
+    ASSERT_EQ(std::fwrite(bytes.data(), 1u, bytes.size(), file), bytes.size());
+    std::fclose(file);
+    ASSERT_FALSE(reader.Open(path.c_str()));
+
+    // Not a point cloud at all
+    bytes[0] = 'X';
+    file     = std::fopen(path.c_str(), "wb");
+    ASSERT_EQ(std::fwrite(bytes.data(), 1u, bytes.size(), file), bytes.size());
+    std::fclose(file);
+    ASSERT_FALSE(reader.Open(path.c_str()));
+    ASSERT_TRUE(reader.GetPoints().IsEmpty());
+    std::remove(path.c_str());
+  }
+} // namespace UnitTest
@@ -0,0 +1,134 @@
+#ifndef __MATH__PRECISION_HPP__
+#define __MATH__PRECISION_HPP__
+
+#include "Common.hpp"
+#include "Simd.hpp"
+
+#include <limits>
+#include <type_traits>
+
+/*
+ * Precision policies for square roots and their reciprocals, passed as tags to the magnitude and normalization
+ * overloads of the vector types. Relative error bounds against the exact result:
+ *
+ *   Exact   correctly rounded std::sqrt, normalization divides by the magnitude
+ *   Fast    hardware estimate refined by one Newton-Raphson step, 2^-21 for float and 2^-22 for double
+ *   Approx  hardware estimate alone, 1.5 * 2^-12
+ *
+ * The estimate is the single precision instruction for every type, so only positive inputs within the normal float
+ * range take it. Zeros, subnormals, infinities and values beyond that range, constant evaluation, non floating point
+ * types and targets without SSE all fall back to the exact path. Normalized vectors and magnitudes pick up one more
+ * rounding on top of the bound of the reciprocal.
+ */
+namespace Math::Precision
+{
+  struct Exact
+  {};
+
+  struct Fast
+  {};
+
+  struct Approx
+  {};
+
+  template<class P>
+  constexpr bool kPolicy = std::is_same_v<P, Exact> || std::is_same_v<P, Fast> || std::is_same_v<P, Approx>;
+
+#if defined(MATH_SIMD_SSE)
+  constexpr bool kHardware = true;
+#else
+  constexpr bool kHardware = false;
+#endif
+
+  // Whether the policy takes the estimate path for T at all
+  template<class P, class T>
+  constexpr bool kEstimated = kHardware && std::is_floating_point_v<T> && !std::is_same_v<P, Exact>;
+} // namespace Math::Precision
+
+namespace Math::Detail
+{
+  // Inputs the single precision estimate handles, the bounds keep the conversion to float and the result finite
+  template<class T>
+  constexpr T kEstimateMin = static_cast<T>(std::numeric_limits<float>::min());
+
+  template<class T>
+  constexpr T kEstimateMax = static_cast<T>(std::numeric_limits<float>::max());
+
+  template<class T>
+  inline T ReciprocalSqrtEstimate(T value)
+  {
+#if defined(MATH_SIMD_SSE)
+    return static_cast<T>(_mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(static_cast<float>(value)))));
+#else
+    return static_cast<T>(1) / static_cast<T>(std::sqrt(value));
+#endif
+  }
+
+  // y * (3 - x * y * y) / 2, which squares the relative error of the estimate y
+  template<class T>
+  constexpr T NewtonReciprocalSqrt(T value, T estimate)
+  {
+    return estimate * (static_cast<T>(1.5) - ((static_cast<T>(0.5) * value) * (estimate * estimate)));
+  }
+
+  // Packed form of the two above for registers whose lanes all lie within the estimate range
+  template<class P, class R>
+  inline R ReciprocalSqrtRegister(R value)
+  {
+    using T          = decltype(Math::Simd::HorizontalSum(value));
+    const R estimate = Math::Simd::ReciprocalSqrtEstimate(value);
+    if constexpr(std::is_same_v<P, Math::Precision::Fast>)
+    {
+      const R half   = Math::Simd::Multiply(Math::Simd::Broadcast(static_cast<T>(0.5)), value);
+      const R factor = Math::Simd::Subtract(Math::Simd::Broadcast(static_cast<T>(1.5)), Math::Simd::Multiply(half, Math::Simd::Multiply(estimate, estimate)));
+      return Math::Simd::Multiply(estimate, factor);
+    }
+    else
+    {
+      return estimate;
+    }
+  }
+} // namespace Math::Detail
+
+namespace Math
+{
+  // 1 / sqrt(value) to the precision of the policy
+  template<class T, class P, std::enable_if_t<std::is_floating_point_v<T> && Precision::kPolicy<P>, bool> = true>
+  constexpr T ReciprocalSqrt(T value, P)
+  {
+    if constexpr(Precision::kEstimated<P, T>)
+    {
+      if(!Detail::IsConstantEvaluated() && (value >= Detail::kEstimateMin<T>) && (value <= Detail::kEstimateMax<T>))
+      {
+        const T estimate = Detail::ReciprocalSqrtEstimate(value);
+        if constexpr(std::is_same_v<P, Precision::Fast>)
+        {
+          return Detail::NewtonReciprocalSqrt(value, estimate);
+        }
+        else
+        {
+          return estimate;
+        }
+      }
+    }
+
+    return static_cast<T>(1) / Math::Sqrt(value);
+  }
+
+  // Math::Sqrt to the precision of the policy, estimated roots are value * (1 / sqrt(value))
+  template<class T, class P, std::enable_if_t<Precision::kPolicy<P>, bool> = true>
+  constexpr auto Sqrt(T value, P)
+  {
+    if constexpr(Precision::kEstimated<P, T>)
+    {
+      if(!Detail::IsConstantEvaluated() && (value >= Detail::kEstimateMin<T>) && (value <= Detail::kEstimateMax<T>))
+      {
+        return value * ReciprocalSqrt(value, P());
+      }
+    }
+
+    return Math::Sqrt(value);
+  }
+} // namespace Math
+
+#endif // __MATH__PRECISION_HPP__
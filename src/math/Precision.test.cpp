@@ -0,0 +1,222 @@
+#include "Precision.hpp"
+#include "Fixed.hpp"
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class PrecisionTyped : public Test
+  {};
+
+  using PrecisionTypes = Types<float, double>;
+  TYPED_TEST_SUITE(PrecisionTyped, PrecisionTypes);
+
+  // The documented relative bounds of the reciprocal, results built from it get two more roundings of slack
+  template<class T>
+  static double Bound(Math::Precision::Exact)
+  {
+    return 2.0 * static_cast<double>(std::numeric_limits<T>::epsilon());
+  }
+
+  template<class T>
+  static double Bound(Math::Precision::Fast)
+  {
+    return std::ldexp(1.0, std::is_same_v<T, float> ? -21 : -22) + Bound<T>(Math::Precision::Exact());
+  }
+
+  template<class T>
+  static double Bound(Math::Precision::Approx)
+  {
+    return std::ldexp(1.5, -12) + Bound<T>(Math::Precision::Exact());
+  }
+
+  static double RelativeError(double value, double expected)
+  {
+    return (value == expected) ? 0.0 : std::fabs((value / expected) - 1.0);
+  }
+
+  template<class T, class P>
+  static void CheckReciprocalSqrt(P policy)
+  {
+    for(int exponent = -120; exponent <= 120; exponent += 3)
+    {
+      for(double mantissa = 1.0; mantissa < 2.0; mantissa += 0.0371)
+      {
+        const T value         = static_cast<T>(std::ldexp(mantissa, exponent));
+        const double expected = 1.0 / std::sqrt(static_cast<double>(value));
+        ASSERT_LE(RelativeError(static_cast<double>(Math::ReciprocalSqrt(value, policy)), expected), Bound<T>(policy)) << value;
+        ASSERT_LE(RelativeError(static_cast<double>(Math::Sqrt(value, policy)), 1.0 / expected), Bound<T>(policy)) << value;
+      }
+    }
+
+    // Outside the normal float range everything is exact
+    constexpr T kInfinity = std::numeric_limits<T>::infinity();
+    const T subnormal     = std::numeric_limits<T>::denorm_min() * static_cast<T>(64);
+    ASSERT_EQ(Math::ReciprocalSqrt(static_cast<T>(0), policy), kInfinity);
+    ASSERT_EQ(Math::ReciprocalSqrt(kInfinity, policy), static_cast<T>(0));
+    ASSERT_EQ(Math::ReciprocalSqrt(subnormal, policy), static_cast<T>(1) / std::sqrt(subnormal));
+    ASSERT_EQ(Math::Sqrt(static_cast<T>(0), policy), static_cast<T>(0));
+    ASSERT_EQ(Math::Sqrt(kInfinity, policy), kInfinity);
+    ASSERT_EQ(Math::Sqrt(subnormal, policy), std::sqrt(subnormal));
+    ASSERT_TRUE(std::isnan(Math::Sqrt(static_cast<T>(-1), policy)));
+  }
+
+  TYPED_TEST(PrecisionTyped, ReciprocalSqrt)
+  {
+    using T = TypeParam;
+
+    CheckReciprocalSqrt<T>(Math::Precision::Exact());
+    CheckReciprocalSqrt<T>(Math::Precision::Fast());
+    CheckReciprocalSqrt<T>(Math::Precision::Approx());
+
+    ASSERT_EQ(Math::Sqrt(static_cast<T>(2), Math::Precision::Exact()), std::sqrt(static_cast<T>(2)));
+    if constexpr(std::is_same_v<T, double>)
+    {
+      ASSERT_EQ(Math::Sqrt(1e300, Math::Precision::Approx()), 1e150);
+    }
+
+    // Constant evaluation always takes the exact path
+    static_assert(Math::Sqrt(static_cast<T>(6.25), Math::Precision::Approx()) == static_cast<T>(2.5));
+    static_assert(Math::ReciprocalSqrt(static_cast<T>(0.25), Math::Precision::Fast()) == static_cast<T>(2));
+  }
+
+  template<class T, class P>
+  static void CheckVectors(P policy)
+  {
+    const double bound = Bound<T>(policy);
+    for(int i = -40; i < 40; i++)
+    {
+      const T x = static_cast<T>(i) * static_cast<T>(0.37);
+      const T y = static_cast<T>(1.5) - (static_cast<T>(i) * static_cast<T>(0.11));
+      const T z = static_cast<T>(std::ldexp(1.0, i / 4));
+
+      const Vector2<T> planar(x, y);
+      const Vector3<T> spatial(x, y, z);
+      const Quaternion<T> rotation(x, y, z, static_cast<T>(0.5));
+
+      ASSERT_LE(RelativeError(static_cast<double>(planar.GetMagnitude(policy)), static_cast<double>(planar.GetMagnitude())), bound);
+      ASSERT_LE(RelativeError(static_cast<double>(spatial.GetMagnitude(policy)), static_cast<double>(spatial.GetMagnitude())), bound);
+      ASSERT_LE(RelativeError(static_cast<double>(rotation.GetMagnitude(policy)), static_cast<double>(rotation.GetMagnitude())), bound);
+
+      const Vector2<T> unitPlanar    = planar.ToNormalized(policy);
+      const Vector3<T> unitSpatial   = spatial.ToNormalized(policy);
+      const Quaternion<T> unitRotate = rotation.ToNormalized(policy);
+      ASSERT_LE(RelativeError(static_cast<double>(unitPlanar.GetY()), static_cast<double>(planar.ToNormalized().GetY())), bound);
+      ASSERT_LE(RelativeError(static_cast<double>(unitSpatial.GetZ()), static_cast<double>(spatial.ToNormalized().GetZ())), bound);
+      ASSERT_LE(RelativeError(static_cast<double>(unitRotate.GetW()), static_cast<double>(rotation.ToNormalized().GetW())), bound);
+    }
+
+    ASSERT_TRUE(Vector2<T>().ToNormalized(policy) == Vector2<T>());
+    ASSERT_TRUE(Vector3<T>().ToNormalized(policy) == Vector3<T>());
+    ASSERT_EQ(Quaternion<T>(0, 0, 0, 0).ToNormalized(policy).GetW(), static_cast<T>(0));
+    ASSERT_EQ(Vector3<T>().GetMagnitude(policy), static_cast<T>(0));
+  }
+
+  TYPED_TEST(PrecisionTyped, Vectors)
+  {
+    using T = TypeParam;
+
+    CheckVectors<T>(Math::Precision::Exact());
+    CheckVectors<T>(Math::Precision::Fast());
+    CheckVectors<T>(Math::Precision::Approx());
+
+    // The exact policy is the plain overload
+    const Vector3<T> value(static_cast<T>(0.3), static_cast<T>(-1.7), static_cast<T>(2.9));
+    ASSERT_TRUE(value.ToNormalized(Math::Precision::Exact()) == value.ToNormalized());
+    ASSERT_EQ(value.GetMagnitude(Math::Precision::Exact()), value.GetMagnitude());
+
+    constexpr Vector2<T> kPlanar = Vector2<T>(static_cast<T>(-3), static_cast<T>(4)).ToNormalized(Math::Precision::Approx());
+    static_assert(kPlanar == Vector2<T>(static_cast<T>(-0.6), static_cast<T>(0.8)));
+    static_assert(Vector3<T>(static_cast<T>(2), static_cast<T>(3), static_cast<T>(6)).GetMagnitude(Math::Precision::Fast()) == static_cast<T>(7));
+  }
+
+  template<class T, class P>
+  static void CheckBatch(P policy)
+  {
+    // Zeros, tiny and huge vectors sit in the middle of packed blocks to force the scalar fallback
+    std::vector<Vector3<T>> vectors;
+    for(std::size_t i = 0u; i < 41u; i++)
+    {
+      const T value = static_cast<T>(i);
+      const T y     = (value * static_cast<T>(0.5)) + static_cast<T>(1);
+      vectors.push_back(Vector3<T>(value - static_cast<T>(20), y, static_cast<T>(3) - (value * static_cast<T>(0.25))));
+    }
+
+    const T huge       = std::sqrt(std::numeric_limits<T>::max()) * static_cast<T>(0.5);
+    const T tiny       = std::sqrt(std::numeric_limits<T>::min()) * static_cast<T>(0.5);
+    vectors[5]         = Vector3<T>();
+    vectors[10]        = Vector3<T>(tiny, -tiny, tiny);
+    vectors[22]        = Vector3<T>(huge, static_cast<T>(1), -huge);
+    const double bound = Bound<T>(policy);
+
+    const Vector3Array<T> array(vectors);
+    std::vector<T> magnitudes(vectors.size());
+    Vector3Array<T> normalized;
+    Math::Batch::Magnitude(array, Math::Span<T>(magnitudes), policy);
+    Math::Batch::Normalize(array, normalized, policy);
+
+    Vector3Array<T> inPlace(vectors);
+    Math::Batch::Normalize(inPlace, inPlace, policy);
+
+    for(std::size_t i = 0u; i < vectors.size(); i++)
+    {
+      const Vector3<T> expected = vectors[i].ToNormalized();
+      if(i == 5u)
+      {
+        ASSERT_EQ(magnitudes[i], static_cast<T>(0));
+        ASSERT_TRUE(normalized[i] == Vector3<T>());
+        continue;
+      }
+
+      ASSERT_LE(RelativeError(static_cast<double>(magnitudes[i]), static_cast<double>(vectors[i].GetMagnitude())), bound) << i;
+      ASSERT_LE(RelativeError(static_cast<double>(normalized[i].GetX()), static_cast<double>(expected.GetX())), bound) << i;
+      ASSERT_LE(RelativeError(static_cast<double>(normalized[i].GetZ()), static_cast<double>(expected.GetZ())), bound) << i;
+      ASSERT_EQ(inPlace[i].GetY(), normalized[i].GetY());
+    }
+
+    std::vector<Quaternion<T>> rotations;
+    for(std::size_t i = 0u; i < 13u; i++)
+    {
+      const T value = static_cast<T>(i);
+      rotations.push_back(Quaternion<T>(value, static_cast<T>(1) - value, static_cast<T>(0.5), value * value));
+    }
+
+    std::vector<Quaternion<T>> units(rotations.size());
+    Math::Batch::Normalize(Math::Span<const Quaternion<T>>(rotations), Math::Span<Quaternion<T>>(units), policy);
+    for(std::size_t i = 0u; i < rotations.size(); i++)
+    {
+      ASSERT_LE(RelativeError(static_cast<double>(units[i].GetZ()), static_cast<double>(rotations[i].ToNormalized().GetZ())), bound);
+    }
+  }
+
+  TYPED_TEST(PrecisionTyped, Batch)
+  {
+    using T = TypeParam;
+
+    CheckBatch<T>(Math::Precision::Exact());
+    CheckBatch<T>(Math::Precision::Fast());
+    CheckBatch<T>(Math::Precision::Approx());
+  }
+
+  TEST(Precision, Fixed)
+  {
+    // Non floating point scalars always take the exact path
+    using Q16 = Fixed<16, 16>;
+
+    const Vector3<Q16> value(Q16(3), Q16(4), Q16(12));
+    ASSERT_EQ(value.GetMagnitude(Math::Precision::Approx()), Q16(13));
+    ASSERT_TRUE(value.ToNormalized(Math::Precision::Fast()) == value.ToNormalized());
+  }
+} // namespace UnitTest
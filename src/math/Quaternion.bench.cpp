@@ -0,0 +1,87 @@
+#include "Benchmark.hpp"
+#include "Quaternion.hpp"
+#include "Vector3.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace Benchmark
+{
+  template<class T>
+  static std::vector<Quaternion<T>> CreateQuaternions(std::size_t count)
+  {
+    std::vector<Quaternion<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const std::size_t index = 4u * i;
+      result.push_back(Quaternion<T>(CreateScalar<T>(index), CreateScalar<T>(index + 1u), CreateScalar<T>(index + 2u), CreateScalar<T>(index + 3u)));
+    }
+
+    return result;
+  }
+
+  // Unit quaternions for the rotation and blending paths, which assume them
+  template<class T>
+  static std::vector<Quaternion<T>> CreateRotations(std::size_t count)
+  {
+    std::vector<Quaternion<T>> result = CreateQuaternions<T>(count);
+    for(Quaternion<T>& value : result)
+    {
+      value = value.ToNormalized();
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static bool RegisterQuaternion()
+  {
+    using Q           = Quaternion<T>;
+    const auto create = &CreateQuaternions<T>;
+    const T scalar    = static_cast<T>(3);
+
+    RegisterBinary(Name<T>("Quaternion_Equal"), create, [](const Q& a, const Q& b) { return a == b; });
+    RegisterBinary(Name<T>("Quaternion_NotEqual"), create, [](const Q& a, const Q& b) { return a != b; });
+    RegisterUnary(Name<T>("Quaternion_Valid"), create, [](const Q& value) { return static_cast<bool>(value); });
+    RegisterBinary(Name<T>("Quaternion_Add"), create, [](const Q& a, const Q& b) { return a + b; });
+    RegisterBinary(Name<T>("Quaternion_Subtract"), create, [](const Q& a, const Q& b) { return a - b; });
+    RegisterBinary(Name<T>("Quaternion_Multiply"), create, [](const Q& a, const Q& b) { return a * b; });
+    RegisterBinary(Name<T>("Quaternion_Divide"), create, [](const Q& a, const Q& b) { return a / b; });
+    RegisterUnary(Name<T>("Quaternion_DivideScalar"), create, [=](const Q& value) { return value / scalar; });
+    RegisterBinary(Name<T>("Quaternion_AddAssign"), create, [](Q a, const Q& b) { return a += b; });
+    RegisterBinary(Name<T>("Quaternion_SubtractAssign"), create, [](Q a, const Q& b) { return a -= b; });
+    RegisterBinary(Name<T>("Quaternion_MultiplyAssign"), create, [](Q a, const Q& b) { return a *= b; });
+    RegisterBinary(Name<T>("Quaternion_DivideAssign"), create, [](Q a, const Q& b) { return a /= b; });
+    RegisterUnary(Name<T>("Quaternion_Scale"), create, [=](const Q& value) { return value.Scale(scalar); });
+    RegisterBinary(Name<T>("Quaternion_DotProduct"), create, [](const Q& a, const Q& b) { return Q::DotProduct(a, b); });
+    RegisterUnary(Name<T>("Quaternion_GetSquareMagnitude"), create, [](const Q& value) { return value.GetSquareMagnitude(); });
+    RegisterUnary(Name<T>("Quaternion_GetMagnitude"), create, [](const Q& value) { return value.GetMagnitude(); });
+    RegisterUnary(Name<T>("Quaternion_Inverse"), create, [](const Q& value) { return value.Inverse(); });
+    RegisterUnary(Name<T>("Quaternion_ToNormalized"), create, [](const Q& value) { return value.ToNormalized(); });
+    RegisterBinary(Name<T>("Quaternion_Chain"), create, [](const Q& a, const Q& b) { return ((a * b) + a).ToNormalized(); });
+    RegisterUnary(Name<T>("Quaternion_ToConjugate"), create, [](const Q& value) { return value.ToConjugate(); });
+    RegisterUnary(Name<T>("Quaternion_Rotate"), create, [](const Q& value) { return value.Rotate(Vector3<T>::One); });
+
+    if constexpr(std::is_floating_point_v<T>)
+    {
+      const auto rotations = &CreateRotations<T>;
+      const T fraction     = static_cast<T>(0.3);
+
+      RegisterUnary(Name<T>("Quaternion_GetMagnitudeFast"), create, [](const Q& value) { return value.GetMagnitude(Math::Precision::Fast()); });
+      RegisterUnary(Name<T>("Quaternion_GetMagnitudeApprox"), create, [](const Q& value) { return value.GetMagnitude(Math::Precision::Approx()); });
+      RegisterUnary(Name<T>("Quaternion_ToNormalizedFast"), create, [](const Q& value) { return value.ToNormalized(Math::Precision::Fast()); });
+      RegisterUnary(Name<T>("Quaternion_ToNormalizedApprox"), create, [](const Q& value) { return value.ToNormalized(Math::Precision::Approx()); });
+      RegisterUnary(Name<T>("Quaternion_FromAxisAngle"),
+                    create,
+                    [](const Q& value) { return Q::FromAxisAngle(Vector3<T>(value.GetX(), value.GetY(), value.GetZ()), value.GetW()); });
+      RegisterBinary(Name<T>("Quaternion_Nlerp"), rotations, [=](const Q& a, const Q& b) { return Q::Nlerp(a, b, fraction); });
+      RegisterBinary(Name<T>("Quaternion_Slerp"), rotations, [=](const Q& a, const Q& b) { return Q::Slerp(a, b, fraction); });
+      RegisterBinary(Name<T>("Quaternion_ApproximateSlerp"), rotations, [=](const Q& a, const Q& b) { return Q::ApproximateSlerp(a, b, fraction); });
+    }
+
+    return true;
+  }
+
+  static const bool kQuaternionRegistered = RegisterQuaternion<float>() && RegisterQuaternion<double>() && RegisterQuaternion<int>();
+} // namespace Benchmark
@@ -1,145 +1,431 @@
 #ifndef __MATH__QUATERNION_HPP__
 #define __MATH__QUATERNION_HPP__
 
-#include <cmath>
+#include "Common.hpp"
+#include "Simd.hpp"
+#include "Vector3.hpp"
+
+#include <cstddef>
+#include <limits>
 #include <type_traits>
 
-template<class T, std::enable_if_t<std::is_arithmetic_v<T> && std::is_signed_v<T>, bool> = true>
-class Quaternion
+namespace Math::Detail
+{
+  // Slerp weights from D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP": sin(t * theta) / sin(theta) expanded as a
+  // polynomial in cos(theta) - 1, evaluated without trigonometry or division. The weight error stays below 3e-5 over the whole
+  // range and below 1e-6 for rotations less than 120 degrees apart. Written over plain arrays so a block of blends vectorizes.
+  template<class T>
+  constexpr void ApproximateSlerpWeights(const T* cosines, const T* fractions, T* fromWeights, T* toWeights, std::size_t count)
+  {
+    constexpr std::size_t kTerms = 8u;
+    constexpr T kOnePlusMu       = static_cast<T>(1.90110745351730037);
+    constexpr T kU[kTerms]       = {static_cast<T>(1.0 / 3.0),
+                                    static_cast<T>(1.0 / 10.0),
+                                    static_cast<T>(1.0 / 21.0),
+                                    static_cast<T>(1.0 / 36.0),
+                                    static_cast<T>(1.0 / 55.0),
+                                    static_cast<T>(1.0 / 78.0),
+                                    static_cast<T>(1.0 / 105.0),
+                                    kOnePlusMu / static_cast<T>(136)};
+    constexpr T kV[kTerms]       = {static_cast<T>(1.0 / 3.0),
+                                    static_cast<T>(2.0 / 5.0),
+                                    static_cast<T>(3.0 / 7.0),
+                                    static_cast<T>(4.0 / 9.0),
+                                    static_cast<T>(5.0 / 11.0),
+                                    static_cast<T>(6.0 / 13.0),
+                                    static_cast<T>(7.0 / 15.0),
+                                    kOnePlusMu * static_cast<T>(8.0 / 17.0)};
+    constexpr T kZero            = static_cast<T>(0);
+    constexpr T kOne             = static_cast<T>(1);
+
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      // Blending towards the negated target when the cosine is negative takes the shorter arc
+      const T sign      = (cosines[i] < kZero) ? -kOne : kOne;
+      const T xMinusOne = (cosines[i] * sign) - kOne;
+      const T t         = fractions[i];
+      const T d         = kOne - t;
+      const T squareT   = t * t;
+      const T squareD   = d * d;
+
+      T weightT = kOne;
+      T weightD = kOne;
+      for(std::size_t j = kTerms; j-- > 0u;)
+      {
+        weightT = kOne + (((kU[j] * squareT) - kV[j]) * xMinusOne * weightT);
+        weightD = kOne + (((kU[j] * squareD) - kV[j]) * xMinusOne * weightD);
+      }
+
+      fromWeights[i] = d * weightD;
+      toWeights[i]   = sign * t * weightT;
+    }
+  }
+
+  // Half angles up to this take the series in ExponentialFactors
+  template<class T>
+  static constexpr T kExponentialSeriesAngle = static_cast<T>(0.1);
+
+  // Taylor coefficients of sin(x) / x and cos(x) in x^2, after the leading one
+  template<class T>
+  static constexpr T kExponentialSine[4] = {static_cast<T>(-1.0 / 6.0),
+                                            static_cast<T>(1.0 / 120.0),
+                                            static_cast<T>(-1.0 / 5040.0),
+                                            static_cast<T>(1.0 / 362880.0)};
+
+  template<class T>
+  static constexpr T kExponentialCosine[4] = {static_cast<T>(-1.0 / 2.0),
+                                              static_cast<T>(1.0 / 24.0),
+                                              static_cast<T>(-1.0 / 720.0),
+                                              static_cast<T>(1.0 / 40320.0)};
+
+  // Integrated orientations are renormalized once their square magnitude is further than this from one
+  template<class T>
+  static constexpr T kIntegrationDrift = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+
+  // exp(v) = (v sin|v| / |v|, cos|v|) from the square of the half angle |v|. Up to kExponentialSeriesAngle both factors
+  // come from their Taylor series through the eighth power, the first omitted term stays below double epsilon there.
+  template<class T>
+  constexpr void ExponentialFactors(T square, T& sinc, T& cosine)
+  {
+    constexpr T kLimit = kExponentialSeriesAngle<T> * kExponentialSeriesAngle<T>;
+    constexpr T kOne   = static_cast<T>(1);
+
+    if(square <= kLimit)
+    {
+      constexpr const T* kSine   = kExponentialSine<T>;
+      constexpr const T* kCosine = kExponentialCosine<T>;
+
+      sinc   = kOne + (square * (kSine[0] + (square * (kSine[1] + (square * (kSine[2] + (square * kSine[3])))))));
+      cosine = kOne + (square * (kCosine[0] + (square * (kCosine[1] + (square * (kCosine[2] + (square * kCosine[3])))))));
+      return;
+    }
+
+    const T angle = static_cast<T>(Math::Sqrt(square));
+    sinc          = Math::Sin(angle) / angle;
+    cosine        = Math::Cos(angle);
+  }
+} // namespace Math::Detail
+
+template<class T, std::enable_if_t<Math::kSignedScalar<T>, bool> = true>
+class alignas(Math::Simd::Traits<T>::kAlignment) Quaternion
 {
   public:
   static constexpr Quaternion<T> Invalid  = Quaternion<T>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
   static constexpr Quaternion<T> Identity = Quaternion<T>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1));
 
-  operator bool() const { return (*this) != Quaternion<T>::Invalid; }
-
-  bool operator==(const Quaternion<T>& rhs) const { return (m_W == rhs.m_W) && (m_X == rhs.m_X) && (m_Y == rhs.m_Y) && (m_Z == rhs.m_Z); }
+  static constexpr Quaternion<T> FromAxisAngle(const Vector3<T>& axis, T angle)
+  {
+    const Vector3<T> unitAxis = axis.ToNormalized();
+    const T halfAngle         = angle / static_cast<T>(2);
+    const T sine              = Math::Sin(halfAngle);
 
-  bool operator!=(const Quaternion<T>& rhs) const { return (m_W != rhs.m_W) || (m_X != rhs.m_X) || (m_Y != rhs.m_Y) || (m_Z != rhs.m_Z); }
+    return Quaternion<T>(unitAxis.GetX() * sine, unitAxis.GetY() * sine, unitAxis.GetZ() * sine, Math::Cos(halfAngle));
+  }
 
-  Quaternion<T> operator+(const Quaternion& rhs) const { return Quaternion<T>(m_W + rhs.m_W, m_X + rhs.m_X, m_Y + rhs.m_Y, m_Z + rhs.m_Z); }
+  static constexpr T DotProduct(const Quaternion<T>& a, const Quaternion<T>& b)
+  {
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return Math::Simd::HorizontalSum(Math::Simd::Multiply(a.ToRegister(), b.ToRegister()));
+      }
+    }
+
+    return (a.GetX() * b.GetX()) + (a.GetY() * b.GetY()) + (a.GetZ() * b.GetZ()) + (a.GetW() * b.GetW());
+  }
 
-  Quaternion<T> operator-(const Quaternion& rhs) const { return Quaternion<T>(m_W - rhs.m_W, m_X - rhs.m_X, m_Y - rhs.m_Y, m_Z - rhs.m_Z); }
+  // Normalized linear interpolation along the shorter arc, cheap but not constant in angular velocity
+  static constexpr Quaternion<T> Nlerp(const Quaternion<T>& from, const Quaternion<T>& to, T fraction)
+  {
+    const T sign = (DotProduct(from, to) < static_cast<T>(0)) ? static_cast<T>(-1) : static_cast<T>(1);
+    return (from.Scale(static_cast<T>(1) - fraction) + to.Scale(sign * fraction)).ToNormalized();
+  }
 
-  Quaternion<T> operator*(const Quaternion& rhs) const
+  // Spherical linear interpolation between unit quaternions along the shorter arc
+  static constexpr Quaternion<T> Slerp(const Quaternion<T>& from, const Quaternion<T>& to, T fraction)
   {
-    return Quaternion<T>(m_W * rhs.m_W - m_X * rhs.m_X - m_Y * rhs.m_Y - m_Z * rhs.m_Z,
-                         m_W * rhs.m_X + m_X * rhs.m_W + m_Y * rhs.m_Z - m_Z * rhs.m_Y,
-                         m_W * rhs.m_Y - m_X * rhs.m_Z + m_Y * rhs.m_W + m_Z * rhs.m_X,
-                         m_W * rhs.m_Z + m_X * rhs.m_Y - m_Y * rhs.m_X + m_Z * rhs.m_W);
+    MATH_INSTRUMENT_COUNT("Quaternion::Slerp");
+
+    constexpr T kOne       = static_cast<T>(1);
+    constexpr T kThreshold = static_cast<T>(0.9995);
+
+    T cosine = DotProduct(from, to);
+    T sign   = kOne;
+    if(cosine < static_cast<T>(0))
+    {
+      cosine = -cosine;
+      sign   = -kOne;
+    }
+
+    // Nearly parallel inputs make sin(theta) vanish, where the linear blend is accurate
+    if(cosine > kThreshold)
+    {
+      return (from.Scale(kOne - fraction) + to.Scale(sign * fraction)).ToNormalized();
+    }
+
+    const T angle      = Math::Acos(cosine);
+    const T sine       = Math::Sin(angle);
+    const T fromWeight = Math::Sin((kOne - fraction) * angle) / sine;
+    const T toWeight   = Math::Sin(fraction * angle) / sine;
+
+    return from.Scale(fromWeight) + to.Scale(sign * toWeight);
   }
 
-  Quaternion<T> operator/(const Quaternion& rhs) const { return ((*this) * rhs.Inverse()); }
+  // Slerp through a polynomial correction of the linear weights instead of acos/sin, see Math::Detail::ApproximateSlerpWeights
+  static constexpr Quaternion<T> ApproximateSlerp(const Quaternion<T>& from, const Quaternion<T>& to, T fraction)
+  {
+    MATH_INSTRUMENT_COUNT("Quaternion::ApproximateSlerp");
 
-  Quaternion<T>& operator+=(const Quaternion& rhs)
+    const T cosine = DotProduct(from, to);
+    T fromWeight   = static_cast<T>(0);
+    T toWeight     = static_cast<T>(0);
+    Math::Detail::ApproximateSlerpWeights(&cosine, &fraction, &fromWeight, &toWeight, 1u);
+
+    return from.Scale(fromWeight) + to.Scale(toWeight);
+  }
+
+  // Advances an orientation by a world space angular velocity over step, exp(omega * step / 2) * orientation. The result
+  // is only renormalized once rounding has moved it further than Math::Detail::kIntegrationDrift from unit length.
+  template<class U = T, std::enable_if_t<std::is_floating_point_v<U>, bool> = true>
+  static constexpr Quaternion<T> Integrate(const Quaternion<T>& orientation, const Vector3<T>& angularVelocity, T step)
   {
-    m_X += rhs.m_X;
-    m_Y += rhs.m_Y;
-    m_Z += rhs.m_Z;
-    m_W += rhs.m_W;
+    MATH_INSTRUMENT_COUNT("Quaternion::Integrate");
+
+    const Vector3<T> half = angularVelocity * (static_cast<T>(0.5) * step);
 
-    return *this;
+    T sinc   = static_cast<T>(0);
+    T cosine = static_cast<T>(0);
+    Math::Detail::ExponentialFactors(half.GetSquareMagnitude(), sinc, cosine);
+
+    const Quaternion<T> result = Quaternion<T>(half.GetX() * sinc, half.GetY() * sinc, half.GetZ() * sinc, cosine) * orientation;
+    const T drift              = result.GetSquareMagnitude() - static_cast<T>(1);
+    return ((drift > Math::Detail::kIntegrationDrift<T>) || (-drift > Math::Detail::kIntegrationDrift<T>)) ? result.ToNormalized() : result;
   }
 
-  Quaternion<T>& operator-=(const Quaternion& rhs)
+  constexpr operator bool() const { return (*this) != Quaternion<T>::Invalid; }
+
+  constexpr bool operator==(const Quaternion<T>& rhs) const
   {
-    m_X -= rhs.m_X;
-    m_Y -= rhs.m_Y;
-    m_Z -= rhs.m_Z;
-    m_W -= rhs.m_W;
+    return (GetW() == rhs.GetW()) && (GetX() == rhs.GetX()) && (GetY() == rhs.GetY()) && (GetZ() == rhs.GetZ());
+  }
 
-    return *this;
+  constexpr bool operator!=(const Quaternion<T>& rhs) const
+  {
+    return (GetW() != rhs.GetW()) || (GetX() != rhs.GetX()) || (GetY() != rhs.GetY()) || (GetZ() != rhs.GetZ());
   }
 
-  Quaternion<T>& operator*=(const Quaternion& rhs)
+  constexpr Quaternion<T> operator+(const Quaternion& rhs) const
   {
-    m_W = (m_W * rhs.m_W) - (m_X * rhs.m_X) - (m_Y * rhs.m_Y) - (m_Z * rhs.m_Z);
-    m_X = (m_W * rhs.m_X) + (m_X * rhs.m_W) + (m_Y * rhs.m_Z) - (m_Z * rhs.m_Y);
-    m_Y = (m_W * rhs.m_Y) - (m_X * rhs.m_Z) + (m_Y * rhs.m_W) + (m_Z * rhs.m_X);
-    m_Z = (m_W * rhs.m_Z) + (m_X * rhs.m_Y) - (m_Y * rhs.m_X) + (m_Z * rhs.m_W);
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Add(ToRegister(), rhs.ToRegister()));
+      }
+    }
+
+    return Quaternion<T>(GetX() + rhs.GetX(), GetY() + rhs.GetY(), GetZ() + rhs.GetZ(), GetW() + rhs.GetW());
+  }
 
-    return *this;
+  constexpr Quaternion<T> operator-(const Quaternion& rhs) const
+  {
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Subtract(ToRegister(), rhs.ToRegister()));
+      }
+    }
+
+    return Quaternion<T>(GetX() - rhs.GetX(), GetY() - rhs.GetY(), GetZ() - rhs.GetZ(), GetW() - rhs.GetW());
   }
 
-  Quaternion<T>& operator/=(const Quaternion& rhs)
+  constexpr Quaternion<T> operator*(const Quaternion& rhs) const
   {
-    (*this) *= rhs.Inverse();
+    MATH_INSTRUMENT_COUNT("Quaternion::Multiply");
+
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        // Hamilton product as four broadcast-multiply terms over permuted lanes of rhs
+        const Register lhs   = ToRegister();
+        const Register other = rhs.ToRegister();
+
+        const Register wTerm = Math::Simd::Multiply(Math::Simd::Shuffle<3, 3, 3, 3>(lhs), other);
+        const Register xTerm = Math::Simd::Multiply(Math::Simd::Shuffle<0, 0, 0, 0>(lhs), Math::Simd::Shuffle<3, 2, 1, 0>(other));
+        const Register yTerm = Math::Simd::Multiply(Math::Simd::Shuffle<1, 1, 1, 1>(lhs), Math::Simd::Shuffle<2, 3, 0, 1>(other));
+        const Register zTerm = Math::Simd::Multiply(Math::Simd::Shuffle<2, 2, 2, 2>(lhs), Math::Simd::Shuffle<1, 0, 3, 2>(other));
+
+        return FromRegister(Math::Simd::Add(Math::Simd::Add(wTerm, Math::Simd::Negate<false, true, false, true>(xTerm)),
+                                            Math::Simd::Add(Math::Simd::Negate<false, false, true, true>(yTerm),
+                                                            Math::Simd::Negate<true, false, false, true>(zTerm))));
+      }
+    }
+
+    return Quaternion<T>(GetW() * rhs.GetX() + GetX() * rhs.GetW() + GetY() * rhs.GetZ() - GetZ() * rhs.GetY(),
+                         GetW() * rhs.GetY() - GetX() * rhs.GetZ() + GetY() * rhs.GetW() + GetZ() * rhs.GetX(),
+                         GetW() * rhs.GetZ() + GetX() * rhs.GetY() - GetY() * rhs.GetX() + GetZ() * rhs.GetW(),
+                         GetW() * rhs.GetW() - GetX() * rhs.GetX() - GetY() * rhs.GetY() - GetZ() * rhs.GetZ());
+  }
+
+  constexpr Quaternion<T> operator/(const Quaternion& rhs) const { return ((*this) * rhs.Inverse()); }
 
-    return *this;
+  constexpr Quaternion<T> operator/(T rhs) const
+  {
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Divide(ToRegister(), Math::Simd::Broadcast(rhs)));
+      }
+    }
+
+    return Quaternion<T>(GetX() / rhs, GetY() / rhs, GetZ() / rhs, GetW() / rhs);
   }
 
-  Quaternion<T> Scale(T value) { return Quaternion(m_W * value, m_X * value, m_Y * value, m_Z * value); }
+  constexpr Quaternion<T>& operator+=(const Quaternion& rhs) { return (*this) = (*this) + rhs; }
 
-  T GetSquareMagnitude() const { return (m_W * m_W) + (m_X * m_X) + (m_Y * m_Y) + (m_Z * m_Z); }
+  constexpr Quaternion<T>& operator-=(const Quaternion& rhs) { return (*this) = (*this) - rhs; }
 
-  T GetMagnitude() const { return static_cast<T>(std::sqrt(GetSquareMagnitude())); }
+  constexpr Quaternion<T>& operator*=(const Quaternion& rhs) { return (*this) = (*this) * rhs; }
 
-  Quaternion<T> Inverse() const { return ToConjugate().Scale(static_cast<T>(1) / GetSquareMagnitude()); }
+  constexpr Quaternion<T>& operator/=(const Quaternion& rhs) { return (*this) = (*this) * rhs.Inverse(); }
 
-  Quaternion<T> ToNormalized() const
+  constexpr Quaternion<T> Scale(T value) const
   {
-    T magnitude = GetMagnitude();
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Multiply(ToRegister(), Math::Simd::Broadcast(value)));
+      }
+    }
+
+    return Quaternion(GetX() * value, GetY() * value, GetZ() * value, GetW() * value);
+  }
+
+  constexpr T GetSquareMagnitude() const
+  {
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        const Register value = ToRegister();
+        return Math::Simd::HorizontalSum(Math::Simd::Multiply(value, value));
+      }
+    }
+
+    return (GetW() * GetW()) + (GetX() * GetX()) + (GetY() * GetY()) + (GetZ() * GetZ());
+  }
+
+  constexpr T GetMagnitude() const { return static_cast<T>(Math::Sqrt(GetSquareMagnitude())); }
+
+  template<class P, std::enable_if_t<Math::Precision::kPolicy<P>, bool> = true>
+  constexpr T GetMagnitude(P policy) const
+  {
+    return static_cast<T>(Math::Sqrt(GetSquareMagnitude(), policy));
+  }
+
+  constexpr Quaternion<T> Inverse() const { return ToConjugate().Scale(static_cast<T>(1) / GetSquareMagnitude()); }
+
+  constexpr Quaternion<T> ToNormalized() const
+  {
+    MATH_INSTRUMENT_COUNT("Quaternion::ToNormalized");
+
+    const T magnitude = GetMagnitude();
     return (magnitude != static_cast<T>(0)) ? ((*this) / magnitude) : (*this);
   }
 
-  Quaternion<T> ToConjugate() const { return Quaternion<T>(m_W, -m_X, -m_Y, -m_Z); }
+  // Multiplies by the reciprocal magnitude instead of dividing, see Precision.hpp for the error of each policy
+  template<class P, std::enable_if_t<Math::Precision::kPolicy<P>, bool> = true>
+  constexpr Quaternion<T> ToNormalized(P) const
+  {
+    if constexpr(Math::Precision::kEstimated<P, T>)
+    {
+      const T square = GetSquareMagnitude();
+      if(!Math::Detail::IsConstantEvaluated() && (square != static_cast<T>(0)))
+      {
+        return Scale(Math::ReciprocalSqrt(square, P()));
+      }
+    }
+
+    return ToNormalized();
+  }
+
+  constexpr Quaternion<T> ToConjugate() const
+  {
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Negate<true, true, true, false>(ToRegister()));
+      }
+    }
+
+    return Quaternion<T>(-GetX(), -GetY(), -GetZ(), GetW());
+  }
+
+  // Rotates by a unit quaternion using v + 2w(u x v) + 2u x (u x v), which avoids forming q * v * q^-1
+  constexpr Vector3<T> Rotate(const Vector3<T>& value) const
+  {
+    MATH_INSTRUMENT_COUNT("Quaternion::Rotate");
+
+    const Vector3<T> axis(GetX(), GetY(), GetZ());
+    const Vector3<T> twiceCross = Vector3<T>::CrossProduct(axis, value) * static_cast<T>(2);
+    return value + (twiceCross * GetW()) + Vector3<T>::CrossProduct(axis, twiceCross);
+  }
 
-  T GetW() const { return m_W; }
-  T GetX() const { return m_X; }
-  T GetY() const { return m_Y; }
-  T GetZ() const { return m_Z; }
+  constexpr T GetW() const { return m_Values[3]; }
+  constexpr T GetX() const { return m_Values[0]; }
+  constexpr T GetY() const { return m_Values[1]; }
+  constexpr T GetZ() const { return m_Values[2]; }
 
   constexpr Quaternion(const T x, const T y, const T z, const T w)
-      : m_X(x)
-      , m_Y(y)
-      , m_Z(z)
-      , m_W(w)
-  {}
+      : m_Values{x, y, z, w}
+  {
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        // Written as one register, a packed operation reading it right after gets the store forwarded
+        Math::Simd::Store(m_Values, Math::Simd::Set(x, y, z, w));
+      }
+    }
+  }
 
   ~Quaternion() = default;
 
   constexpr Quaternion()
-      : m_X(static_cast<T>(0))
-      , m_Y(static_cast<T>(0))
-      , m_Z(static_cast<T>(0))
-      , m_W(static_cast<T>(0))
+      : m_Values{}
   {}
 
-  constexpr Quaternion(const Quaternion<T>& other)
-      : m_X(other.m_X)
-      , m_Y(other.m_Y)
-      , m_Z(other.m_Z)
-      , m_W(other.m_W)
-  {}
+  constexpr Quaternion(const Quaternion&) = default;
+  constexpr Quaternion(Quaternion&&)      = default;
 
-  Quaternion(Quaternion<T>&& other)
-      : m_X(std::move(other.m_X))
-      , m_Y(std::move(other.m_Y))
-      , m_Z(std::move(other.m_Z))
-      , m_W(std::move(other.m_W))
-  {}
+  constexpr Quaternion& operator=(const Quaternion&) = default;
+  constexpr Quaternion& operator=(Quaternion&&)      = default;
 
-  constexpr Quaternion& operator=(const Quaternion<T>& other)
-  {
-    m_X = other.m_X;
-    m_Y = other.m_Y;
-    m_Z = other.m_Z;
-    m_W = other.m_W;
-  }
+  private:
+  static constexpr bool kPacked = Math::Simd::Traits<T>::kEnabled;
+  using Register                = typename Math::Simd::Traits<T>::Register;
 
-  Quaternion& operator=(Quaternion<T>&& other)
+  // x, y, z and w fill one aligned register, so a quaternion loads and stores as a whole
+  Register ToRegister() const { return Math::Simd::Load(m_Values); }
+
+  static Quaternion<T> FromRegister(Register value)
   {
-    m_X = std::move(other.m_X);
-    m_Y = std::move(other.m_Y);
-    m_Z = std::move(other.m_Z);
-    m_W = std::move(other.m_W);
+    Quaternion<T> result;
+    Math::Simd::Store(result.m_Values, value);
+    return result;
   }
 
-  private:
-  T m_X;
-  T m_Y;
-  T m_Z;
-  T m_W;
+  T m_Values[4u];
 };
 
+// Arrays of them are copied, mapped and written as raw bytes
+static_assert(std::is_trivially_copyable_v<Quaternion<float>> && std::is_standard_layout_v<Quaternion<float>>);
+static_assert(std::is_trivially_copyable_v<Quaternion<double>> && std::is_standard_layout_v<Quaternion<double>>);
+
 #endif // __MATH__QUATERNION_HPP__
@@ -1,5 +1,9 @@
 #include "Quaternion.hpp"
 
+#include <array>
+#include <cmath>
+#include <limits>
+
 #include <gtest/gtest.h>
 
 using namespace ::testing;
@@ -23,4 +27,225 @@ namespace UnitTest
       ASSERT_TRUE(quaternion);
     }
   }
+
+  template<class T>
+  class QuaternionTyped : public Test
+  {};
+
+  using QuaternionTypes = Types<float, double>;
+  TYPED_TEST_SUITE(QuaternionTyped, QuaternionTypes);
+
+  TYPED_TEST(QuaternionTyped, Arithmetic)
+  {
+    using T = TypeParam;
+
+    const Quaternion<T> a(static_cast<T>(1), static_cast<T>(2), static_cast<T>(3), static_cast<T>(4));
+    const Quaternion<T> b(static_cast<T>(-2), static_cast<T>(1), static_cast<T>(0), static_cast<T>(3));
+
+    ASSERT_TRUE((a + b) == Quaternion<T>(static_cast<T>(-1), static_cast<T>(3), static_cast<T>(3), static_cast<T>(7)));
+    ASSERT_TRUE((a - b) == Quaternion<T>(static_cast<T>(3), static_cast<T>(1), static_cast<T>(3), static_cast<T>(1)));
+    ASSERT_TRUE(a.Scale(static_cast<T>(2)) == Quaternion<T>(static_cast<T>(2), static_cast<T>(4), static_cast<T>(6), static_cast<T>(8)));
+    ASSERT_TRUE(a.ToConjugate() == Quaternion<T>(static_cast<T>(-1), static_cast<T>(-2), static_cast<T>(-3), static_cast<T>(4)));
+    ASSERT_EQ(a.GetSquareMagnitude(), static_cast<T>(30));
+  }
+
+  TYPED_TEST(QuaternionTyped, Product)
+  {
+    using T = TypeParam;
+
+    const Quaternion<T> i(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+    const Quaternion<T> j(static_cast<T>(0), static_cast<T>(1), static_cast<T>(0), static_cast<T>(0));
+    const Quaternion<T> k(static_cast<T>(0), static_cast<T>(0), static_cast<T>(1), static_cast<T>(0));
+    const Quaternion<T> minusOne(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(-1));
+
+    ASSERT_TRUE((i * j) == k);
+    ASSERT_TRUE((j * k) == i);
+    ASSERT_TRUE((k * i) == j);
+    ASSERT_TRUE((j * i) == k.Scale(static_cast<T>(-1)));
+    ASSERT_TRUE((i * i) == minusOne);
+    ASSERT_TRUE((i * j * k) == minusOne);
+
+    const Quaternion<T> a(static_cast<T>(1), static_cast<T>(2), static_cast<T>(3), static_cast<T>(4));
+    const Quaternion<T> b(static_cast<T>(-2), static_cast<T>(1), static_cast<T>(0), static_cast<T>(3));
+    const Quaternion<T> product = a * b;
+    ASSERT_EQ(product.GetX(), static_cast<T>(-8));
+    ASSERT_EQ(product.GetY(), static_cast<T>(4));
+    ASSERT_EQ(product.GetZ(), static_cast<T>(14));
+    ASSERT_EQ(product.GetW(), static_cast<T>(12));
+
+    Quaternion<T> inPlace = a;
+    inPlace *= b;
+    ASSERT_TRUE(inPlace == product);
+
+    // Reads both operands before writing, also when they are the same object
+    Quaternion<T> square = a;
+    square *= square;
+    ASSERT_TRUE(square == (a * a));
+  }
+
+  TYPED_TEST(QuaternionTyped, Inverse)
+  {
+    using T = TypeParam;
+
+    const Quaternion<T> a(static_cast<T>(1), static_cast<T>(2), static_cast<T>(3), static_cast<T>(4));
+    const Quaternion<T> identity = a * a.Inverse();
+    const T tolerance            = static_cast<T>(8) * std::numeric_limits<T>::epsilon();
+
+    ASSERT_NEAR(identity.GetX(), static_cast<T>(0), tolerance);
+    ASSERT_NEAR(identity.GetY(), static_cast<T>(0), tolerance);
+    ASSERT_NEAR(identity.GetZ(), static_cast<T>(0), tolerance);
+    ASSERT_NEAR(identity.GetW(), static_cast<T>(1), tolerance);
+
+    const Quaternion<T> normalized = a.ToNormalized();
+    ASSERT_NEAR(normalized.GetMagnitude(), static_cast<T>(1), tolerance);
+    ASSERT_NEAR(normalized.GetW(), static_cast<T>(4) / std::sqrt(static_cast<T>(30)), tolerance);
+  }
+
+  TYPED_TEST(QuaternionTyped, Rotate)
+  {
+    using T = TypeParam;
+
+    const T kPi                     = static_cast<T>(3.14159265358979323846);
+    const T tolerance               = static_cast<T>(16) * std::numeric_limits<T>::epsilon();
+    const Quaternion<T> quarterTurn = Quaternion<T>::FromAxisAngle(Vector3<T>::Forward, kPi / static_cast<T>(2));
+
+    const Vector3<T> up = quarterTurn.Rotate(Vector3<T>::Right);
+    ASSERT_NEAR(up.GetX(), static_cast<T>(0), tolerance);
+    ASSERT_NEAR(up.GetY(), static_cast<T>(1), tolerance);
+    ASSERT_NEAR(up.GetZ(), static_cast<T>(0), tolerance);
+
+    const Quaternion<T> rotation = Quaternion<T>::FromAxisAngle(Vector3<T>(static_cast<T>(1), static_cast<T>(-2), static_cast<T>(0.5)), static_cast<T>(0.7));
+    const Vector3<T> value(static_cast<T>(3), static_cast<T>(-1), static_cast<T>(2));
+    const Quaternion<T> sandwich = rotation * Quaternion<T>(value.GetX(), value.GetY(), value.GetZ(), static_cast<T>(0)) * rotation.Inverse();
+    const Vector3<T> rotated     = rotation.Rotate(value);
+
+    ASSERT_NEAR(rotated.GetX(), sandwich.GetX(), tolerance * static_cast<T>(4));
+    ASSERT_NEAR(rotated.GetY(), sandwich.GetY(), tolerance * static_cast<T>(4));
+    ASSERT_NEAR(rotated.GetZ(), sandwich.GetZ(), tolerance * static_cast<T>(4));
+    ASSERT_NEAR(rotated.GetMagnitude(), value.GetMagnitude(), tolerance * static_cast<T>(4));
+  }
+
+  TYPED_TEST(QuaternionTyped, Integrate)
+  {
+    using T = TypeParam;
+
+    const T tolerance               = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+    const Vector3<T> axis           = Vector3<T>(static_cast<T>(1), static_cast<T>(2), static_cast<T>(-2)).ToNormalized();
+    const Quaternion<T> orientation = Quaternion<T>::FromAxisAngle(Vector3<T>::Up, static_cast<T>(0.3));
+
+    // Both sides of the series threshold match the closed form exp(omega * step / 2) * orientation
+    for(const T speed : {static_cast<T>(0.5), static_cast<T>(5.9), static_cast<T>(6.1), static_cast<T>(40)})
+    {
+      const T step                   = static_cast<T>(1.0 / 30.0);
+      const Quaternion<T> integrated = Quaternion<T>::Integrate(orientation, axis * speed, step);
+      const Quaternion<T> expected   = Quaternion<T>::FromAxisAngle(axis, speed * step) * orientation;
+
+      ASSERT_NEAR(integrated.GetX(), expected.GetX(), tolerance);
+      ASSERT_NEAR(integrated.GetY(), expected.GetY(), tolerance);
+      ASSERT_NEAR(integrated.GetZ(), expected.GetZ(), tolerance);
+      ASSERT_NEAR(integrated.GetW(), expected.GetW(), tolerance);
+    }
+
+    // At rest a unit orientation is left alone, a drifted one is brought back to unit length
+    ASSERT_TRUE(Quaternion<T>::Integrate(orientation, Vector3<T>(), static_cast<T>(1)) == orientation);
+    const Quaternion<T> drifted = Quaternion<T>::Integrate(orientation.Scale(static_cast<T>(1.01)), Vector3<T>(), static_cast<T>(1));
+    ASSERT_NEAR(drifted.GetMagnitude(), static_cast<T>(1), tolerance);
+  }
+
+  TYPED_TEST(QuaternionTyped, Slerp)
+  {
+    using T = TypeParam;
+
+    const T kPi                 = static_cast<T>(3.14159265358979323846);
+    const T tolerance           = static_cast<T>(16) * std::numeric_limits<T>::epsilon();
+    const Quaternion<T> from    = Quaternion<T>::Identity;
+    const Quaternion<T> to      = Quaternion<T>::FromAxisAngle(Vector3<T>::Up, kPi / static_cast<T>(2));
+    const Quaternion<T> halfway = Quaternion<T>::FromAxisAngle(Vector3<T>::Up, kPi / static_cast<T>(4));
+
+    const Quaternion<T> slerp = Quaternion<T>::Slerp(from, to, static_cast<T>(0.5));
+    const Quaternion<T> nlerp = Quaternion<T>::Nlerp(from, to, static_cast<T>(0.5));
+    ASSERT_NEAR(slerp.GetY(), halfway.GetY(), tolerance);
+    ASSERT_NEAR(slerp.GetW(), halfway.GetW(), tolerance);
+    ASSERT_NEAR(nlerp.GetY(), halfway.GetY(), tolerance);
+    ASSERT_NEAR(nlerp.GetW(), halfway.GetW(), tolerance);
+
+    // Slerp keeps a constant angular velocity, a third of the way covers a third of the angle
+    const Quaternion<T> third = Quaternion<T>::Slerp(from, to, static_cast<T>(1) / static_cast<T>(3));
+    ASSERT_NEAR(third.GetY(), std::sin(kPi / static_cast<T>(12)), tolerance);
+
+    // The negated target describes the same rotation, the shorter arc is taken either way
+    const Quaternion<T> negated = Quaternion<T>::Slerp(from, to.Scale(static_cast<T>(-1)), static_cast<T>(0.5));
+    ASSERT_NEAR(negated.GetY(), halfway.GetY(), tolerance);
+    ASSERT_NEAR(negated.GetW(), halfway.GetW(), tolerance);
+  }
+
+  TYPED_TEST(QuaternionTyped, ApproximateSlerp)
+  {
+    using T = TypeParam;
+
+    const T tolerance        = static_cast<T>(3e-5);
+    const Quaternion<T> from = Quaternion<T>::FromAxisAngle(Vector3<T>(static_cast<T>(1), static_cast<T>(2), static_cast<T>(3)), static_cast<T>(0.3));
+
+    for(int angle = -30; angle <= 30; angle++)
+    {
+      const Vector3<T> axis(static_cast<T>(-2), static_cast<T>(1), static_cast<T>(0.5));
+      const Quaternion<T> to = Quaternion<T>::FromAxisAngle(axis, static_cast<T>(angle) / static_cast<T>(10));
+      for(int step = 0; step <= 20; step++)
+      {
+        const T fraction           = static_cast<T>(step) / static_cast<T>(20);
+        const Quaternion<T> exact  = Quaternion<T>::Slerp(from, to, fraction);
+        const Quaternion<T> approx = Quaternion<T>::ApproximateSlerp(from, to, fraction);
+
+        ASSERT_NEAR(approx.GetX(), exact.GetX(), tolerance);
+        ASSERT_NEAR(approx.GetY(), exact.GetY(), tolerance);
+        ASSERT_NEAR(approx.GetZ(), exact.GetZ(), tolerance);
+        ASSERT_NEAR(approx.GetW(), exact.GetW(), tolerance);
+      }
+    }
+  }
+
+  // Rotations about the up axis in steps of a sixteenth of a turn, built at compile time
+  template<class T>
+  static constexpr std::array<Quaternion<T>, 16> CreateRotations()
+  {
+    std::array<Quaternion<T>, 16> result = {};
+    for(std::size_t i = 0u; i < result.size(); i++)
+    {
+      result[i] = Quaternion<T>::FromAxisAngle(Vector3<T>::Up, static_cast<T>(i) * static_cast<T>(3.14159265358979323846 / 8.0));
+    }
+
+    return result;
+  }
+
+  TYPED_TEST(QuaternionTyped, Constexpr)
+  {
+    using T = TypeParam;
+
+    constexpr Quaternion<T> a(static_cast<T>(1), static_cast<T>(-2), static_cast<T>(3), static_cast<T>(4));
+    static_assert((a * Quaternion<T>::Identity) == a);
+    static_assert(a.ToConjugate() == Quaternion<T>(static_cast<T>(-1), static_cast<T>(2), static_cast<T>(-3), static_cast<T>(4)));
+    static_assert((a * a.ToConjugate()) == Quaternion<T>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(30)));
+    static_assert((a + a - a.Scale(static_cast<T>(2))) == Quaternion<T>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)));
+    static_assert(Quaternion<T>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(3), static_cast<T>(4)).GetMagnitude() == static_cast<T>(5));
+
+    const T tolerance = static_cast<T>(16) * std::numeric_limits<T>::epsilon();
+
+    constexpr std::array<Quaternion<T>, 16> kRotations = CreateRotations<T>();
+    const std::array<Quaternion<T>, 16> rotations      = CreateRotations<T>();
+    for(std::size_t i = 0u; i < kRotations.size(); i++)
+    {
+      ASSERT_NEAR(kRotations[i].GetX(), rotations[i].GetX(), tolerance);
+      ASSERT_NEAR(kRotations[i].GetY(), rotations[i].GetY(), tolerance);
+      ASSERT_NEAR(kRotations[i].GetZ(), rotations[i].GetZ(), tolerance);
+      ASSERT_NEAR(kRotations[i].GetW(), rotations[i].GetW(), tolerance);
+    }
+
+    constexpr Vector3<T> kLeft         = kRotations[4].Rotate(Vector3<T>::Forward);
+    constexpr Quaternion<T> kEighth    = Quaternion<T>::Slerp(kRotations[0], kRotations[4], static_cast<T>(0.5));
+    constexpr Quaternion<T> kEstimated = Quaternion<T>::ApproximateSlerp(kRotations[0], kRotations[4], static_cast<T>(0.5));
+    ASSERT_NEAR(kLeft.GetX(), static_cast<T>(1), tolerance);
+    ASSERT_NEAR(kLeft.GetZ(), static_cast<T>(0), tolerance);
+    ASSERT_NEAR(Quaternion<T>::DotProduct(kEighth, kRotations[2]), static_cast<T>(1), tolerance);
+    ASSERT_NEAR(Quaternion<T>::DotProduct(kEstimated, kRotations[2]), static_cast<T>(1), static_cast<T>(1e-5));
+  }
 } // namespace UnitTest
@@ -0,0 +1,126 @@
+#ifndef __MATH__QUATERNIONARRAY_HPP__
+#define __MATH__QUATERNIONARRAY_HPP__
+
+#include "AlignedAllocator.hpp"
+#include "Common.hpp"
+#include "Quaternion.hpp"
+#include "Span.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// Structure-of-arrays storage for Quaternion, keeping each component in its own contiguous, cache line aligned array
+template<class T, std::enable_if_t<Math::kSignedScalar<T>, bool> = true>
+class QuaternionArray
+{
+  public:
+  using Container = std::vector<T, Math::AlignedAllocator<T>>;
+
+  Quaternion<T> operator[](std::size_t index) const { return Quaternion<T>(m_X[index], m_Y[index], m_Z[index], m_W[index]); }
+
+  void Set(std::size_t index, const Quaternion<T>& value)
+  {
+    m_X[index] = value.GetX();
+    m_Y[index] = value.GetY();
+    m_Z[index] = value.GetZ();
+    m_W[index] = value.GetW();
+  }
+
+  void PushBack(const Quaternion<T>& value)
+  {
+    m_X.push_back(value.GetX());
+    m_Y.push_back(value.GetY());
+    m_Z.push_back(value.GetZ());
+    m_W.push_back(value.GetW());
+  }
+
+  void Resize(std::size_t size)
+  {
+    m_X.resize(size);
+    m_Y.resize(size);
+    m_Z.resize(size);
+    m_W.resize(size);
+  }
+
+  void Reserve(std::size_t capacity)
+  {
+    m_X.reserve(capacity);
+    m_Y.reserve(capacity);
+    m_Z.reserve(capacity);
+    m_W.reserve(capacity);
+  }
+
+  void Clear()
+  {
+    m_X.clear();
+    m_Y.clear();
+    m_Z.clear();
+    m_W.clear();
+  }
+
+  void ToQuaternions(Math::Span<Quaternion<T>> out) const
+  {
+    assert(out.GetSize() >= GetSize());
+
+    const std::size_t count = GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = Quaternion<T>(m_X[i], m_Y[i], m_Z[i], m_W[i]);
+    }
+  }
+
+  std::vector<Quaternion<T>> ToQuaternions() const
+  {
+    std::vector<Quaternion<T>> result(GetSize());
+    ToQuaternions(Math::Span<Quaternion<T>>(result));
+    return result;
+  }
+
+  std::size_t GetSize() const { return m_X.size(); }
+  bool IsEmpty() const { return m_X.empty(); }
+
+  Math::Span<T> GetX() { return Math::Span<T>(m_X); }
+  Math::Span<T> GetY() { return Math::Span<T>(m_Y); }
+  Math::Span<T> GetZ() { return Math::Span<T>(m_Z); }
+  Math::Span<T> GetW() { return Math::Span<T>(m_W); }
+
+  Math::Span<const T> GetX() const { return Math::Span<const T>(m_X); }
+  Math::Span<const T> GetY() const { return Math::Span<const T>(m_Y); }
+  Math::Span<const T> GetZ() const { return Math::Span<const T>(m_Z); }
+  Math::Span<const T> GetW() const { return Math::Span<const T>(m_W); }
+
+  QuaternionArray(Math::Span<const Quaternion<T>> values)
+      : m_X(values.GetSize())
+      , m_Y(values.GetSize())
+      , m_Z(values.GetSize())
+      , m_W(values.GetSize())
+  {
+    const std::size_t count = values.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      m_X[i] = values[i].GetX();
+      m_Y[i] = values[i].GetY();
+      m_Z[i] = values[i].GetZ();
+      m_W[i] = values[i].GetW();
+    }
+  }
+
+  explicit QuaternionArray(std::size_t size)
+      : m_X(size)
+      , m_Y(size)
+      , m_Z(size)
+      , m_W(size)
+  {}
+
+  QuaternionArray() = default;
+
+  private:
+  Container m_X;
+  Container m_Y;
+  Container m_Z;
+  Container m_W;
+};
+
+#endif // __MATH__QUATERNIONARRAY_HPP__
@@ -0,0 +1,40 @@
+#include "QuaternionArray.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  TEST(QuaternionArray, Conversion)
+  {
+    std::vector<Quaternion<double>> quaternions;
+    for(std::size_t i = 0u; i < 37u; i++)
+    {
+      const double value = static_cast<double>(i);
+      quaternions.push_back(Quaternion<double>(value - 8.0, (value * 0.5) + 1.0, 3.0 - (value * 0.25), value));
+    }
+
+    QuaternionArray<double> array(quaternions);
+    ASSERT_EQ(array.GetSize(), quaternions.size());
+
+    const std::vector<Quaternion<double>> result = array.ToQuaternions();
+    ASSERT_EQ(result.size(), quaternions.size());
+    for(std::size_t i = 0u; i < quaternions.size(); i++)
+    {
+      ASSERT_TRUE(result[i] == quaternions[i]);
+      ASSERT_TRUE(array[i] == quaternions[i]);
+      ASSERT_EQ(array.GetW()[i], quaternions[i].GetW());
+    }
+
+    array.Set(3u, Quaternion<double>::Identity);
+    array.PushBack(Quaternion<double>::Identity);
+    ASSERT_TRUE(array[3u] == Quaternion<double>::Identity);
+    ASSERT_TRUE(array[37u] == Quaternion<double>::Identity);
+
+    array.Clear();
+    ASSERT_TRUE(array.IsEmpty());
+  }
+} // namespace UnitTest
@@ -0,0 +1,153 @@
+#include "Benchmark.hpp"
+#include "Precision.hpp"
+#include "Quaternion.hpp"
+#include "QuaternionArray.hpp"
+#include "QuaternionBatch.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Benchmark
+{
+  template<class T>
+  static std::vector<Quaternion<T>> CreateUnitQuaternions(std::size_t count, std::size_t seed)
+  {
+    std::vector<Quaternion<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const std::size_t index = 4u * (i + seed);
+      const Quaternion<T> value(CreateScalar<T>(index), CreateScalar<T>(index + 1u), CreateScalar<T>(index + 2u), CreateScalar<T>(index + 3u));
+      result.push_back(value.ToNormalized());
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static std::vector<Vector3<T>> CreatePoints(std::size_t count)
+  {
+    std::vector<Vector3<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      result.push_back(Vector3<T>(CreateScalar<T>(3u * i), CreateScalar<T>((3u * i) + 1u), CreateScalar<T>((3u * i) + 2u)));
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static std::vector<T> CreateFractions(std::size_t count)
+  {
+    std::vector<T> result = CreateScalars<T>(count);
+    for(T& value : result)
+    {
+      value = Math::Normalize01(value, static_cast<T>(-100), static_cast<T>(100));
+    }
+
+    return result;
+  }
+
+  // kernel(from, to, fractions, out) over count blends
+  template<class T, class Kernel>
+  static void RegisterBlend(const char* name, Kernel kernel)
+  {
+    using Q = Quaternion<T>;
+
+    RegisterBatch(Name<T>(name),
+                  [kernel](std::size_t count)
+                  {
+                    return [kernel,
+                            from      = CreateUnitQuaternions<T>(count, 0u),
+                            to        = CreateUnitQuaternions<T>(count, count),
+                            fractions = CreateFractions<T>(count),
+                            out       = std::vector<Q>(count)]() mutable
+                    { kernel(Math::Span<const Q>(from), Math::Span<const Q>(to), Math::Span<const T>(fractions), Math::Span<Q>(out)); };
+                  });
+  }
+
+  template<class T>
+  static bool RegisterQuaternionBatch()
+  {
+    using Q = Quaternion<T>;
+    using V = Vector3<T>;
+
+    const Q rotation = CreateUnitQuaternions<T>(1u, 7u)[0];
+
+    RegisterBatch(Name<T>("QuaternionBatch_RotateArray"),
+                  [=](std::size_t count)
+                  {
+                    const std::vector<V> points = CreatePoints<T>(count);
+                    return [=, values = Vector3Array<T>(Math::Span<const V>(points)), out = Vector3Array<T>(count)]() mutable
+                    { Math::Batch::Rotate(rotation, values, out); };
+                  });
+    RegisterBatch(Name<T>("QuaternionBatch_RotateSpan"),
+                  [=](std::size_t count)
+                  {
+                    return [=, values = CreatePoints<T>(count), out = std::vector<V>(count)]() mutable
+                    { Math::Batch::Rotate(rotation, Math::Span<const V>(values), Math::Span<V>(out)); };
+                  });
+    RegisterBatch(Name<T>("QuaternionBatch_RotateParallel"),
+                  [](std::size_t count)
+                  {
+                    return [rotations = CreateUnitQuaternions<T>(count, 0u), values = CreatePoints<T>(count), out = std::vector<V>(count)]() mutable
+                    { Math::Batch::Rotate(Math::Span<const Q>(rotations), Math::Span<const V>(values), Math::Span<V>(out)); };
+                  });
+    RegisterBatch(Name<T>("QuaternionBatch_RotateParallelArray"),
+                  [](std::size_t count)
+                  {
+                    const std::vector<Q> rotations = CreateUnitQuaternions<T>(count, 0u);
+                    const std::vector<V> points    = CreatePoints<T>(count);
+                    return [=, values = Vector3Array<T>(Math::Span<const V>(points)), out = Vector3Array<T>(count)]() mutable
+                    { Math::Batch::Rotate(Math::Span<const Q>(rotations), values, out); };
+                  });
+    RegisterBatch(Name<T>("QuaternionBatch_Normalize"),
+                  [](std::size_t count)
+                  {
+                    return [values = CreateUnitQuaternions<T>(count, 0u), out = std::vector<Q>(count)]() mutable
+                    { Math::Batch::Normalize(Math::Span<const Q>(values), Math::Span<Q>(out)); };
+                  });
+    RegisterBatch(Name<T>("QuaternionBatch_NormalizeFast"),
+                  [](std::size_t count)
+                  {
+                    return [values = CreateUnitQuaternions<T>(count, 0u), out = std::vector<Q>(count)]() mutable
+                    { Math::Batch::Normalize(Math::Span<const Q>(values), Math::Span<Q>(out), Math::Precision::Fast()); };
+                  });
+    RegisterBatch(Name<T>("QuaternionBatch_IntegrateArray"),
+                  [](std::size_t count)
+                  {
+                    const std::vector<Q> orientations = CreateUnitQuaternions<T>(count, 0u);
+                    const std::vector<V> velocities   = CreatePoints<T>(count);
+                    return [values = QuaternionArray<T>(Math::Span<const Q>(orientations)), omega = Vector3Array<T>(Math::Span<const V>(velocities))]() mutable
+                    { Math::Batch::Integrate(values, omega, static_cast<T>(1e-3)); };
+                  });
+    RegisterBatch(Name<T>("QuaternionBatch_IntegrateSpan"),
+                  [](std::size_t count)
+                  {
+                    return [values = CreateUnitQuaternions<T>(count, 0u), omega = CreatePoints<T>(count)]() mutable
+                    { Math::Batch::Integrate(Math::Span<const Q>(values), Math::Span<const V>(omega), static_cast<T>(1e-3), Math::Span<Q>(values)); };
+                  });
+    // Baseline: a pure quaternion of the angular velocity, a product and a normalization per body
+    RegisterBatch(Name<T>("QuaternionBatch_IntegrateNaive"),
+                  [](std::size_t count)
+                  {
+                    return [values = CreateUnitQuaternions<T>(count, 0u), omega = CreatePoints<T>(count)]() mutable
+                    {
+                      const T halfStep = static_cast<T>(0.5e-3);
+                      for(std::size_t i = 0u; i < values.size(); i++)
+                      {
+                        const Q spin(omega[i].GetX(), omega[i].GetY(), omega[i].GetZ(), static_cast<T>(0));
+                        values[i] = (values[i] + (spin * values[i]).Scale(halfStep)).ToNormalized();
+                      }
+                    };
+                  });
+    RegisterBlend<T>("QuaternionBatch_Nlerp", [](auto from, auto to, auto fractions, auto out) { Math::Batch::Nlerp(from, to, fractions, out); });
+    RegisterBlend<T>("QuaternionBatch_Slerp", [](auto from, auto to, auto fractions, auto out) { Math::Batch::Slerp(from, to, fractions, out); });
+    RegisterBlend<T>("QuaternionBatch_ApproximateSlerp",
+                     [](auto from, auto to, auto fractions, auto out) { Math::Batch::ApproximateSlerp(from, to, fractions, out); });
+    return true;
+  }
+
+  static const bool kQuaternionBatchRegistered = RegisterQuaternionBatch<float>() && RegisterQuaternionBatch<double>();
+} // namespace Benchmark
@@ -0,0 +1,473 @@
+#ifndef __MATH__QUATERNIONBATCH_HPP__
+#define __MATH__QUATERNIONBATCH_HPP__
+
+#include "Quaternion.hpp"
+#include "QuaternionArray.hpp"
+#include "Simd.hpp"
+#include "Span.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+namespace Math::Detail
+{
+  // Renormalizes a quaternion held as components once it drifted past kIntegrationDrift, true when it did
+  template<class T>
+  bool RenormalizeDrift(T& x, T& y, T& z, T& w)
+  {
+    const T square = (x * x) + (y * y) + (z * z) + (w * w);
+    const T drift  = square - static_cast<T>(1);
+    if((drift <= kIntegrationDrift<T>) && (-drift <= kIntegrationDrift<T>))
+    {
+      return false;
+    }
+
+    const T inverse = static_cast<T>(1) / static_cast<T>(Math::Sqrt(square));
+    x *= inverse;
+    y *= inverse;
+    z *= inverse;
+    w *= inverse;
+    return true;
+  }
+
+  // Rotates lanes of vectors by lanes of unit quaternions as Quaternion::Rotate does, with t = 2 (q x v) it forms
+  // v + w t + q x t term for term. two holds 2 in every lane.
+  template<class R>
+  void RotateLanes(R qx, R qy, R qz, R qw, R two, R& x, R& y, R& z)
+  {
+    const R tx = Simd::Multiply(two, Simd::Subtract(Simd::Multiply(qy, z), Simd::Multiply(qz, y)));
+    const R ty = Simd::Multiply(two, Simd::Subtract(Simd::Multiply(qz, x), Simd::Multiply(qx, z)));
+    const R tz = Simd::Multiply(two, Simd::Subtract(Simd::Multiply(qx, y), Simd::Multiply(qy, x)));
+
+    x = Simd::Add(Simd::Add(x, Simd::Multiply(qw, tx)), Simd::Subtract(Simd::Multiply(qy, tz), Simd::Multiply(qz, ty)));
+    y = Simd::Add(Simd::Add(y, Simd::Multiply(qw, ty)), Simd::Subtract(Simd::Multiply(qz, tx), Simd::Multiply(qx, tz)));
+    z = Simd::Add(Simd::Add(z, Simd::Multiply(qw, tz)), Simd::Subtract(Simd::Multiply(qx, ty), Simd::Multiply(qy, tx)));
+  }
+
+  // The packed blocks of Batch::Integrate on registers of kLanes values, load and store move lanes unaligned and broadcast
+  // fills a register with one value. Starts at first and leaves it after the last whole block, returns how many
+  // orientations were renormalized.
+  template<std::size_t kLanes, class T, class Load, class Store, class Broadcast>
+  std::size_t IntegrateBlocks(QuaternionArray<T>& orientations,
+                              const Vector3Array<T>& angularVelocities,
+                              T halfStep,
+                              std::size_t& first,
+                              Load&& load,
+                              Store&& store,
+                              Broadcast&& broadcast)
+  {
+    constexpr T kLimit         = kExponentialSeriesAngle<T> * kExponentialSeriesAngle<T>;
+    constexpr const T* kSine   = kExponentialSine<T>;
+    constexpr const T* kCosine = kExponentialCosine<T>;
+
+    const std::size_t count = orientations.GetSize();
+
+    T* qx       = orientations.GetX().GetData();
+    T* qy       = orientations.GetY().GetData();
+    T* qz       = orientations.GetZ().GetData();
+    T* qw       = orientations.GetW().GetData();
+    const T* vx = angularVelocities.GetX().GetData();
+    const T* vy = angularVelocities.GetY().GetData();
+    const T* vz = angularVelocities.GetZ().GetData();
+
+    const auto half      = broadcast(halfStep);
+    const auto zero      = broadcast(static_cast<T>(0));
+    const auto one       = broadcast(static_cast<T>(1));
+    const auto limit     = broadcast(kLimit);
+    const auto lowDrift  = broadcast(static_cast<T>(1) - kIntegrationDrift<T>);
+    const auto highDrift = broadcast(static_cast<T>(1) + kIntegrationDrift<T>);
+
+    T squares[kLanes];
+    T sincs[kLanes];
+    T cosines[kLanes];
+
+    std::size_t renormalized = 0u;
+    std::size_t i            = first;
+    for(; (i + kLanes) <= count; i += kLanes)
+    {
+      const auto hx     = Simd::Multiply(load(vx + i), half);
+      const auto hy     = Simd::Multiply(load(vy + i), half);
+      const auto hz     = Simd::Multiply(load(vz + i), half);
+      const auto square = Simd::Add(Simd::Add(Simd::Multiply(hx, hx), Simd::Multiply(hy, hy)), Simd::Multiply(hz, hz));
+
+      auto sinc   = zero;
+      auto cosine = zero;
+      if(Simd::AllWithin(square, zero, limit))
+      {
+        // Horner steps of ExponentialFactors, lane by lane
+        sinc   = Simd::Add(broadcast(kSine[2]), Simd::Multiply(square, broadcast(kSine[3])));
+        cosine = Simd::Add(broadcast(kCosine[2]), Simd::Multiply(square, broadcast(kCosine[3])));
+        sinc   = Simd::Add(broadcast(kSine[1]), Simd::Multiply(square, sinc));
+        cosine = Simd::Add(broadcast(kCosine[1]), Simd::Multiply(square, cosine));
+        sinc   = Simd::Add(broadcast(kSine[0]), Simd::Multiply(square, sinc));
+        cosine = Simd::Add(broadcast(kCosine[0]), Simd::Multiply(square, cosine));
+        sinc   = Simd::Add(one, Simd::Multiply(square, sinc));
+        cosine = Simd::Add(one, Simd::Multiply(square, cosine));
+      }
+      else
+      {
+        // A fast body in the block, every lane takes the scalar factors
+        store(squares, square);
+        for(std::size_t lane = 0u; lane < kLanes; lane++)
+        {
+          ExponentialFactors(squares[lane], sincs[lane], cosines[lane]);
+        }
+
+        sinc   = load(sincs);
+        cosine = load(cosines);
+      }
+
+      const auto dx = Simd::Multiply(hx, sinc);
+      const auto dy = Simd::Multiply(hy, sinc);
+      const auto dz = Simd::Multiply(hz, sinc);
+      const auto dw = cosine;
+
+      const auto x = load(qx + i);
+      const auto y = load(qy + i);
+      const auto z = load(qz + i);
+      const auto w = load(qw + i);
+
+      // Hamilton product delta * orientation
+      const auto rx = Simd::Add(Simd::Add(Simd::Multiply(dw, x), Simd::Multiply(dx, w)), Simd::Subtract(Simd::Multiply(dy, z), Simd::Multiply(dz, y)));
+      const auto ry = Simd::Add(Simd::Subtract(Simd::Multiply(dw, y), Simd::Multiply(dx, z)), Simd::Add(Simd::Multiply(dy, w), Simd::Multiply(dz, x)));
+      const auto rz = Simd::Add(Simd::Add(Simd::Multiply(dw, z), Simd::Multiply(dx, y)), Simd::Subtract(Simd::Multiply(dz, w), Simd::Multiply(dy, x)));
+      const auto rw = Simd::Subtract(Simd::Subtract(Simd::Multiply(dw, w), Simd::Multiply(dx, x)), Simd::Add(Simd::Multiply(dy, y), Simd::Multiply(dz, z)));
+
+      store(qx + i, rx);
+      store(qy + i, ry);
+      store(qz + i, rz);
+      store(qw + i, rw);
+
+      const auto magnitude = Simd::Add(Simd::Add(Simd::Multiply(rx, rx), Simd::Multiply(ry, ry)), Simd::Add(Simd::Multiply(rz, rz), Simd::Multiply(rw, rw)));
+      if(!Simd::AllWithin(magnitude, lowDrift, highDrift))
+      {
+        for(std::size_t j = i; j < (i + kLanes); j++)
+        {
+          renormalized += RenormalizeDrift(qx[j], qy[j], qz[j], qw[j]) ? 1u : 0u;
+        }
+      }
+    }
+
+    first = i;
+    return renormalized;
+  }
+} // namespace Math::Detail
+
+namespace Math::Batch
+{
+  // Rotates every vector by one unit quaternion, four vectors per register. The output may alias the input.
+  template<class T>
+  void Rotate(const Quaternion<T>& rotation, const Vector3Array<T>& values, Vector3Array<T>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Quaternion::Rotate", values.GetSize());
+
+    const std::size_t count = values.GetSize();
+    out.Resize(count);
+
+    const T* vx = values.GetX().GetData();
+    const T* vy = values.GetY().GetData();
+    const T* vz = values.GetZ().GetData();
+    T* ox       = out.GetX().GetData();
+    T* oy       = out.GetY().GetData();
+    T* oz       = out.GetZ().GetData();
+
+    std::size_t i = 0u;
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      constexpr std::size_t kLanes = Math::Simd::Traits<T>::kLanes;
+
+      const auto qx  = Simd::Broadcast(rotation.GetX());
+      const auto qy  = Simd::Broadcast(rotation.GetY());
+      const auto qz  = Simd::Broadcast(rotation.GetZ());
+      const auto qw  = Simd::Broadcast(rotation.GetW());
+      const auto two = Simd::Broadcast(static_cast<T>(2));
+
+      for(; (i + kLanes) <= count; i += kLanes)
+      {
+        auto x = Simd::LoadUnaligned(vx + i);
+        auto y = Simd::LoadUnaligned(vy + i);
+        auto z = Simd::LoadUnaligned(vz + i);
+        Math::Detail::RotateLanes(qx, qy, qz, qw, two, x, y, z);
+
+        Simd::StoreUnaligned(ox + i, x);
+        Simd::StoreUnaligned(oy + i, y);
+        Simd::StoreUnaligned(oz + i, z);
+      }
+    }
+
+    for(; i < count; i++)
+    {
+      const Vector3<T> result = rotation.Rotate(Vector3<T>(vx[i], vy[i], vz[i]));
+      ox[i]                   = result.GetX();
+      oy[i]                   = result.GetY();
+      oz[i]                   = result.GetZ();
+    }
+  }
+
+  template<class T>
+  void Rotate(const Quaternion<T>& rotation, Math::Span<const Vector3<T>> values, Math::Span<Vector3<T>> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Quaternion::Rotate", values.GetSize());
+
+    assert(out.GetSize() >= values.GetSize());
+
+    const std::size_t count = values.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = rotation.Rotate(values[i]);
+    }
+  }
+
+  // Rotates each vector by its own unit quaternion, rotations and values are parallel arrays
+  template<class T>
+  void Rotate(Math::Span<const Quaternion<T>> rotations, Math::Span<const Vector3<T>> values, Math::Span<Vector3<T>> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Quaternion::Rotate", values.GetSize());
+
+    assert(rotations.GetSize() == values.GetSize());
+    assert(out.GetSize() >= values.GetSize());
+
+    const std::size_t count = values.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = rotations[i].Rotate(values[i]);
+    }
+  }
+
+  // Packed like the single rotation overload once the rotations of a block are transposed into registers. The output may
+  // alias the input.
+  template<class T>
+  void Rotate(Math::Span<const Quaternion<T>> rotations, const Vector3Array<T>& values, Vector3Array<T>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Quaternion::Rotate", values.GetSize());
+
+    assert(rotations.GetSize() == values.GetSize());
+
+    const std::size_t count = values.GetSize();
+    out.Resize(count);
+
+    const T* vx = values.GetX().GetData();
+    const T* vy = values.GetY().GetData();
+    const T* vz = values.GetZ().GetData();
+    T* ox       = out.GetX().GetData();
+    T* oy       = out.GetY().GetData();
+    T* oz       = out.GetZ().GetData();
+
+    std::size_t i = 0u;
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      constexpr std::size_t kLanes = Math::Simd::Traits<T>::kLanes;
+
+      const auto two = Simd::Broadcast(static_cast<T>(2));
+
+      // The rotations of a block are gathered lane by lane into one register per component
+      alignas(Simd::Traits<T>::kAlignment) T gathered[4u][kLanes];
+      for(; (i + kLanes) <= count; i += kLanes)
+      {
+        for(std::size_t lane = 0u; lane < kLanes; lane++)
+        {
+          const Quaternion<T>& rotation = rotations[i + lane];
+          gathered[0u][lane]            = rotation.GetX();
+          gathered[1u][lane]            = rotation.GetY();
+          gathered[2u][lane]            = rotation.GetZ();
+          gathered[3u][lane]            = rotation.GetW();
+        }
+
+        auto x = Simd::LoadUnaligned(vx + i);
+        auto y = Simd::LoadUnaligned(vy + i);
+        auto z = Simd::LoadUnaligned(vz + i);
+        Math::Detail::RotateLanes(Simd::Load(gathered[0u]), Simd::Load(gathered[1u]), Simd::Load(gathered[2u]), Simd::Load(gathered[3u]), two, x, y, z);
+
+        Simd::StoreUnaligned(ox + i, x);
+        Simd::StoreUnaligned(oy + i, y);
+        Simd::StoreUnaligned(oz + i, z);
+      }
+    }
+
+    for(; i < count; i++)
+    {
+      const Vector3<T> result = rotations[i].Rotate(Vector3<T>(vx[i], vy[i], vz[i]));
+      ox[i]                   = result.GetX();
+      oy[i]                   = result.GetY();
+      oz[i]                   = result.GetZ();
+    }
+  }
+
+  // Blends from[i] towards to[i] by fractions[i], the spans are parallel arrays and the output may alias either input
+  template<class T>
+  void Nlerp(Math::Span<const Quaternion<T>> from, Math::Span<const Quaternion<T>> to, Math::Span<const T> fractions, Math::Span<Quaternion<T>> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Quaternion::Nlerp", from.GetSize());
+
+    assert((from.GetSize() == to.GetSize()) && (from.GetSize() == fractions.GetSize()));
+    assert(out.GetSize() >= from.GetSize());
+
+    const std::size_t count = from.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = Quaternion<T>::Nlerp(from[i], to[i], fractions[i]);
+    }
+  }
+
+  template<class T>
+  void Slerp(Math::Span<const Quaternion<T>> from, Math::Span<const Quaternion<T>> to, Math::Span<const T> fractions, Math::Span<Quaternion<T>> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Quaternion::Slerp", from.GetSize());
+
+    assert((from.GetSize() == to.GetSize()) && (from.GetSize() == fractions.GetSize()));
+    assert(out.GetSize() >= from.GetSize());
+
+    const std::size_t count = from.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = Quaternion<T>::Slerp(from[i], to[i], fractions[i]);
+    }
+  }
+
+  // Trigonometry-free slerp in blocks: packed dot products, a vectorized pass computing all blend weights, then packed blends
+  template<class T>
+  void ApproximateSlerp(Math::Span<const Quaternion<T>> from,
+                        Math::Span<const Quaternion<T>> to,
+                        Math::Span<const T> fractions,
+                        Math::Span<Quaternion<T>> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Quaternion::ApproximateSlerp", from.GetSize());
+
+    assert((from.GetSize() == to.GetSize()) && (from.GetSize() == fractions.GetSize()));
+    assert(out.GetSize() >= from.GetSize());
+
+    constexpr std::size_t kBlockSize = 256u;
+
+    T cosines[kBlockSize];
+    T fromWeights[kBlockSize];
+    T toWeights[kBlockSize];
+
+    const std::size_t count = from.GetSize();
+    for(std::size_t offset = 0u; offset < count; offset += kBlockSize)
+    {
+      const std::size_t blockCount = ((count - offset) < kBlockSize) ? (count - offset) : kBlockSize;
+
+      for(std::size_t i = 0u; i < blockCount; i++)
+      {
+        cosines[i] = Quaternion<T>::DotProduct(from[offset + i], to[offset + i]);
+      }
+
+      Math::Detail::ApproximateSlerpWeights(cosines, fractions.GetData() + offset, fromWeights, toWeights, blockCount);
+
+      for(std::size_t i = 0u; i < blockCount; i++)
+      {
+        out[offset + i] = from[offset + i].Scale(fromWeights[i]) + to[offset + i].Scale(toWeights[i]);
+      }
+    }
+  }
+
+  // Normalizes each quaternion to the precision of the policy, the output may alias the input
+  template<class T, class P = Math::Precision::Exact, std::enable_if_t<Math::Precision::kPolicy<P>, bool> = true>
+  void Normalize(Math::Span<const Quaternion<T>> values, Math::Span<Quaternion<T>> out, P policy = P())
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Quaternion::Normalize", values.GetSize());
+
+    assert(out.GetSize() >= values.GetSize());
+
+    const std::size_t count = values.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = values[i].ToNormalized(policy);
+    }
+  }
+
+  // Advances each orientation by its own world space angular velocity over step as Quaternion::Integrate does, in place.
+  // Blocks whose half angles all lie within the series range skip sqrt, sin and cos entirely, the product and drift test
+  // stay packed either way and only the drifted lanes are renormalized. Returns how many orientations were renormalized.
+  // Double below AVX2 runs the same blocks two lanes wide.
+  template<class T>
+  std::size_t Integrate(QuaternionArray<T>& orientations, const Vector3Array<T>& angularVelocities, T step)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Quaternion::Integrate", orientations.GetSize());
+
+    assert(orientations.GetSize() == angularVelocities.GetSize());
+
+    const std::size_t count = orientations.GetSize();
+    const T halfStep        = static_cast<T>(0.5) * step;
+
+    T* qx       = orientations.GetX().GetData();
+    T* qy       = orientations.GetY().GetData();
+    T* qz       = orientations.GetZ().GetData();
+    T* qw       = orientations.GetW().GetData();
+    const T* vx = angularVelocities.GetX().GetData();
+    const T* vy = angularVelocities.GetY().GetData();
+    const T* vz = angularVelocities.GetZ().GetData();
+
+    std::size_t renormalized = 0u;
+    std::size_t i            = 0u;
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      const auto load      = [](const T* values) { return Simd::LoadUnaligned(values); };
+      const auto store     = [](T* values, typename Simd::Traits<T>::Register value) { Simd::StoreUnaligned(values, value); };
+      const auto broadcast = [](T value) { return Simd::Broadcast(value); };
+      renormalized         = Math::Detail::IntegrateBlocks<Simd::Traits<T>::kLanes>(orientations, angularVelocities, halfStep, i, load, store, broadcast);
+    }
+#if defined(MATH_SIMD_SSE)
+    else if constexpr(std::is_same_v<T, double>)
+    {
+      const auto load      = [](const double* values) { return _mm_loadu_pd(values); };
+      const auto store     = [](double* values, __m128d value) { _mm_storeu_pd(values, value); };
+      const auto broadcast = [](double value) { return _mm_set1_pd(value); };
+      renormalized         = Math::Detail::IntegrateBlocks<2u>(orientations, angularVelocities, halfStep, i, load, store, broadcast);
+    }
+#endif
+
+    for(; i < count; i++)
+    {
+      const T hx = vx[i] * halfStep;
+      const T hy = vy[i] * halfStep;
+      const T hz = vz[i] * halfStep;
+
+      T sinc   = static_cast<T>(0);
+      T cosine = static_cast<T>(0);
+      Math::Detail::ExponentialFactors((hx * hx) + (hy * hy) + (hz * hz), sinc, cosine);
+
+      const T dx = hx * sinc;
+      const T dy = hy * sinc;
+      const T dz = hz * sinc;
+      const T x  = qx[i];
+      const T y  = qy[i];
+      const T z  = qz[i];
+      const T w  = qw[i];
+
+      T rx = (cosine * x) + (dx * w) + (dy * z) - (dz * y);
+      T ry = (cosine * y) - (dx * z) + (dy * w) + (dz * x);
+      T rz = (cosine * z) + (dx * y) - (dy * x) + (dz * w);
+      T rw = (cosine * w) - (dx * x) - (dy * y) - (dz * z);
+      renormalized += Math::Detail::RenormalizeDrift(rx, ry, rz, rw) ? 1u : 0u;
+
+      qx[i] = rx;
+      qy[i] = ry;
+      qz[i] = rz;
+      qw[i] = rw;
+    }
+
+    return renormalized;
+  }
+
+  // Array of structures form, orientations and angularVelocities are parallel arrays and the output may alias orientations
+  template<class T>
+  void Integrate(Math::Span<const Quaternion<T>> orientations, Math::Span<const Vector3<T>> angularVelocities, T step, Math::Span<Quaternion<T>> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Quaternion::Integrate", orientations.GetSize());
+
+    assert(orientations.GetSize() == angularVelocities.GetSize());
+    assert(out.GetSize() >= orientations.GetSize());
+
+    const std::size_t count = orientations.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = Quaternion<T>::Integrate(orientations[i], angularVelocities[i], step);
+    }
+  }
+} // namespace Math::Batch
+
+#endif // __MATH__QUATERNIONBATCH_HPP__
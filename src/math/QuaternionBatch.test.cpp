@@ -0,0 +1,193 @@
+#include "QuaternionBatch.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class QuaternionBatchTyped : public Test
+  {};
+
+  using QuaternionBatchTypes = Types<float, double>;
+  TYPED_TEST_SUITE(QuaternionBatchTyped, QuaternionBatchTypes);
+
+  template<class T>
+  static std::vector<Vector3<T>> CreateVectors(std::size_t count)
+  {
+    std::vector<Vector3<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T value = static_cast<T>(i);
+      result.push_back(Vector3<T>(value - static_cast<T>(8),
+                                  (value * static_cast<T>(0.5)) + static_cast<T>(1),
+                                  static_cast<T>(3) - (value * static_cast<T>(0.25))));
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static std::vector<Quaternion<T>> CreateRotations(std::size_t count)
+  {
+    std::vector<Quaternion<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T value = static_cast<T>(i);
+      result.push_back(Quaternion<T>::FromAxisAngle(Vector3<T>(static_cast<T>(1), value, static_cast<T>(-2)), value * static_cast<T>(0.1)));
+    }
+
+    return result;
+  }
+
+  TYPED_TEST(QuaternionBatchTyped, RotateSingle)
+  {
+    using T = TypeParam;
+
+    const Vector3<T> axis(static_cast<T>(1), static_cast<T>(-2), static_cast<T>(0.5));
+    const Quaternion<T> rotation         = Quaternion<T>::FromAxisAngle(axis, static_cast<T>(0.7));
+    const std::vector<Vector3<T>> values = CreateVectors<T>(37u);
+
+    Vector3Array<T> array(values);
+    Math::Batch::Rotate(rotation, array, array);
+
+    std::vector<Vector3<T>> rotated(values.size());
+    Math::Batch::Rotate(rotation, Math::Span<const Vector3<T>>(values), Math::Span<Vector3<T>>(rotated));
+
+    for(std::size_t i = 0u; i < values.size(); i++)
+    {
+      const Vector3<T> expected = rotation.Rotate(values[i]);
+
+      // The packed kernel may contract into fused multiply-adds differently from the scalar tail
+      const T tolerance = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+      ASSERT_NEAR(array[i].GetX(), expected.GetX(), tolerance);
+      ASSERT_NEAR(array[i].GetY(), expected.GetY(), tolerance);
+      ASSERT_NEAR(array[i].GetZ(), expected.GetZ(), tolerance);
+      ASSERT_TRUE(rotated[i] == expected);
+    }
+  }
+
+  TYPED_TEST(QuaternionBatchTyped, RotateParallel)
+  {
+    using T = TypeParam;
+
+    const std::vector<Quaternion<T>> rotations = CreateRotations<T>(37u);
+    const std::vector<Vector3<T>> values       = CreateVectors<T>(37u);
+
+    Vector3Array<T> array(values);
+    Math::Batch::Rotate(Math::Span<const Quaternion<T>>(rotations), array, array);
+
+    std::vector<Vector3<T>> rotated(values.size());
+    Math::Batch::Rotate(Math::Span<const Quaternion<T>>(rotations), Math::Span<const Vector3<T>>(values), Math::Span<Vector3<T>>(rotated));
+
+    for(std::size_t i = 0u; i < values.size(); i++)
+    {
+      const Vector3<T> expected = rotations[i].Rotate(values[i]);
+
+      const T tolerance = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+      ASSERT_NEAR(array[i].GetX(), expected.GetX(), tolerance);
+      ASSERT_NEAR(array[i].GetY(), expected.GetY(), tolerance);
+      ASSERT_NEAR(array[i].GetZ(), expected.GetZ(), tolerance);
+      ASSERT_TRUE(rotated[i] == expected);
+    }
+  }
+
+  TYPED_TEST(QuaternionBatchTyped, Blend)
+  {
+    using T = TypeParam;
+
+    const std::size_t kCount              = 300u;
+    const std::vector<Quaternion<T>> from = CreateRotations<T>(kCount);
+    std::vector<Quaternion<T>> to         = CreateRotations<T>(kCount + 7u);
+    to.erase(to.begin(), to.begin() + 7);
+
+    std::vector<T> fractions;
+    for(std::size_t i = 0u; i < kCount; i++)
+    {
+      fractions.push_back(static_cast<T>(i % 11u) / static_cast<T>(10));
+    }
+
+    std::vector<Quaternion<T>> nlerp(kCount);
+    std::vector<Quaternion<T>> slerp(kCount);
+    std::vector<Quaternion<T>> approximate(kCount);
+    Math::Batch::Nlerp(Math::Span<const Quaternion<T>>(from),
+                       Math::Span<const Quaternion<T>>(to),
+                       Math::Span<const T>(fractions),
+                       Math::Span<Quaternion<T>>(nlerp));
+    Math::Batch::Slerp(Math::Span<const Quaternion<T>>(from),
+                       Math::Span<const Quaternion<T>>(to),
+                       Math::Span<const T>(fractions),
+                       Math::Span<Quaternion<T>>(slerp));
+    Math::Batch::ApproximateSlerp(Math::Span<const Quaternion<T>>(from),
+                                  Math::Span<const Quaternion<T>>(to),
+                                  Math::Span<const T>(fractions),
+                                  Math::Span<Quaternion<T>>(approximate));
+
+    for(std::size_t i = 0u; i < kCount; i++)
+    {
+      ASSERT_TRUE(nlerp[i] == Quaternion<T>::Nlerp(from[i], to[i], fractions[i]));
+      ASSERT_TRUE(slerp[i] == Quaternion<T>::Slerp(from[i], to[i], fractions[i]));
+      ASSERT_TRUE(approximate[i] == Quaternion<T>::ApproximateSlerp(from[i], to[i], fractions[i]));
+    }
+  }
+
+  TYPED_TEST(QuaternionBatchTyped, Integrate)
+  {
+    using T = TypeParam;
+
+    const std::size_t kCount                 = 37u;
+    const T step                             = static_cast<T>(1.0 / 60.0);
+    const std::vector<Quaternion<T>> initial = CreateRotations<T>(kCount);
+
+    // Slow bodies take the series, every fifth spins fast enough for sin and cos
+    std::vector<Vector3<T>> velocities = CreateVectors<T>(kCount);
+    for(std::size_t i = 0u; i < kCount; i++)
+    {
+      velocities[i] = velocities[i] * (((i % 5u) == 0u) ? static_cast<T>(4) : static_cast<T>(0.5));
+    }
+
+    QuaternionArray<T> array(initial);
+    std::vector<Quaternion<T>> orientations = initial;
+    for(std::size_t frame = 0u; frame < 120u; frame++)
+    {
+      Math::Batch::Integrate(array, Vector3Array<T>(velocities), step);
+      Math::Batch::Integrate(Math::Span<const Quaternion<T>>(orientations),
+                             Math::Span<const Vector3<T>>(velocities),
+                             step,
+                             Math::Span<Quaternion<T>>(orientations));
+    }
+
+    const T tolerance = (sizeof(T) == sizeof(float)) ? static_cast<T>(1e-4) : static_cast<T>(1e-10);
+    for(std::size_t i = 0u; i < kCount; i++)
+    {
+      // Two seconds at a constant rate turn by exactly |omega| * 2 about omega
+      const Quaternion<T> expected = Quaternion<T>::FromAxisAngle(velocities[i], velocities[i].GetMagnitude() * static_cast<T>(2)) * initial[i];
+
+      ASSERT_NEAR(std::abs(Quaternion<T>::DotProduct(array[i], expected)), static_cast<T>(1), tolerance);
+      ASSERT_NEAR(std::abs(Quaternion<T>::DotProduct(orientations[i], expected)), static_cast<T>(1), tolerance);
+      ASSERT_NEAR(array[i].GetMagnitude(), static_cast<T>(1), tolerance);
+    }
+
+    // Unit orientations at rest do not drift, scaled ones are all renormalized
+    QuaternionArray<T> rest(initial);
+    ASSERT_EQ(Math::Batch::Integrate(rest, Vector3Array<T>(kCount), step), 0u);
+
+    std::vector<Quaternion<T>> scaled = initial;
+    for(Quaternion<T>& value : scaled)
+    {
+      value = value.Scale(static_cast<T>(1.5));
+    }
+
+    QuaternionArray<T> drifted(scaled);
+    ASSERT_EQ(Math::Batch::Integrate(drifted, Vector3Array<T>(velocities), step), kCount);
+    for(std::size_t i = 0u; i < kCount; i++)
+    {
+      ASSERT_NEAR(drifted[i].GetMagnitude(), static_cast<T>(1), tolerance);
+    }
+  }
+} // namespace UnitTest
@@ -0,0 +1,398 @@
+#ifndef __MATH__SIEVE_HPP__
+#define __MATH__SIEVE_HPP__
+
+#include "Span.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace Math::Detail
+{
+  // Numbers covered by one sieve segment, one byte each so a segment fits a typical 32 KiB L1 data cache
+  constexpr std::uint64_t kSieveSegmentSize = 32768u;
+
+  // Same budget for the divisor-sum sieve, which keeps a 64-bit cofactor and a 64-bit running sum per number
+  constexpr std::uint64_t kDivisorSegmentSize = 2048u;
+
+  // floor(sqrt(value)) without floating point rounding
+  inline std::uint64_t IntegerSqrt(std::uint64_t value)
+  {
+    std::uint64_t result = 0u;
+    for(std::uint64_t bit = std::uint64_t(1u) << 62u; bit != 0u; bit >>= 2u)
+    {
+      if(value >= (result + bit))
+      {
+        value -= result + bit;
+        result = (result >> 1u) + bit;
+      }
+      else
+      {
+        result >>= 1u;
+      }
+    }
+
+    return result;
+  }
+
+  // Odd primes up to and including limit, simple sieve of Eratosthenes
+  inline std::vector<std::uint32_t> GetOddPrimes(std::uint32_t limit)
+  {
+    std::vector<std::uint32_t> result;
+    if(limit < 3u)
+    {
+      return result;
+    }
+
+    std::vector<bool> composite((limit / 2u) + 1u, false);
+    for(std::uint64_t i = 3u; i <= limit; i += 2u)
+    {
+      if(composite[static_cast<std::size_t>(i / 2u)])
+      {
+        continue;
+      }
+
+      result.push_back(static_cast<std::uint32_t>(i));
+      for(std::uint64_t multiple = i * i; multiple <= limit; multiple += 2u * i)
+      {
+        composite[static_cast<std::size_t>(multiple / 2u)] = true;
+      }
+    }
+
+    return result;
+  }
+
+  inline unsigned int ResolveThreadCount(unsigned int threadCount)
+  {
+    return (threadCount == 0u) ? std::max(1u, std::thread::hardware_concurrency()) : threadCount;
+  }
+
+  // Marks isPrime[i] for segmentLo + i in [segmentLo, segmentHi), primes must hold every odd prime up to sqrt(segmentHi - 1)
+  inline void SieveSegment(const std::vector<std::uint32_t>& primes, std::uint64_t segmentLo, std::uint64_t segmentHi, std::uint8_t* isPrime)
+  {
+    // Even numbers are rejected up front, only odd multiples of the odd base primes are crossed off
+    for(std::uint64_t value = segmentLo; value < segmentHi; value++)
+    {
+      isPrime[static_cast<std::size_t>(value - segmentLo)] = static_cast<std::uint8_t>(value & 1u);
+    }
+
+    for(const std::uint32_t prime : primes)
+    {
+      const std::uint64_t square = std::uint64_t(prime) * prime;
+      if(square >= segmentHi)
+      {
+        break;
+      }
+
+      // First odd multiple inside the segment, the distance checks keep the stepping from wrapping near 2^64
+      const std::uint64_t step = 2u * std::uint64_t(prime);
+      const std::uint64_t skip = (prime - (segmentLo % prime)) % prime;
+      if(skip >= (segmentHi - segmentLo))
+      {
+        continue;
+      }
+
+      std::uint64_t multiple = std::max(square, segmentLo + skip);
+      if((multiple & 1u) == 0u)
+      {
+        if((segmentHi - multiple) <= prime)
+        {
+          continue;
+        }
+
+        multiple += prime;
+      }
+
+      while(multiple < segmentHi)
+      {
+        isPrime[static_cast<std::size_t>(multiple - segmentLo)] = 0u;
+        if((segmentHi - multiple) <= step)
+        {
+          break;
+        }
+
+        multiple += step;
+      }
+    }
+
+    // Fix up the values the odd-only marking gets wrong
+    if(segmentLo <= 2u)
+    {
+      for(std::uint64_t value = segmentLo; (value < 3u) && (value < segmentHi); value++)
+      {
+        isPrime[static_cast<std::size_t>(value - segmentLo)] = (value == 2u) ? 1u : 0u;
+      }
+    }
+  }
+
+  /*
+   * Splits [lo, hi) into one contiguous chunk per worker thread and calls work(worker, chunkLo, chunkHi) on each. Chunk
+   * boundaries fall on multiples of granularity counted from lo so workers never share a segment. Worker 0 runs on the
+   * calling thread and the call returns once every chunk is done.
+   */
+  template<class Work>
+  void ForEachChunk(std::uint64_t lo, std::uint64_t hi, std::uint64_t granularity, unsigned int threadCount, Work&& work)
+  {
+    if(hi <= lo)
+    {
+      return;
+    }
+
+    const std::uint64_t unitCount  = ((hi - lo) + (granularity - 1u)) / granularity;
+    const unsigned int workerCount = static_cast<unsigned int>(std::min<std::uint64_t>(ResolveThreadCount(threadCount), unitCount));
+    const std::uint64_t perWorker  = (unitCount + (workerCount - 1u)) / workerCount;
+
+    const auto run = [&](unsigned int worker)
+    {
+      const std::uint64_t first = std::min(unitCount, worker * perWorker);
+      const std::uint64_t last  = std::min(unitCount, first + perWorker);
+      if(first < last)
+      {
+        const std::uint64_t chunkLo = lo + (first * granularity);
+        const std::uint64_t chunkHi = (last == unitCount) ? hi : (lo + (last * granularity));
+        work(worker, chunkLo, chunkHi);
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for(unsigned int worker = 1u; worker < workerCount; worker++)
+    {
+      threads.emplace_back(run, worker);
+    }
+
+    run(0u);
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  /*
+   * Segmented sieve of [lo, hi). Each worker sieves its chunk in segments of kSieveSegmentSize numbers and calls
+   * visitor(worker, segmentLo, isPrime, count) once per segment, in ascending order, with isPrime[i] describing
+   * segmentLo + i.
+   */
+  template<class Visitor>
+  void SegmentedSieve(std::uint64_t lo, std::uint64_t hi, unsigned int threadCount, Visitor&& visitor)
+  {
+    if(hi <= lo)
+    {
+      return;
+    }
+
+    const std::vector<std::uint32_t> primes = GetOddPrimes(static_cast<std::uint32_t>(IntegerSqrt(hi - 1u)));
+
+    ForEachChunk(lo,
+                 hi,
+                 kSieveSegmentSize,
+                 threadCount,
+                 [&](unsigned int worker, std::uint64_t chunkLo, std::uint64_t chunkHi)
+                 {
+                   std::vector<std::uint8_t> isPrime(static_cast<std::size_t>(kSieveSegmentSize));
+                   for(std::uint64_t segmentLo = chunkLo; segmentLo < chunkHi; segmentLo += kSieveSegmentSize)
+                   {
+                     const std::uint64_t segmentHi = ((chunkHi - segmentLo) < kSieveSegmentSize) ? chunkHi : (segmentLo + kSieveSegmentSize);
+                     const std::size_t count       = static_cast<std::size_t>(segmentHi - segmentLo);
+                     SieveSegment(primes, segmentLo, segmentHi, isPrime.data());
+                     visitor(worker, segmentLo, static_cast<const std::uint8_t*>(isPrime.data()), count);
+
+                     if(segmentHi == chunkHi)
+                     {
+                       break;
+                     }
+                   }
+                 });
+  }
+
+  // Multiplies sums[i] by sigma(p^e) for every value segmentLo + i divisible by p exactly e times, dividing p^e out of remaining[i]
+  inline void AccumulateDivisorSums(std::uint64_t prime, std::uint64_t segmentLo, std::uint64_t segmentHi, std::uint64_t* remaining, std::uint64_t* sums)
+  {
+    const std::uint64_t count = segmentHi - segmentLo;
+    for(std::uint64_t i = (prime - (segmentLo % prime)) % prime; i < count; i += prime)
+    {
+      std::uint64_t cofactor = remaining[i];
+      std::uint64_t power    = 1u;
+      std::uint64_t sum      = 1u;
+      while((cofactor % prime) == 0u)
+      {
+        cofactor /= prime;
+        power *= prime;
+        sum += power;
+      }
+
+      remaining[i] = cofactor;
+      sums[i] *= sum;
+    }
+  }
+} // namespace Math::Detail
+
+namespace Math
+{
+  // Every range below is half open, [lo, hi). A thread count of zero uses every hardware thread.
+
+  inline std::uint64_t CountPrimes(std::uint64_t lo, std::uint64_t hi, unsigned int threadCount = 0u)
+  {
+    std::vector<std::uint64_t> counts(Detail::ResolveThreadCount(threadCount), 0u);
+    Detail::SegmentedSieve(lo,
+                           hi,
+                           static_cast<unsigned int>(counts.size()),
+                           [&counts](unsigned int worker, std::uint64_t, const std::uint8_t* isPrime, std::size_t count)
+                           {
+                             std::uint64_t sum = 0u;
+                             for(std::size_t i = 0u; i < count; i++)
+                             {
+                               sum += isPrime[i];
+                             }
+
+                             counts[worker] += sum;
+                           });
+
+    std::uint64_t result = 0u;
+    for(const std::uint64_t count : counts)
+    {
+      result += count;
+    }
+
+    return result;
+  }
+
+  // Primes of the range in ascending order
+  inline std::vector<std::uint64_t> GetPrimes(std::uint64_t lo, std::uint64_t hi, unsigned int threadCount = 0u)
+  {
+    std::vector<std::vector<std::uint64_t>> chunks(Detail::ResolveThreadCount(threadCount));
+    Detail::SegmentedSieve(lo,
+                           hi,
+                           static_cast<unsigned int>(chunks.size()),
+                           [&chunks](unsigned int worker, std::uint64_t segmentLo, const std::uint8_t* isPrime, std::size_t count)
+                           {
+                             for(std::size_t i = 0u; i < count; i++)
+                             {
+                               if(isPrime[i] != 0u)
+                               {
+                                 chunks[worker].push_back(segmentLo + i);
+                               }
+                             }
+                           });
+
+    std::vector<std::uint64_t> result;
+    for(const std::vector<std::uint64_t>& chunk : chunks)
+    {
+      result.insert(result.end(), chunk.begin(), chunk.end());
+    }
+
+    return result;
+  }
+
+  // Sets bit i of the bitmap (word i / 64, bit i % 64) when lo + i is prime and clears it otherwise
+  inline void FillPrimeBitmap(std::uint64_t lo, std::uint64_t hi, Math::Span<std::uint64_t> bitmap, unsigned int threadCount = 0u)
+  {
+    assert((hi <= lo) || (bitmap.GetSize() >= (((hi - lo) + 63u) / 64u)));
+
+    // Segments hold a multiple of 64 numbers, so no two threads ever write the same word
+    static_assert((Detail::kSieveSegmentSize % 64u) == 0u);
+
+    Detail::SegmentedSieve(lo,
+                           hi,
+                           threadCount,
+                           [lo, bitmap](unsigned int, std::uint64_t segmentLo, const std::uint8_t* isPrime, std::size_t count)
+                           {
+                             const std::size_t offset = static_cast<std::size_t>(segmentLo - lo);
+                             for(std::size_t word = 0u; (word * 64u) < count; word++)
+                             {
+                               const std::size_t bitCount = std::min<std::size_t>(64u, count - (word * 64u));
+
+                               std::uint64_t bits = 0u;
+                               for(std::size_t bit = 0u; bit < bitCount; bit++)
+                               {
+                                 bits |= std::uint64_t(isPrime[(word * 64u) + bit]) << bit;
+                               }
+
+                               bitmap[(offset / 64u) + word] = bits;
+                             }
+                           });
+  }
+
+  // Largest hi accepted by DivisorSums, sigma(n) < 8n holds well past it so every sum fits in 64 bits
+  constexpr std::uint64_t kDivisorSumLimit = std::uint64_t(1u) << 61u;
+
+  /*
+   * out[i] = sigma(lo + i), the sum of all divisors of lo + i with sigma(0) = 0. Each segment starts from the values
+   * themselves, divides out every prime up to sqrt(hi - 1) while multiplying in sigma(p^e), and whatever cofactor is
+   * left is a single large prime. Total work is O((hi - lo) log log hi).
+   */
+  inline void DivisorSums(std::uint64_t lo, std::uint64_t hi, Math::Span<std::uint64_t> out, unsigned int threadCount = 0u)
+  {
+    assert(hi <= kDivisorSumLimit);
+    assert((hi <= lo) || (out.GetSize() >= (hi - lo)));
+
+    if(hi <= lo)
+    {
+      return;
+    }
+
+    std::vector<std::uint32_t> primes = Detail::GetOddPrimes(static_cast<std::uint32_t>(Detail::IntegerSqrt(hi - 1u)));
+    primes.insert(primes.begin(), 2u);
+
+    Detail::ForEachChunk(lo,
+                         hi,
+                         Detail::kDivisorSegmentSize,
+                         threadCount,
+                         [&](unsigned int, std::uint64_t chunkLo, std::uint64_t chunkHi)
+                         {
+                           std::vector<std::uint64_t> remaining(static_cast<std::size_t>(Detail::kDivisorSegmentSize));
+                           for(std::uint64_t segmentLo = chunkLo; segmentLo < chunkHi; segmentLo += Detail::kDivisorSegmentSize)
+                           {
+                             const std::uint64_t segmentHi = std::min(chunkHi, segmentLo + Detail::kDivisorSegmentSize);
+                             const std::size_t count       = static_cast<std::size_t>(segmentHi - segmentLo);
+                             std::uint64_t* sums           = out.GetData() + (segmentLo - lo);
+
+                             for(std::size_t i = 0u; i < count; i++)
+                             {
+                               remaining[i] = segmentLo + i;
+                               sums[i]      = 1u;
+                             }
+
+                             // Zero is divisible by everything, give it a cofactor of one and patch the result below
+                             if(segmentLo == 0u)
+                             {
+                               remaining[0] = 1u;
+                             }
+
+                             for(const std::uint32_t prime : primes)
+                             {
+                               if((std::uint64_t(prime) * prime) >= segmentHi)
+                               {
+                                 break;
+                               }
+
+                               Detail::AccumulateDivisorSums(prime, segmentLo, segmentHi, remaining.data(), sums);
+                             }
+
+                             for(std::size_t i = 0u; i < count; i++)
+                             {
+                               if(remaining[i] > 1u)
+                               {
+                                 sums[i] *= remaining[i] + 1u;
+                               }
+                             }
+
+                             if(segmentLo == 0u)
+                             {
+                               sums[0] = 0u;
+                             }
+                           }
+                         });
+  }
+
+  inline std::vector<std::uint64_t> DivisorSums(std::uint64_t lo, std::uint64_t hi, unsigned int threadCount = 0u)
+  {
+    std::vector<std::uint64_t> result((hi > lo) ? static_cast<std::size_t>(hi - lo) : 0u);
+    DivisorSums(lo, hi, Math::Span<std::uint64_t>(result), threadCount);
+    return result;
+  }
+} // namespace Math
+
+#endif // __MATH__SIEVE_HPP__
@@ -0,0 +1,93 @@
+#include "Common.hpp"
+#include "Sieve.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  TEST(Sieve, CountPrimes)
+  {
+    ASSERT_EQ(Math::CountPrimes(0u, 0u), 0u);
+    ASSERT_EQ(Math::CountPrimes(0u, 2u), 0u);
+    ASSERT_EQ(Math::CountPrimes(0u, 3u), 1u);
+    ASSERT_EQ(Math::CountPrimes(2u, 3u), 1u);
+    ASSERT_EQ(Math::CountPrimes(0u, 100u), 25u);
+    ASSERT_EQ(Math::CountPrimes(0u, 1000000u, 1u), 78498u);
+    ASSERT_EQ(Math::CountPrimes(0u, 1000000u, 3u), 78498u);
+    ASSERT_EQ(Math::CountPrimes(1000000u, 2000000u, 4u), 70435u);
+  }
+
+  TEST(Sieve, GetPrimes)
+  {
+    // A window straddling 2^32 in several segments, split over more threads than there are segments
+    const std::uint64_t lo = (std::uint64_t(1u) << 32u) - 100000u;
+    const std::uint64_t hi = (std::uint64_t(1u) << 32u) + 100001u;
+
+    const std::vector<std::uint64_t> primes = Math::GetPrimes(lo, hi, 16u);
+
+    std::vector<std::uint64_t> expected;
+    for(std::uint64_t value = lo; value < hi; value++)
+    {
+      if(Math::IsPrime(value))
+      {
+        expected.push_back(value);
+      }
+    }
+
+    ASSERT_EQ(primes, expected);
+    ASSERT_EQ(Math::CountPrimes(lo, hi, 2u), expected.size());
+  }
+
+  TEST(Sieve, FillPrimeBitmap)
+  {
+    const std::uint64_t lo = 999u;
+    const std::uint64_t hi = 200000u;
+
+    std::vector<std::uint64_t> bitmap(((hi - lo) + 63u) / 64u, ~std::uint64_t(0u));
+    Math::FillPrimeBitmap(lo, hi, Math::Span<std::uint64_t>(bitmap), 3u);
+
+    for(std::uint64_t value = lo; value < hi; value++)
+    {
+      const std::uint64_t index = value - lo;
+      const bool actual         = ((bitmap[index / 64u] >> (index % 64u)) & 1u) != 0u;
+      ASSERT_EQ(actual, Math::IsPrime(value)) << value;
+    }
+
+    // Bits past hi in the last word are cleared as well
+    ASSERT_EQ(bitmap.back() >> ((hi - lo) % 64u), 0u);
+  }
+
+  TEST(Sieve, DivisorSums)
+  {
+    const std::vector<std::uint64_t> sums = Math::DivisorSums(0u, 20000u, 3u);
+    ASSERT_EQ(sums.size(), 20000u);
+    ASSERT_EQ(sums[0], 0u);
+    ASSERT_EQ(sums[1], 1u);
+    ASSERT_EQ(sums[12], 28u);
+
+    std::vector<std::uint64_t> perfect;
+    for(std::uint64_t value = 0u; value < sums.size(); value++)
+    {
+      ASSERT_EQ(sums[value], Math::DivisorSum(value)) << value;
+      if((value != 0u) && (sums[value] == (2u * value)))
+      {
+        perfect.push_back(value);
+      }
+    }
+
+    ASSERT_EQ(perfect, (std::vector<std::uint64_t> {6u, 28u, 496u, 8128u}));
+
+    // A window far from zero where many values keep a large prime cofactor
+    const std::uint64_t lo                 = 1000000000000u;
+    const std::vector<std::uint64_t> window = Math::DivisorSums(lo, lo + 5000u, 2u);
+    for(std::uint64_t i = 0u; i < window.size(); i++)
+    {
+      ASSERT_EQ(window[i], Math::DivisorSum(lo + i)) << (lo + i);
+    }
+  }
+} // namespace UnitTest
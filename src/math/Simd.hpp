@@ -0,0 +1,368 @@
+#ifndef __MATH__SIMD_HPP__
+#define __MATH__SIMD_HPP__
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Packed register support is selected from the target flags. Every translation unit must be built with the same
+// selection since it changes the alignment and size of the vector types, define MATH_SIMD_DISABLE to opt out.
+#if !defined(MATH_SIMD_DISABLE)
+  #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define MATH_SIMD_SSE
+  #endif
+  #if defined(__AVX2__)
+    #define MATH_SIMD_AVX2
+  #endif
+#endif
+
+#if defined(MATH_SIMD_AVX2)
+  #include <immintrin.h>
+#elif defined(MATH_SIMD_SSE)
+  #include <emmintrin.h>
+#endif
+
+namespace Math::Simd
+{
+  // Portable four-lane register, used for every type without a hardware-backed register
+  template<class T>
+  struct Lanes
+  {
+    T values[4];
+  };
+
+  // kEnabled is set when Register maps to a hardware register, callers should keep their scalar code path otherwise
+  template<class T>
+  struct Traits
+  {
+    static constexpr bool kEnabled          = false;
+    static constexpr std::size_t kAlignment = alignof(T);
+    static constexpr std::size_t kLanes     = 4u;
+    using Register                          = Lanes<T>;
+  };
+
+  template<class T>
+  inline Lanes<T> Set(T x, T y, T z, T w)
+  {
+    return {{x, y, z, w}};
+  }
+
+  template<class T>
+  inline Lanes<T> Broadcast(T value)
+  {
+    return {{value, value, value, value}};
+  }
+
+  template<class T>
+  inline Lanes<T> Load(const T* values)
+  {
+    return {{values[0], values[1], values[2], values[3]}};
+  }
+
+  template<class T>
+  inline Lanes<T> LoadUnaligned(const T* values)
+  {
+    return Load(values);
+  }
+
+  template<class T>
+  inline void Store(T* values, const Lanes<T>& value)
+  {
+    for(std::size_t i = 0u; i < 4u; i++) values[i] = value.values[i];
+  }
+
+  template<class T>
+  inline void StoreUnaligned(T* values, const Lanes<T>& value)
+  {
+    Store(values, value);
+  }
+
+  template<class T>
+  inline Lanes<T> Add(const Lanes<T>& a, const Lanes<T>& b)
+  {
+    return {{a.values[0] + b.values[0], a.values[1] + b.values[1], a.values[2] + b.values[2], a.values[3] + b.values[3]}};
+  }
+
+  template<class T>
+  inline Lanes<T> Subtract(const Lanes<T>& a, const Lanes<T>& b)
+  {
+    return {{a.values[0] - b.values[0], a.values[1] - b.values[1], a.values[2] - b.values[2], a.values[3] - b.values[3]}};
+  }
+
+  template<class T>
+  inline Lanes<T> Multiply(const Lanes<T>& a, const Lanes<T>& b)
+  {
+    return {{a.values[0] * b.values[0], a.values[1] * b.values[1], a.values[2] * b.values[2], a.values[3] * b.values[3]}};
+  }
+
+  template<class T>
+  inline Lanes<T> Divide(const Lanes<T>& a, const Lanes<T>& b)
+  {
+    return {{a.values[0] / b.values[0], a.values[1] / b.values[1], a.values[2] / b.values[2], a.values[3] / b.values[3]}};
+  }
+
+  template<class T>
+  inline Lanes<T> Sqrt(const Lanes<T>& value)
+  {
+    return {{static_cast<T>(std::sqrt(value.values[0])),
+             static_cast<T>(std::sqrt(value.values[1])),
+             static_cast<T>(std::sqrt(value.values[2])),
+             static_cast<T>(std::sqrt(value.values[3]))}};
+  }
+
+  // Lane-wise (a < b) ? a : b, like the hardware instructions the second operand wins for unordered lanes
+  template<class T>
+  inline Lanes<T> Min(const Lanes<T>& a, const Lanes<T>& b)
+  {
+    Lanes<T> result;
+    for(std::size_t i = 0u; i < 4u; i++) result.values[i] = (a.values[i] < b.values[i]) ? a.values[i] : b.values[i];
+    return result;
+  }
+
+  // Lane-wise (a > b) ? a : b
+  template<class T>
+  inline Lanes<T> Max(const Lanes<T>& a, const Lanes<T>& b)
+  {
+    Lanes<T> result;
+    for(std::size_t i = 0u; i < 4u; i++) result.values[i] = (a.values[i] > b.values[i]) ? a.values[i] : b.values[i];
+    return result;
+  }
+
+  // Lane-wise -1, 0 or 1, zero for unordered lanes
+  template<class T>
+  inline Lanes<T> Sign(const Lanes<T>& value)
+  {
+    constexpr T kZero = static_cast<T>(0);
+
+    Lanes<T> result;
+    for(std::size_t i = 0u; i < 4u; i++) result.values[i] = static_cast<T>((value.values[i] > kZero) - (value.values[i] < kZero));
+    return result;
+  }
+
+  // Without a hardware estimate the portable register computes the reciprocal square root exactly
+  template<class T>
+  inline Lanes<T> ReciprocalSqrtEstimate(const Lanes<T>& value)
+  {
+    constexpr T kOne = static_cast<T>(1);
+
+    Lanes<T> result;
+    for(std::size_t i = 0u; i < 4u; i++) result.values[i] = kOne / static_cast<T>(std::sqrt(value.values[i]));
+    return result;
+  }
+
+  // True when every lane lies in [low, high], false for unordered lanes
+  template<class T>
+  inline bool AllWithin(const Lanes<T>& value, const Lanes<T>& low, const Lanes<T>& high)
+  {
+    bool result = true;
+    for(std::size_t i = 0u; i < 4u; i++) result = result && (value.values[i] >= low.values[i]) && (value.values[i] <= high.values[i]);
+    return result;
+  }
+
+  // Bit i is set when lane i of a is at least lane i of b, clear for unordered lanes
+  template<class T>
+  inline int GreaterEqualMask(const Lanes<T>& a, const Lanes<T>& b)
+  {
+    int result = 0;
+    for(std::size_t i = 0u; i < 4u; i++) result |= (a.values[i] >= b.values[i]) ? (1 << i) : 0;
+    return result;
+  }
+
+  template<int I0, int I1, int I2, int I3, class T>
+  inline Lanes<T> Shuffle(const Lanes<T>& value)
+  {
+    return {{value.values[I0], value.values[I1], value.values[I2], value.values[I3]}};
+  }
+
+  template<class T>
+  inline T HorizontalSum(const Lanes<T>& value)
+  {
+    return (value.values[0] + value.values[1]) + (value.values[2] + value.values[3]);
+  }
+
+#if defined(MATH_SIMD_SSE)
+  template<>
+  struct Traits<float>
+  {
+    static constexpr bool kEnabled          = true;
+    static constexpr std::size_t kAlignment = 16u;
+    static constexpr std::size_t kLanes     = 4u;
+    using Register                          = __m128;
+  };
+
+  inline __m128 Set(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+  inline __m128 Broadcast(float value) { return _mm_set1_ps(value); }
+  inline __m128 Load(const float* values) { return _mm_load_ps(values); }
+  inline __m128 LoadUnaligned(const float* values) { return _mm_loadu_ps(values); }
+  inline void Store(float* values, __m128 value) { _mm_store_ps(values, value); }
+  inline void StoreUnaligned(float* values, __m128 value) { _mm_storeu_ps(values, value); }
+
+  inline __m128 Add(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+  inline __m128 Subtract(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+  inline __m128 Multiply(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+  inline __m128 Divide(__m128 a, __m128 b) { return _mm_div_ps(a, b); }
+  inline __m128 Sqrt(__m128 value) { return _mm_sqrt_ps(value); }
+  inline __m128 Xor(__m128 a, __m128 b) { return _mm_xor_ps(a, b); }
+  inline __m128 Min(__m128 a, __m128 b) { return _mm_min_ps(a, b); }
+  inline __m128 Max(__m128 a, __m128 b) { return _mm_max_ps(a, b); }
+
+  // Relative error at most 1.5 * 2^-12 for positive normal inputs
+  inline __m128 ReciprocalSqrtEstimate(__m128 value) { return _mm_rsqrt_ps(value); }
+
+  inline bool AllWithin(__m128 value, __m128 low, __m128 high)
+  {
+    return _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(value, low), _mm_cmple_ps(value, high))) == 0xF;
+  }
+
+  inline int GreaterEqualMask(__m128 a, __m128 b) { return _mm_movemask_ps(_mm_cmpge_ps(a, b)); }
+
+  // Comparison masks select 1.0 bit patterns, (value > 0) - (value < 0) without branches
+  inline __m128 Sign(__m128 value)
+  {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one  = _mm_set1_ps(1.0f);
+    return _mm_sub_ps(_mm_and_ps(_mm_cmpgt_ps(value, zero), one), _mm_and_ps(_mm_cmplt_ps(value, zero), one));
+  }
+
+  template<int I0, int I1, int I2, int I3>
+  inline __m128 Shuffle(__m128 value)
+  {
+    return _mm_shuffle_ps(value, value, _MM_SHUFFLE(I3, I2, I1, I0));
+  }
+
+  // Sums as (x + y) + (z + w), which matches a scalar left-to-right sum whenever w is zero
+  inline float HorizontalSum(__m128 value)
+  {
+    const __m128 pairs = _mm_add_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_movehl_ps(pairs, pairs)));
+  }
+
+  // Two double lanes, for batch kernels that still pack double below AVX2. Only lane-wise operations are overloaded since
+  // Broadcast, Load and Store would collide with the register of Traits<double>, kernels spell those out themselves.
+  inline __m128d Add(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+  inline __m128d Subtract(__m128d a, __m128d b) { return _mm_sub_pd(a, b); }
+  inline __m128d Multiply(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+
+  inline bool AllWithin(__m128d value, __m128d low, __m128d high)
+  {
+    return _mm_movemask_pd(_mm_and_pd(_mm_cmpge_pd(value, low), _mm_cmple_pd(value, high))) == 0x3;
+  }
+
+#endif
+
+#if defined(MATH_SIMD_AVX2)
+  template<>
+  struct Traits<double>
+  {
+    static constexpr bool kEnabled          = true;
+    static constexpr std::size_t kAlignment = 32u;
+    static constexpr std::size_t kLanes     = 4u;
+    using Register                          = __m256d;
+  };
+
+  inline __m256d Set(double x, double y, double z, double w) { return _mm256_setr_pd(x, y, z, w); }
+  inline __m256d Broadcast(double value) { return _mm256_set1_pd(value); }
+  inline __m256d Load(const double* values) { return _mm256_load_pd(values); }
+  inline __m256d LoadUnaligned(const double* values) { return _mm256_loadu_pd(values); }
+  inline void Store(double* values, __m256d value) { _mm256_store_pd(values, value); }
+  inline void StoreUnaligned(double* values, __m256d value) { _mm256_storeu_pd(values, value); }
+
+  inline __m256d Add(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+  inline __m256d Subtract(__m256d a, __m256d b) { return _mm256_sub_pd(a, b); }
+  inline __m256d Multiply(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+  inline __m256d Divide(__m256d a, __m256d b) { return _mm256_div_pd(a, b); }
+  inline __m256d Sqrt(__m256d value) { return _mm256_sqrt_pd(value); }
+  inline __m256d Xor(__m256d a, __m256d b) { return _mm256_xor_pd(a, b); }
+  inline __m256d Min(__m256d a, __m256d b) { return _mm256_min_pd(a, b); }
+  inline __m256d Max(__m256d a, __m256d b) { return _mm256_max_pd(a, b); }
+
+  // There is no double estimate below AVX-512, the float one is reused so lanes must fit the float range
+  inline __m256d ReciprocalSqrtEstimate(__m256d value) { return _mm256_cvtps_pd(_mm_rsqrt_ps(_mm256_cvtpd_ps(value))); }
+
+  inline bool AllWithin(__m256d value, __m256d low, __m256d high)
+  {
+    return _mm256_movemask_pd(_mm256_and_pd(_mm256_cmp_pd(value, low, _CMP_GE_OQ), _mm256_cmp_pd(value, high, _CMP_LE_OQ))) == 0xF;
+  }
+
+  inline int GreaterEqualMask(__m256d a, __m256d b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GE_OQ)); }
+
+  inline __m256d Sign(__m256d value)
+  {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one  = _mm256_set1_pd(1.0);
+    return _mm256_sub_pd(_mm256_and_pd(_mm256_cmp_pd(value, zero, _CMP_GT_OQ), one), _mm256_and_pd(_mm256_cmp_pd(value, zero, _CMP_LT_OQ), one));
+  }
+
+  template<int I0, int I1, int I2, int I3>
+  inline __m256d Shuffle(__m256d value)
+  {
+    return _mm256_permute4x64_pd(value, I0 | (I1 << 2) | (I2 << 4) | (I3 << 6));
+  }
+
+  inline double HorizontalSum(__m256d value)
+  {
+    const __m128d low     = _mm256_castpd256_pd128(value);
+    const __m128d high    = _mm256_extractf128_pd(value, 1);
+    const __m128d sumLow  = _mm_add_sd(low, _mm_unpackhi_pd(low, low));
+    const __m128d sumHigh = _mm_add_sd(high, _mm_unpackhi_pd(high, high));
+    return _mm_cvtsd_f64(_mm_add_sd(sumLow, sumHigh));
+  }
+
+#endif
+
+  // Lane-wise sign flip, a set flag negates the corresponding lane
+  template<bool X, bool Y, bool Z, bool W, class R>
+  inline R Negate(R value)
+  {
+    using T          = decltype(HorizontalSum(value));
+    constexpr T kOff = static_cast<T>(0);
+    constexpr T kOn  = static_cast<T>(-0.0);
+    return Xor(value, Set(X ? kOn : kOff, Y ? kOn : kOff, Z ? kOn : kOff, W ? kOn : kOff));
+  }
+
+  template<bool X, bool Y, bool Z, bool W, class T>
+  inline Lanes<T> Negate(const Lanes<T>& value)
+  {
+    return {{X ? -value.values[0] : value.values[0],
+             Y ? -value.values[1] : value.values[1],
+             Z ? -value.values[2] : value.values[2],
+             W ? -value.values[3] : value.values[3]}};
+  }
+} // namespace Math::Simd
+
+namespace Math::Detail
+{
+  // Writes the indices passing a test to out, packed(i) tests the aligned block [i, i + 4) into a lane mask and
+  // scalar(i) a single index of the tail. Compaction is branchless: every index is written and only passing ones advance.
+  template<class T, class Packed, class Scalar>
+  void CompactIndices(std::size_t count, std::vector<std::size_t>& out, Packed&& packed, Scalar&& scalar)
+  {
+    out.resize(count);
+    std::size_t* o    = out.data();
+    std::size_t kept  = 0u;
+    std::size_t first = 0u;
+
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      for(; (first + 4u) <= count; first += 4u)
+      {
+        const int mask = packed(first);
+        for(std::size_t lane = 0u; lane < 4u; lane++)
+        {
+          o[kept] = first + lane;
+          kept += static_cast<std::size_t>((mask >> lane) & 1);
+        }
+      }
+    }
+
+    for(std::size_t i = first; i < count; i++)
+    {
+      o[kept] = i;
+      kept += scalar(i) ? 1u : 0u;
+    }
+
+    out.resize(kept);
+  }
+} // namespace Math::Detail
+
+#endif // __MATH__SIMD_HPP__
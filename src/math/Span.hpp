@@ -0,0 +1,79 @@
+#ifndef __MATH__SPAN_HPP__
+#define __MATH__SPAN_HPP__
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace Math
+{
+  // Non-owning view over a contiguous sequence, a C++17 stand-in for std::span<T>
+  template<class T>
+  class Span
+  {
+    public:
+    using value_type = std::remove_cv_t<T>;
+
+    T& operator[](std::size_t index) const
+    {
+      assert(index < m_Size);
+      return m_Data[index];
+    }
+
+    T* begin() const { return m_Data; }
+    T* end() const { return m_Data + m_Size; }
+
+    T* GetData() const { return m_Data; }
+    std::size_t GetSize() const { return m_Size; }
+    bool IsEmpty() const { return m_Size == 0u; }
+
+    Span<T> Subspan(std::size_t offset, std::size_t count) const
+    {
+      assert((offset <= m_Size) && (count <= (m_Size - offset)));
+      return Span<T>(m_Data + offset, count);
+    }
+
+    Span<T> Subspan(std::size_t offset) const
+    {
+      assert(offset <= m_Size);
+      return Span<T>(m_Data + offset, m_Size - offset);
+    }
+
+    constexpr Span(T* data, std::size_t size)
+        : m_Data(data)
+        , m_Size(size)
+    {}
+
+    template<std::size_t N>
+    constexpr Span(T (&array)[N])
+        : m_Data(array)
+        , m_Size(N)
+    {}
+
+    template<class U, std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>, bool> = true>
+    constexpr Span(const Span<U>& other)
+        : m_Data(other.GetData())
+        , m_Size(other.GetSize())
+    {}
+
+    template<class C,
+             std::enable_if_t<!std::is_array_v<C> && std::is_convertible_v<std::remove_pointer_t<decltype(std::data(std::declval<C&>()))> (*)[], T (*)[]>,
+                              bool> = true>
+    constexpr Span(C& container)
+        : m_Data(std::data(container))
+        , m_Size(std::size(container))
+    {}
+
+    constexpr Span()
+        : m_Data(nullptr)
+        , m_Size(0u)
+    {}
+
+    private:
+    T* m_Data;
+    std::size_t m_Size;
+  };
+} // namespace Math
+
+#endif // __MATH__SPAN_HPP__
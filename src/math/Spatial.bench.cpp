@@ -0,0 +1,123 @@
+#include "Benchmark.hpp"
+#include "KdTree.hpp"
+#include "Parallel.hpp"
+#include "Spatial.hpp"
+#include "UniformGrid.hpp"
+#include "Vector3.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Benchmark
+{
+  // Points spread evenly over (-100, 100)^3, queried with themselves as in a proximity pass. CreateScalar is linear in
+  // its index, so the coordinates come from a generator of their own to keep the points off a few lines
+  template<class T>
+  static std::vector<Vector3<T>> CreateCloud(std::size_t count)
+  {
+    std::uint32_t state   = 12345u;
+    const auto coordinate = [&]()
+    {
+      state = (state * 1664525u) + 1013904223u;
+      return static_cast<T>((static_cast<double>(state >> 8u) / 83886.08) - 100.0);
+    };
+
+    std::vector<Vector3<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T x = coordinate();
+      const T y = coordinate();
+      result.push_back(Vector3<T>(x, y, coordinate()));
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static bool RegisterSpatial()
+  {
+    RegisterBatch(Name<T>("Spatial_BruteNearest"),
+                  [](std::size_t count)
+                  {
+                    return [points = CreateCloud<T>(count)]()
+                    {
+                      for(const Vector3<T>& query : points)
+                      {
+                        std::size_t best = Math::kNoPoint;
+                        T bestDistance   = std::numeric_limits<T>::infinity();
+                        for(std::size_t i = 0u; i < points.size(); i++)
+                        {
+                          const T distance = Vector3<T>::SquareDistance(points[i], query);
+                          best             = (distance < bestDistance) ? i : best;
+                          bestDistance     = (distance < bestDistance) ? distance : bestDistance;
+                        }
+
+                        benchmark::DoNotOptimize(best);
+                      }
+                    };
+                  });
+
+    RegisterBatch(Name<T>("Spatial_KdTreeBuild"),
+                  [](std::size_t count)
+                  {
+                    return [points = CreateCloud<T>(count), tree = KdTree<T>()]() mutable
+                    {
+                      tree.Build(points);
+                      benchmark::DoNotOptimize(tree.GetSize());
+                    };
+                  });
+
+    RegisterBatch(Name<T>("Spatial_KdTreeNearest"),
+                  [](std::size_t count)
+                  {
+                    std::vector<Vector3<T>> points = CreateCloud<T>(count);
+                    const KdTree<T> tree(points);
+                    return [points, tree]()
+                    {
+                      for(const Vector3<T>& query : points)
+                      {
+                        benchmark::DoNotOptimize(tree.Nearest(query));
+                      }
+                    };
+                  });
+
+    RegisterBatch(Name<T>("Spatial_GridBuild"),
+                  [](std::size_t count)
+                  {
+                    return [points = CreateCloud<T>(count), grid = UniformGrid<T>()]() mutable
+                    {
+                      grid.Build(points, static_cast<T>(8));
+                      benchmark::DoNotOptimize(grid.GetSize());
+                    };
+                  });
+
+    RegisterBatch(Name<T>("Spatial_GridNearest"),
+                  [](std::size_t count)
+                  {
+                    std::vector<Vector3<T>> points = CreateCloud<T>(count);
+                    const UniformGrid<T> grid(points, static_cast<T>(8));
+                    return [points, grid]()
+                    {
+                      for(const Vector3<T>& query : points)
+                      {
+                        benchmark::DoNotOptimize(grid.Nearest(query));
+                      }
+                    };
+                  });
+
+    RegisterBatch(Name<T>("Spatial_ParallelRadius"),
+                  [](std::size_t count)
+                  {
+                    std::vector<Vector3<T>> points = CreateCloud<T>(count);
+                    const KdTree<T> tree(points);
+                    return [points, tree, out = std::vector<std::vector<std::size_t>>()]() mutable
+                    { Math::Parallel::Radius(tree, Math::Span<const Vector3<T>>(points), static_cast<T>(10), out); };
+                  });
+
+    return true;
+  }
+
+  static const bool kSpatialRegistered = RegisterSpatial<float>() && RegisterSpatial<double>();
+} // namespace Benchmark
@@ -0,0 +1,157 @@
+#ifndef __MATH__SPATIAL_HPP__
+#define __MATH__SPATIAL_HPP__
+
+#include "Parallel.hpp"
+#include "Span.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/*
+ * Shared parts of the spatial indices over Vector3 points (KdTree, UniformGrid). Indices answer with positions in the
+ * span they were built from. Every query compares squared distances; ties are broken by the lower point index, so
+ * both indices and a brute force scan return the same neighbours.
+ */
+namespace Math
+{
+  // Nearest() result of an empty index
+  constexpr std::size_t kNoPoint = std::numeric_limits<std::size_t>::max();
+} // namespace Math
+
+namespace Math::Detail
+{
+  // The count closest candidates seen so far, kept as a max-heap on (square distance, index)
+  template<class T>
+  class NeighborHeap
+  {
+    public:
+    // Square distance a candidate has to beat, infinite until the heap is full
+    T GetBound() const { return (m_Entries.size() < m_Count) ? std::numeric_limits<T>::infinity() : m_Entries.front().first; }
+
+    void Offer(T squareDistance, std::size_t index)
+    {
+      const Entry entry(squareDistance, index);
+      if(m_Entries.size() < m_Count)
+      {
+        m_Entries.push_back(entry);
+        std::push_heap(m_Entries.begin(), m_Entries.end());
+      }
+      else if(entry < m_Entries.front())
+      {
+        std::pop_heap(m_Entries.begin(), m_Entries.end());
+        m_Entries.back() = entry;
+        std::push_heap(m_Entries.begin(), m_Entries.end());
+      }
+    }
+
+    // Indices closest first, empties the heap
+    void Extract(std::vector<std::size_t>& out)
+    {
+      std::sort_heap(m_Entries.begin(), m_Entries.end());
+      out.clear();
+      for(const Entry& entry : m_Entries)
+      {
+        out.push_back(entry.second);
+      }
+
+      m_Entries.clear();
+    }
+
+    explicit NeighborHeap(std::size_t count)
+        : m_Count(count)
+    {
+      m_Entries.reserve(count);
+    }
+
+    private:
+    using Entry = std::pair<T, std::size_t>;
+
+    std::vector<Entry> m_Entries;
+    std::size_t m_Count;
+  };
+
+  // Closest candidate of a single nearest query
+  template<class T>
+  struct NearestCandidate
+  {
+    T squareDistance  = std::numeric_limits<T>::infinity();
+    std::size_t index = kNoPoint;
+
+    T GetBound() const { return squareDistance; }
+
+    void Offer(T candidate, std::size_t candidateIndex)
+    {
+      if((candidate < squareDistance) || ((candidate == squareDistance) && (candidateIndex < index)))
+      {
+        squareDistance = candidate;
+        index          = candidateIndex;
+      }
+    }
+  };
+
+  template<class T>
+  T SquareDistance(const Vector3<T>& query, T x, T y, T z)
+  {
+    const T dx = x - query.GetX();
+    const T dy = y - query.GetY();
+    const T dz = z - query.GetZ();
+    return (dx * dx) + (dy * dy) + (dz * dz);
+  }
+
+  template<class T>
+  bool IsInBox(const Vector3<T>& min, const Vector3<T>& max, T x, T y, T z)
+  {
+    return (x >= min.GetX()) && (x <= max.GetX()) && (y >= min.GetY()) && (y <= max.GetY()) && (z >= min.GetZ()) && (z <= max.GetZ());
+  }
+} // namespace Math::Detail
+
+namespace Math::Parallel
+{
+  // Queries per block, a query costs far more than an element of the arithmetic kernels
+  constexpr std::size_t kQueryGrain = 64u;
+
+  // out[i] = index.Nearest(queries[i])
+  template<class Index, class T>
+  void Nearest(const Index& index,
+               Math::Span<const Vector3<T>> queries,
+               Math::Span<std::size_t> out,
+               std::size_t grain = kQueryGrain,
+               ThreadPool& pool  = ThreadPool::GetDefault())
+  {
+    assert(out.GetSize() == queries.GetSize());
+    For(0u, queries.GetSize(), [&](std::size_t i) { out[i] = index.Nearest(queries[i]); }, grain, pool);
+  }
+
+  // out[i] = the count points closest to queries[i], closest first
+  template<class Index, class T>
+  void Nearest(const Index& index,
+               Math::Span<const Vector3<T>> queries,
+               std::size_t count,
+               std::vector<std::vector<std::size_t>>& out,
+               std::size_t grain = kQueryGrain,
+               ThreadPool& pool  = ThreadPool::GetDefault())
+  {
+    out.resize(queries.GetSize());
+    For(0u, queries.GetSize(), [&](std::size_t i) { index.Nearest(queries[i], count, out[i]); }, grain, pool);
+  }
+
+  // out[i] = the points within radius of queries[i], in no particular order
+  template<class Index, class T>
+  void Radius(const Index& index,
+              Math::Span<const Vector3<T>> queries,
+              T radius,
+              std::vector<std::vector<std::size_t>>& out,
+              std::size_t grain = kQueryGrain,
+              ThreadPool& pool  = ThreadPool::GetDefault())
+  {
+    out.resize(queries.GetSize());
+    For(0u, queries.GetSize(), [&](std::size_t i) { index.Radius(queries[i], radius, out[i]); }, grain, pool);
+  }
+} // namespace Math::Parallel
+
+#endif // __MATH__SPATIAL_HPP__
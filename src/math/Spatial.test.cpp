@@ -0,0 +1,209 @@
+#include "KdTree.hpp"
+#include "Parallel.hpp"
+#include "Spatial.hpp"
+#include "UniformGrid.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  // Deterministic points in [-scale, scale)^3, with every seventh one repeated to force distance ties
+  template<class T>
+  static std::vector<Vector3<T>> CreatePoints(std::size_t count, std::uint32_t seed, T scale)
+  {
+    std::uint32_t state   = seed;
+    const auto coordinate = [&]()
+    {
+      state = (state * 1664525u) + 1013904223u;
+      return ((static_cast<T>(state >> 8u) / static_cast<T>(1u << 24u)) * static_cast<T>(2) - static_cast<T>(1)) * scale;
+    };
+
+    std::vector<Vector3<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T x = coordinate();
+      const T y = coordinate();
+      const T z = coordinate();
+      result.push_back(((i % 7u) == 6u) ? result[i - 3u] : Vector3<T>(x, y, z));
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static std::vector<std::size_t> BruteNearest(const std::vector<Vector3<T>>& points, const Vector3<T>& query, std::size_t count)
+  {
+    std::vector<std::pair<T, std::size_t>> order;
+    for(std::size_t i = 0u; i < points.size(); i++)
+    {
+      order.push_back(std::make_pair(Vector3<T>::SquareDistance(points[i], query), i));
+    }
+
+    std::sort(order.begin(), order.end());
+    std::vector<std::size_t> result;
+    for(std::size_t i = 0u; i < std::min(count, order.size()); i++)
+    {
+      result.push_back(order[i].second);
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static std::vector<std::size_t> BruteRadius(const std::vector<Vector3<T>>& points, const Vector3<T>& query, T radius)
+  {
+    std::vector<std::size_t> result;
+    for(std::size_t i = 0u; i < points.size(); i++)
+    {
+      if(Vector3<T>::SquareDistance(points[i], query) <= (radius * radius))
+      {
+        result.push_back(i);
+      }
+    }
+
+    return result;
+  }
+
+  template<class Index>
+  struct IndexTraits;
+
+  template<class T>
+  struct IndexTraits<KdTree<T>>
+  {
+    using Scalar = T;
+
+    static KdTree<T> Create(Math::Span<const Vector3<T>> points) { return KdTree<T>(points); }
+  };
+
+  template<class T>
+  struct IndexTraits<UniformGrid<T>>
+  {
+    using Scalar = T;
+
+    static UniformGrid<T> Create(Math::Span<const Vector3<T>> points) { return UniformGrid<T>(points, static_cast<T>(4)); }
+  };
+
+  template<class Index>
+  class SpatialTyped : public Test
+  {};
+
+  using SpatialTypes = Types<KdTree<float>, KdTree<double>, UniformGrid<float>, UniformGrid<double>>;
+  TYPED_TEST_SUITE(SpatialTyped, SpatialTypes);
+
+  TYPED_TEST(SpatialTyped, Empty)
+  {
+    using Index = TypeParam;
+    using T     = typename IndexTraits<Index>::Scalar;
+
+    const std::vector<Vector3<T>> none;
+    const Index index = IndexTraits<Index>::Create(Math::Span<const Vector3<T>>(none));
+    ASSERT_TRUE(index.IsEmpty());
+    ASSERT_EQ(index.Nearest(Vector3<T>::One), Math::kNoPoint);
+
+    std::vector<std::size_t> out = {1u, 2u};
+    index.Nearest(Vector3<T>::One, 3u, out);
+    ASSERT_TRUE(out.empty());
+    out = {1u};
+    index.Radius(Vector3<T>::One, static_cast<T>(100), out);
+    ASSERT_TRUE(out.empty());
+    index.Box(-Vector3<T>::One, Vector3<T>::One, out);
+    ASSERT_TRUE(out.empty());
+  }
+
+  TYPED_TEST(SpatialTyped, Queries)
+  {
+    using Index = TypeParam;
+    using T     = typename IndexTraits<Index>::Scalar;
+
+    const std::vector<Vector3<T>> points = CreatePoints<T>(3000u, 17u, static_cast<T>(40));
+    const Index index                    = IndexTraits<Index>::Create(Math::Span<const Vector3<T>>(points));
+    ASSERT_EQ(index.GetSize(), points.size());
+
+    // Queries among the points, on the points themselves and far outside of them
+    std::vector<Vector3<T>> queries = CreatePoints<T>(200u, 5u, static_cast<T>(50));
+    queries.push_back(points[42]);
+    queries.push_back(Vector3<T>(static_cast<T>(1000), static_cast<T>(-3), static_cast<T>(7)));
+    queries.push_back(Vector3<T>(static_cast<T>(-500), static_cast<T>(-500), static_cast<T>(-500)));
+
+    std::vector<std::size_t> out;
+    for(const Vector3<T>& query : queries)
+    {
+      ASSERT_EQ(index.Nearest(query), BruteNearest(points, query, 1u)[0]);
+
+      index.Nearest(query, 10u, out);
+      ASSERT_EQ(out, BruteNearest(points, query, 10u));
+
+      index.Radius(query, static_cast<T>(6), out);
+      std::sort(out.begin(), out.end());
+      ASSERT_EQ(out, BruteRadius(points, query, static_cast<T>(6)));
+
+      const Vector3<T> extent(static_cast<T>(3), static_cast<T>(8), static_cast<T>(5));
+      index.Box(query - extent, query + extent, out);
+      std::sort(out.begin(), out.end());
+
+      std::vector<std::size_t> expected;
+      for(std::size_t i = 0u; i < points.size(); i++)
+      {
+        if(Math::Detail::IsInBox(query - extent, query + extent, points[i].GetX(), points[i].GetY(), points[i].GetZ()))
+        {
+          expected.push_back(i);
+        }
+      }
+
+      ASSERT_EQ(out, expected);
+    }
+
+    // More neighbours than points, none at all, a radius covering everything and invalid ranges
+    index.Nearest(queries[0], 5000u, out);
+    ASSERT_EQ(out, BruteNearest(points, queries[0], 5000u));
+    index.Nearest(queries[0], 0u, out);
+    ASSERT_TRUE(out.empty());
+    index.Radius(queries[0], static_cast<T>(1000), out);
+    ASSERT_EQ(out.size(), points.size());
+    index.Radius(queries[0], static_cast<T>(-1), out);
+    ASSERT_TRUE(out.empty());
+    index.Box(Vector3<T>::One, -Vector3<T>::One, out);
+    ASSERT_TRUE(out.empty());
+  }
+
+  TYPED_TEST(SpatialTyped, Parallel)
+  {
+    using Index = TypeParam;
+    using T     = typename IndexTraits<Index>::Scalar;
+
+    const std::vector<Vector3<T>> points  = CreatePoints<T>(2000u, 3u, static_cast<T>(30));
+    const std::vector<Vector3<T>> queries = CreatePoints<T>(500u, 11u, static_cast<T>(30));
+    const Index index                     = IndexTraits<Index>::Create(Math::Span<const Vector3<T>>(points));
+    Math::Parallel::ThreadPool pool(3u);
+
+    std::vector<std::size_t> nearest(queries.size());
+    Math::Parallel::Nearest(index, Math::Span<const Vector3<T>>(queries), Math::Span<std::size_t>(nearest), 16u, pool);
+
+    std::vector<std::vector<std::size_t>> neighbors;
+    Math::Parallel::Nearest(index, Math::Span<const Vector3<T>>(queries), 4u, neighbors, 16u, pool);
+
+    std::vector<std::vector<std::size_t>> within;
+    Math::Parallel::Radius(index, Math::Span<const Vector3<T>>(queries), static_cast<T>(5), within, 16u, pool);
+
+    ASSERT_EQ(neighbors.size(), queries.size());
+    ASSERT_EQ(within.size(), queries.size());
+    std::vector<std::size_t> out;
+    for(std::size_t i = 0u; i < queries.size(); i++)
+    {
+      ASSERT_EQ(nearest[i], index.Nearest(queries[i]));
+      index.Nearest(queries[i], 4u, out);
+      ASSERT_EQ(neighbors[i], out);
+      index.Radius(queries[i], static_cast<T>(5), out);
+      ASSERT_EQ(within[i], out);
+    }
+  }
+} // namespace UnitTest
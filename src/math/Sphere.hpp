@@ -0,0 +1,69 @@
+#ifndef __MATH__SPHERE_HPP__
+#define __MATH__SPHERE_HPP__
+
+#include "AABB.hpp"
+#include "Plane.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+// Closed ball of the points within radius of the center
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class Sphere
+{
+  public:
+  constexpr bool operator==(const Sphere<T>& rhs) const { return (m_Center == rhs.m_Center) && (m_Radius == rhs.m_Radius); }
+  constexpr bool operator!=(const Sphere<T>& rhs) const { return !((*this) == rhs); }
+
+  constexpr bool Contains(const Vector3<T>& point) const { return Vector3<T>::SquareDistance(m_Center, point) <= (m_Radius * m_Radius); }
+
+  constexpr bool Contains(const Sphere<T>& other) const
+  {
+    const T room = m_Radius - other.m_Radius;
+    return (room >= static_cast<T>(0)) && (Vector3<T>::SquareDistance(m_Center, other.m_Center) <= (room * room));
+  }
+
+  constexpr bool Overlaps(const Sphere<T>& other) const
+  {
+    const T reach = m_Radius + other.m_Radius;
+    return Vector3<T>::SquareDistance(m_Center, other.m_Center) <= (reach * reach);
+  }
+
+  // Distance to the closest point of the box, measured on the clamped center
+  constexpr bool Overlaps(const AABB<T>& box) const
+  {
+    const Vector3<T> closest(std::clamp(m_Center.GetX(), box.GetMin().GetX(), box.GetMax().GetX()),
+                             std::clamp(m_Center.GetY(), box.GetMin().GetY(), box.GetMax().GetY()),
+                             std::clamp(m_Center.GetZ(), box.GetMin().GetZ(), box.GetMax().GetZ()));
+    return Contains(closest);
+  }
+
+  // Expects a normalized plane
+  constexpr Math::Containment Classify(const Plane<T>& plane) const
+  {
+    const T distance = plane.GetDistance(m_Center);
+    return (distance < -m_Radius) ? Math::Containment::Outside : ((distance >= m_Radius) ? Math::Containment::Inside : Math::Containment::Intersecting);
+  }
+
+  constexpr AABB<T> GetBounds() const { return AABB<T>::FromCenterExtent(m_Center, Vector3<T>(m_Radius, m_Radius, m_Radius)); }
+
+  constexpr const Vector3<T>& GetCenter() const { return m_Center; }
+  constexpr T GetRadius() const { return m_Radius; }
+
+  constexpr Sphere(const Vector3<T>& center, T radius)
+      : m_Center(center)
+      , m_Radius(radius)
+  {}
+
+  constexpr Sphere()
+      : m_Center()
+      , m_Radius(static_cast<T>(0))
+  {}
+
+  private:
+  Vector3<T> m_Center;
+  T m_Radius;
+};
+
+#endif // __MATH__SPHERE_HPP__
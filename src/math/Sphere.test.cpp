@@ -0,0 +1,63 @@
+#include "AABB.hpp"
+#include "Plane.hpp"
+#include "Sphere.hpp"
+#include "Vector3.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class SphereTyped : public Test
+  {};
+
+  using SphereTypes = Types<float, double>;
+  TYPED_TEST_SUITE(SphereTyped, SphereTypes);
+
+  TYPED_TEST(SphereTyped, Containment)
+  {
+    using T = TypeParam;
+
+    const Sphere<T> sphere(Vector3<T>(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0)), static_cast<T>(2));
+    ASSERT_TRUE(sphere.Contains(Vector3<T>(static_cast<T>(3), static_cast<T>(0), static_cast<T>(0))));
+    ASSERT_FALSE(sphere.Contains(Vector3<T>(static_cast<T>(2.5), static_cast<T>(1.5), static_cast<T>(0))));
+    ASSERT_TRUE(sphere.Contains(Sphere<T>(Vector3<T>::Right, static_cast<T>(1))));
+    ASSERT_FALSE(sphere.Contains(Sphere<T>(Vector3<T>::Left, static_cast<T>(1))));
+    ASSERT_FALSE(Sphere<T>(Vector3<T>::Zero, static_cast<T>(1)).Contains(sphere));
+
+    ASSERT_TRUE(sphere.Overlaps(Sphere<T>(Vector3<T>(static_cast<T>(-2), static_cast<T>(0), static_cast<T>(0)), static_cast<T>(1))));
+    ASSERT_FALSE(sphere.Overlaps(Sphere<T>(Vector3<T>(static_cast<T>(-2), static_cast<T>(0), static_cast<T>(0)), static_cast<T>(0.5))));
+
+    static_assert(Sphere<T>(Vector3<T>::Zero, static_cast<T>(1)).Contains(Vector3<T>::Up));
+  }
+
+  TYPED_TEST(SphereTyped, Box)
+  {
+    using T = TypeParam;
+
+    const AABB<T> box(Vector3<T>::Zero, Vector3<T>::One);
+    const Sphere<T> sphere(Vector3<T>(static_cast<T>(2), static_cast<T>(2), static_cast<T>(0.5)), static_cast<T>(1.5));
+
+    // Close to the box along each axis but past its corner
+    ASSERT_TRUE(sphere.Overlaps(box));
+    ASSERT_FALSE(Sphere<T>(Vector3<T>(static_cast<T>(2), static_cast<T>(2), static_cast<T>(2)), static_cast<T>(1.5)).Overlaps(box));
+    ASSERT_TRUE(Sphere<T>(Vector3<T>(static_cast<T>(0.5), static_cast<T>(0.5), static_cast<T>(0.5)), static_cast<T>(0.1)).Overlaps(box));
+
+    const AABB<T> bounds = sphere.GetBounds();
+    ASSERT_TRUE(bounds.GetMin() == Vector3<T>(static_cast<T>(0.5), static_cast<T>(0.5), static_cast<T>(-1)));
+    ASSERT_TRUE(bounds.GetMax() == Vector3<T>(static_cast<T>(3.5), static_cast<T>(3.5), static_cast<T>(2)));
+  }
+
+  TYPED_TEST(SphereTyped, Classify)
+  {
+    using T = TypeParam;
+
+    const Plane<T> plane = Plane<T>::FromPointNormal(Vector3<T>::Zero, Vector3<T>::Up);
+    ASSERT_EQ(Sphere<T>(Vector3<T>(static_cast<T>(0), static_cast<T>(2), static_cast<T>(0)), static_cast<T>(1)).Classify(plane), Math::Containment::Inside);
+    ASSERT_EQ(Sphere<T>(Vector3<T>(static_cast<T>(0), static_cast<T>(0.5), static_cast<T>(0)), static_cast<T>(1)).Classify(plane),
+              Math::Containment::Intersecting);
+    ASSERT_EQ(Sphere<T>(Vector3<T>(static_cast<T>(0), static_cast<T>(-2), static_cast<T>(0)), static_cast<T>(1)).Classify(plane), Math::Containment::Outside);
+  }
+} // namespace UnitTest
@@ -0,0 +1,98 @@
+#include "Benchmark.hpp"
+#include "Statistics.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Benchmark
+{
+  template<class T>
+  static bool RegisterStatistics()
+  {
+    RegisterBatch(Name<T>("Statistics_MinMaxScalar"),
+                  [](std::size_t count)
+                  {
+                    return [values = CreateScalars<T>(count)]()
+                    {
+                      MinMax<T> range;
+                      for(const T value : values)
+                      {
+                        range.Push(value);
+                      }
+
+                      benchmark::DoNotOptimize(range);
+                    };
+                  });
+    RegisterBatch(Name<T>("Statistics_MinMaxSpan"),
+                  [](std::size_t count)
+                  {
+                    return [values = CreateScalars<T>(count)]()
+                    {
+                      MinMax<T> range;
+                      range.Push(Math::Span<const T>(values));
+                      benchmark::DoNotOptimize(range);
+                    };
+                  });
+    RegisterBatch(Name<T>("Statistics_MomentsScalar"),
+                  [](std::size_t count)
+                  {
+                    return [values = CreateScalars<T>(count)]()
+                    {
+                      Moments<T> moments;
+                      for(const T value : values)
+                      {
+                        moments.Push(value);
+                      }
+
+                      benchmark::DoNotOptimize(moments);
+                    };
+                  });
+    RegisterBatch(Name<T>("Statistics_MomentsSpan"),
+                  [](std::size_t count)
+                  {
+                    return [values = CreateScalars<T>(count)]()
+                    {
+                      Moments<T> moments;
+                      moments.Push(Math::Span<const T>(values));
+                      benchmark::DoNotOptimize(moments);
+                    };
+                  });
+    RegisterBatch(Name<T>("Statistics_DecayedRangeScalar"),
+                  [](std::size_t count)
+                  {
+                    return [values = CreateScalars<T>(count)]()
+                    {
+                      DecayedRange<T> range(static_cast<T>(0.99));
+                      for(const T value : values)
+                      {
+                        range.Push(value);
+                      }
+
+                      benchmark::DoNotOptimize(range);
+                    };
+                  });
+    RegisterBatch(Name<T>("Statistics_DecayedRangeSpan"),
+                  [](std::size_t count)
+                  {
+                    return [values = CreateScalars<T>(count)]()
+                    {
+                      DecayedRange<T> range(static_cast<T>(0.99));
+                      range.Push(Math::Span<const T>(values));
+                      benchmark::DoNotOptimize(range);
+                    };
+                  });
+    RegisterBatch(Name<T>("Statistics_NormalizeOnePass"),
+                  [](std::size_t count)
+                  {
+                    return [values = CreateScalars<T>(count), out = std::vector<T>(count)]() mutable
+                    {
+                      MinMax<T> range;
+                      range.Push(Math::Span<const T>(values));
+                      range.Normalize01(Math::Span<const T>(values), Math::Span<T>(out));
+                    };
+                  });
+    return true;
+  }
+
+  static const bool kStatisticsRegistered = RegisterStatistics<float>() && RegisterStatistics<double>();
+} // namespace Benchmark
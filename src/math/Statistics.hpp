@@ -0,0 +1,423 @@
+#ifndef __MATH__STATISTICS_HPP__
+#define __MATH__STATISTICS_HPP__
+
+#include "Common.hpp"
+#include "CommonBatch.hpp"
+#include "Simd.hpp"
+#include "Span.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+/*
+ * Constant memory accumulators over unbounded streams. Values are pushed one at a time or a span at a time, and Merge
+ * folds in a partial built over other values, so per-thread partials from Math::Parallel::Reduce combine into the
+ * result of a single pass. MinMax and DecayedRange hand the range they track to Math::Normalize01/Normalize11, which
+ * normalizes a stream chunk by chunk as it is read:
+ *
+ *   range.Push(chunk);
+ *   range.Normalize01(chunk, out);
+ */
+namespace Math::Detail
+{
+  // Values per block of Moments::Push, small enough to stay in cache for the second pass
+  constexpr std::size_t kMomentBlock = 256u;
+
+  // Mean and sum of squared deviations of a block, two passes so the deviations are taken from the exact block mean
+  template<class T>
+  void BlockMoments(const T* values, std::size_t count, T& mean, T& squaredDeviation)
+  {
+    assert(count > 0u);
+
+    constexpr std::size_t kLanes  = Math::Simd::Traits<T>::kLanes;
+    const std::size_t packedCount = Math::Simd::Traits<T>::kEnabled ? (count - (count % kLanes)) : 0u;
+
+    T sum = static_cast<T>(0);
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      auto lanes = Math::Simd::Broadcast(static_cast<T>(0));
+      for(std::size_t i = 0u; i < packedCount; i += kLanes)
+      {
+        lanes = Math::Simd::Add(lanes, Math::Simd::LoadUnaligned(values + i));
+      }
+
+      sum = Math::Simd::HorizontalSum(lanes);
+    }
+
+    for(std::size_t i = packedCount; i < count; i++)
+    {
+      sum += values[i];
+    }
+
+    mean = sum / static_cast<T>(count);
+
+    T deviation = static_cast<T>(0);
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      const auto center = Math::Simd::Broadcast(mean);
+      auto lanes        = Math::Simd::Broadcast(static_cast<T>(0));
+      for(std::size_t i = 0u; i < packedCount; i += kLanes)
+      {
+        const auto delta = Math::Simd::Subtract(Math::Simd::LoadUnaligned(values + i), center);
+        lanes            = Math::Simd::Add(lanes, Math::Simd::Multiply(delta, delta));
+      }
+
+      deviation = Math::Simd::HorizontalSum(lanes);
+    }
+
+    for(std::size_t i = packedCount; i < count; i++)
+    {
+      const T delta = values[i] - mean;
+      deviation += delta * delta;
+    }
+
+    squaredDeviation = deviation;
+  }
+
+  // scale * decay flushed to zero below the normal range, a long run would otherwise keep multiplying subnormals
+  template<class T>
+  T DecayScale(T scale, T decay)
+  {
+    const T result = scale * decay;
+    return (result < std::numeric_limits<T>::min()) ? static_cast<T>(0) : result;
+  }
+
+  // Empty range bounds, infinities where the type has them so that pushing one does not get lost
+  template<class T>
+  constexpr T kRangeLowest = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+
+  template<class T>
+  constexpr T kRangeHighest = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+} // namespace Math::Detail
+
+// Smallest and largest value pushed, NaN values are counted but leave the range as it was
+template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+class MinMax
+{
+  public:
+  void Push(T value)
+  {
+    m_Min = std::min(m_Min, value);
+    m_Max = std::max(m_Max, value);
+    m_Count++;
+  }
+
+  void Push(Math::Span<const T> values)
+  {
+    MATH_INSTRUMENT_BATCH("MinMax::Push", values.GetSize());
+
+    const std::size_t count = values.GetSize();
+    const T* data           = values.GetData();
+
+    std::size_t i = 0u;
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      constexpr std::size_t kLanes = Math::Simd::Traits<T>::kLanes;
+      if(count >= kLanes)
+      {
+        // The pushed value goes first so that a NaN lane keeps the running bound
+        auto low  = Math::Simd::Broadcast(m_Min);
+        auto high = Math::Simd::Broadcast(m_Max);
+        for(; (i + kLanes) <= count; i += kLanes)
+        {
+          const auto value = Math::Simd::LoadUnaligned(data + i);
+          low              = Math::Simd::Min(value, low);
+          high             = Math::Simd::Max(value, high);
+        }
+
+        alignas(Math::Simd::Traits<T>::kAlignment) T lows[kLanes];
+        alignas(Math::Simd::Traits<T>::kAlignment) T highs[kLanes];
+        Math::Simd::Store(lows, low);
+        Math::Simd::Store(highs, high);
+        for(std::size_t lane = 0u; lane < kLanes; lane++)
+        {
+          m_Min = std::min(m_Min, lows[lane]);
+          m_Max = std::max(m_Max, highs[lane]);
+        }
+      }
+    }
+
+    for(; i < count; i++)
+    {
+      m_Min = std::min(m_Min, data[i]);
+      m_Max = std::max(m_Max, data[i]);
+    }
+
+    m_Count += count;
+  }
+
+  void Merge(const MinMax<T>& other)
+  {
+    m_Min = std::min(m_Min, other.m_Min);
+    m_Max = std::max(m_Max, other.m_Max);
+    m_Count += other.m_Count;
+  }
+
+  // Math::Normalize01 and Math::Normalize11 against the range pushed so far, in and out may be the same span
+  T Normalize01(T value) const
+  {
+    assert(!IsEmpty());
+    return Math::Normalize01(value, m_Min, m_Max);
+  }
+
+  T Normalize11(T value) const
+  {
+    assert(!IsEmpty());
+    return Math::Normalize11(value, m_Min, m_Max);
+  }
+
+  void Normalize01(Math::Span<const T> in, Math::Span<T> out) const
+  {
+    assert(!IsEmpty());
+    Math::Batch::Normalize01(in, out, m_Min, m_Max);
+  }
+
+  void Normalize11(Math::Span<const T> in, Math::Span<T> out) const
+  {
+    assert(!IsEmpty());
+    Math::Batch::Normalize11(in, out, m_Min, m_Max);
+  }
+
+  T GetMin() const { return m_Min; }
+  T GetMax() const { return m_Max; }
+  std::size_t GetCount() const { return m_Count; }
+  bool IsEmpty() const { return m_Count == 0u; }
+
+  MinMax() = default;
+
+  private:
+  T m_Min             = Math::Detail::kRangeHighest<T>;
+  T m_Max             = Math::Detail::kRangeLowest<T>;
+  std::size_t m_Count = 0u;
+};
+
+// Running mean and variance, Welford's update per value and Chan's pairwise combination per block and per Merge
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class Moments
+{
+  public:
+  void Push(T value)
+  {
+    m_Count++;
+    const T delta = value - m_Mean;
+    m_Mean += delta / static_cast<T>(m_Count);
+    m_SquaredDeviation += delta * (value - m_Mean);
+  }
+
+  void Push(Math::Span<const T> values)
+  {
+    MATH_INSTRUMENT_BATCH("Moments::Push", values.GetSize());
+
+    const std::size_t count = values.GetSize();
+    for(std::size_t i = 0u; i < count; i += Math::Detail::kMomentBlock)
+    {
+      const std::size_t blockCount = std::min(Math::Detail::kMomentBlock, count - i);
+
+      T mean             = static_cast<T>(0);
+      T squaredDeviation = static_cast<T>(0);
+      Math::Detail::BlockMoments(values.GetData() + i, blockCount, mean, squaredDeviation);
+      Combine(blockCount, mean, squaredDeviation);
+    }
+  }
+
+  void Merge(const Moments<T>& other) { Combine(other.m_Count, other.m_Mean, other.m_SquaredDeviation); }
+
+  // Population variance, zero while empty
+  T GetVariance() const { return (m_Count > 0u) ? (m_SquaredDeviation / static_cast<T>(m_Count)) : static_cast<T>(0); }
+
+  // Unbiased sample variance, zero below two values
+  T GetSampleVariance() const { return (m_Count > 1u) ? (m_SquaredDeviation / static_cast<T>(m_Count - 1u)) : static_cast<T>(0); }
+
+  T GetStandardDeviation() const { return std::sqrt(GetVariance()); }
+  T GetMean() const { return m_Mean; }
+  std::size_t GetCount() const { return m_Count; }
+  bool IsEmpty() const { return m_Count == 0u; }
+
+  Moments() = default;
+
+  private:
+  void Combine(std::size_t count, T mean, T squaredDeviation)
+  {
+    if(count == 0u)
+    {
+      return;
+    }
+
+    const std::size_t total = m_Count + count;
+    const T delta           = mean - m_Mean;
+    const T weight          = static_cast<T>(count) / static_cast<T>(total);
+
+    m_SquaredDeviation += squaredDeviation + ((delta * delta) * (static_cast<T>(m_Count) * weight));
+    m_Mean += delta * weight;
+    m_Count = total;
+  }
+
+  T m_Mean             = static_cast<T>(0);
+  T m_SquaredDeviation = static_cast<T>(0);
+  std::size_t m_Count  = 0u;
+};
+
+/*
+ * Range whose bounds relax towards recent values: a value outside the range moves the bound to it, a value inside
+ * pulls each bound towards it by (1 - decay), so a bound set by an old outlier fades with a half life of
+ * log(0.5) / log(decay) values. A decay of one keeps the plain MinMax range.
+ *
+ * Pushing a run of values maps the previous bound b to max(high, scale * b + offset), and the same scale and offset
+ * with low for the lower bound. The accumulator keeps that map, so Merge appends a partial built over the values
+ * right after this one's, and Push of a span runs each lane over its own contiguous segment before merging them.
+ */
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class DecayedRange
+{
+  public:
+  static DecayedRange<T> FromHalfLife(T values)
+  {
+    assert(values > static_cast<T>(0));
+    return DecayedRange<T>(std::pow(static_cast<T>(0.5), static_cast<T>(1) / values));
+  }
+
+  void Push(T value)
+  {
+    const T pull = (static_cast<T>(1) - m_Decay) * value;
+    m_Min        = std::min(value, (m_Decay * m_Min) + pull);
+    m_Max        = std::max(value, (m_Decay * m_Max) + pull);
+    m_Offset     = (m_Decay * m_Offset) + pull;
+    m_Scale      = Math::Detail::DecayScale(m_Scale, m_Decay);
+    m_Count++;
+  }
+
+  void Push(Math::Span<const T> values)
+  {
+    MATH_INSTRUMENT_BATCH("DecayedRange::Push", values.GetSize());
+
+    constexpr std::size_t kLanes = Math::Simd::Traits<T>::kLanes;
+
+    const std::size_t count = values.GetSize();
+    const T* data           = values.GetData();
+
+    std::size_t i = 0u;
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      // Lane j runs over data[j * length, (j + 1) * length) from an empty range, which breaks the dependency chain
+      const std::size_t length = count / kLanes;
+      if(length > 0u)
+      {
+        const auto decay = Math::Simd::Broadcast(m_Decay);
+        const auto keep  = Math::Simd::Broadcast(static_cast<T>(1) - m_Decay);
+
+        auto low    = Math::Simd::Broadcast(Math::Detail::kRangeHighest<T>);
+        auto high   = Math::Simd::Broadcast(Math::Detail::kRangeLowest<T>);
+        auto offset = Math::Simd::Broadcast(static_cast<T>(0));
+        T scale     = static_cast<T>(1);
+        for(std::size_t k = 0u; k < length; k++)
+        {
+          const auto value = Math::Simd::Set(data[k], data[length + k], data[(2u * length) + k], data[(3u * length) + k]);
+          const auto pull  = Math::Simd::Multiply(keep, value);
+          low              = Math::Simd::Min(value, Math::Simd::Add(Math::Simd::Multiply(decay, low), pull));
+          high             = Math::Simd::Max(value, Math::Simd::Add(Math::Simd::Multiply(decay, high), pull));
+          offset           = Math::Simd::Add(Math::Simd::Multiply(decay, offset), pull);
+          scale            = Math::Detail::DecayScale(scale, m_Decay);
+        }
+
+        alignas(Math::Simd::Traits<T>::kAlignment) T lows[kLanes];
+        alignas(Math::Simd::Traits<T>::kAlignment) T highs[kLanes];
+        alignas(Math::Simd::Traits<T>::kAlignment) T offsets[kLanes];
+        Math::Simd::Store(lows, low);
+        Math::Simd::Store(highs, high);
+        Math::Simd::Store(offsets, offset);
+        for(std::size_t lane = 0u; lane < kLanes; lane++)
+        {
+          DecayedRange<T> segment(m_Decay);
+          segment.m_Min    = lows[lane];
+          segment.m_Max    = highs[lane];
+          segment.m_Offset = offsets[lane];
+          segment.m_Scale  = scale;
+          segment.m_Count  = length;
+          Merge(segment);
+        }
+
+        i = length * kLanes;
+      }
+    }
+
+    for(; i < count; i++)
+    {
+      Push(data[i]);
+    }
+  }
+
+  // Appends a partial with the same decay that was pushed the values following the ones pushed here
+  void Merge(const DecayedRange<T>& later)
+  {
+    assert(later.m_Decay == m_Decay);
+
+    if(later.IsEmpty())
+    {
+      return;
+    }
+
+    if(IsEmpty())
+    {
+      *this = later;
+      return;
+    }
+
+    m_Min    = std::min(later.m_Min, (later.m_Scale * m_Min) + later.m_Offset);
+    m_Max    = std::max(later.m_Max, (later.m_Scale * m_Max) + later.m_Offset);
+    m_Offset = (later.m_Scale * m_Offset) + later.m_Offset;
+    m_Scale  = Math::Detail::DecayScale(m_Scale, later.m_Scale);
+    m_Count += later.m_Count;
+  }
+
+  // Math::Normalize01 and Math::Normalize11 against the current range, in and out may be the same span
+  T Normalize01(T value) const
+  {
+    assert(!IsEmpty());
+    return Math::Normalize01(value, m_Min, m_Max);
+  }
+
+  T Normalize11(T value) const
+  {
+    assert(!IsEmpty());
+    return Math::Normalize11(value, m_Min, m_Max);
+  }
+
+  void Normalize01(Math::Span<const T> in, Math::Span<T> out) const
+  {
+    assert(!IsEmpty());
+    Math::Batch::Normalize01(in, out, m_Min, m_Max);
+  }
+
+  void Normalize11(Math::Span<const T> in, Math::Span<T> out) const
+  {
+    assert(!IsEmpty());
+    Math::Batch::Normalize11(in, out, m_Min, m_Max);
+  }
+
+  T GetMin() const { return m_Min; }
+  T GetMax() const { return m_Max; }
+  T GetDecay() const { return m_Decay; }
+  std::size_t GetCount() const { return m_Count; }
+  bool IsEmpty() const { return m_Count == 0u; }
+
+  // Weight the bounds keep per pushed value, in (0, 1]
+  explicit DecayedRange(T decay)
+      : m_Decay(decay)
+  {
+    assert((decay > static_cast<T>(0)) && (decay <= static_cast<T>(1)));
+  }
+
+  private:
+  T m_Decay;
+  T m_Min             = Math::Detail::kRangeHighest<T>;
+  T m_Max             = Math::Detail::kRangeLowest<T>;
+  T m_Offset          = static_cast<T>(0);
+  T m_Scale           = static_cast<T>(1);
+  std::size_t m_Count = 0u;
+};
+
+#endif // __MATH__STATISTICS_HPP__
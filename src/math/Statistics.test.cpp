@@ -0,0 +1,258 @@
+#include "Parallel.hpp"
+#include "Statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class StatisticsTyped : public Test
+  {};
+
+  using StatisticsTypes = Types<float, double>;
+  TYPED_TEST_SUITE(StatisticsTyped, StatisticsTypes);
+
+  // Deterministic values in [offset - scale, offset + scale)
+  template<class T>
+  static std::vector<T> CreateValues(std::size_t count, std::uint32_t seed, T offset, T scale)
+  {
+    std::uint32_t state = seed;
+    std::vector<T> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      state = (state * 1664525u) + 1013904223u;
+      result.push_back(offset + (((static_cast<T>(state >> 8u) / static_cast<T>(1u << 24u)) * static_cast<T>(2) - static_cast<T>(1)) * scale));
+    }
+
+    return result;
+  }
+
+  TYPED_TEST(StatisticsTyped, MinMax)
+  {
+    using T = TypeParam;
+
+    MinMax<T> empty;
+    ASSERT_TRUE(empty.IsEmpty());
+    ASSERT_EQ(empty.GetMin(), std::numeric_limits<T>::infinity());
+    ASSERT_EQ(empty.GetMax(), -std::numeric_limits<T>::infinity());
+
+    // Every count around the lane width, pushed at once, one by one and as two merged halves
+    const std::vector<T> values = CreateValues<T>(41u, 5u, static_cast<T>(3), static_cast<T>(50));
+    for(std::size_t count = 1u; count <= values.size(); count++)
+    {
+      const Math::Span<const T> span(values.data(), count);
+
+      MinMax<T> single;
+      MinMax<T> batch;
+      MinMax<T> low;
+      MinMax<T> high;
+      for(std::size_t i = 0u; i < count; i++)
+      {
+        single.Push(values[i]);
+      }
+
+      batch.Push(span);
+      low.Push(span.Subspan(0u, count / 2u));
+      high.Push(span.Subspan(count / 2u, count - (count / 2u)));
+      low.Merge(high);
+      for(const MinMax<T>& range : {batch, low})
+      {
+        ASSERT_EQ(range.GetMin(), single.GetMin());
+        ASSERT_EQ(range.GetMax(), single.GetMax());
+        ASSERT_EQ(range.GetCount(), count);
+      }
+    }
+
+    // NaN values are counted and skipped
+    std::vector<T> holes = {static_cast<T>(2), std::numeric_limits<T>::quiet_NaN(), static_cast<T>(-1), static_cast<T>(4), std::numeric_limits<T>::quiet_NaN()};
+    MinMax<T> range;
+    range.Push(Math::Span<const T>(holes));
+    range.Push(std::numeric_limits<T>::quiet_NaN());
+    ASSERT_EQ(range.GetMin(), static_cast<T>(-1));
+    ASSERT_EQ(range.GetMax(), static_cast<T>(4));
+    ASSERT_EQ(range.GetCount(), 6u);
+
+    // The tracked range feeds the normalize helpers
+    std::vector<T> out(values.size());
+    MinMax<T> stream;
+    stream.Push(Math::Span<const T>(values));
+    stream.Normalize01(Math::Span<const T>(values), Math::Span<T>(out));
+    for(std::size_t i = 0u; i < values.size(); i++)
+    {
+      ASSERT_EQ(out[i], Math::Normalize01(values[i], stream.GetMin(), stream.GetMax()));
+      ASSERT_EQ(stream.Normalize11(values[i]), Math::Normalize11(values[i], stream.GetMin(), stream.GetMax()));
+      ASSERT_GE(out[i], static_cast<T>(0));
+      ASSERT_LE(out[i], static_cast<T>(1));
+    }
+
+    const std::vector<int> integerValues = {3, -7, 12, 5, 0};
+    MinMax<int> integers;
+    integers.Push(Math::Span<const int>(integerValues));
+    ASSERT_EQ(integers.GetMin(), -7);
+    ASSERT_EQ(integers.GetMax(), 12);
+  }
+
+  TYPED_TEST(StatisticsTyped, Moments)
+  {
+    using T = TypeParam;
+
+    Moments<T> empty;
+    ASSERT_TRUE(empty.IsEmpty());
+    ASSERT_EQ(empty.GetVariance(), static_cast<T>(0));
+    ASSERT_EQ(empty.GetSampleVariance(), static_cast<T>(0));
+
+    // A large offset against a small spread, where the naive sum of squares loses every digit in float
+    const std::vector<T> values = CreateValues<T>(3001u, 9u, static_cast<T>(10000), static_cast<T>(1));
+
+    double mean = 0.0;
+    for(const T value : values)
+    {
+      mean += static_cast<double>(value);
+    }
+
+    mean /= static_cast<double>(values.size());
+
+    double squared = 0.0;
+    for(const T value : values)
+    {
+      squared += (static_cast<double>(value) - mean) * (static_cast<double>(value) - mean);
+    }
+
+    // The variance error grows with mean / deviation, the naive sum of squares grows with its square instead
+    const double variance  = squared / static_cast<double>(values.size());
+    const double tolerance = static_cast<double>(std::numeric_limits<T>::epsilon()) * 4.0;
+    const double spread    = tolerance * (mean / std::sqrt(variance));
+
+    Moments<T> single;
+    for(const T value : values)
+    {
+      single.Push(value);
+    }
+
+    Moments<T> batch;
+    batch.Push(Math::Span<const T>(values));
+
+    const Math::Span<const T> span(values);
+    const Moments<T> parallel = Math::Parallel::Reduce(
+      std::size_t(0u), values.size(), Moments<T>(),
+      [&](std::size_t lo, std::size_t hi)
+      {
+        Moments<T> partial;
+        partial.Push(span.Subspan(lo, hi - lo));
+        return partial;
+      },
+      [](Moments<T> a, const Moments<T>& b)
+      {
+        a.Merge(b);
+        return a;
+      },
+      500u);
+
+    for(const Moments<T>& moments : {single, batch, parallel})
+    {
+      ASSERT_EQ(moments.GetCount(), values.size());
+      ASSERT_NEAR(static_cast<double>(moments.GetMean()), mean, mean * tolerance);
+      ASSERT_NEAR(static_cast<double>(moments.GetVariance()), variance, variance * spread);
+      ASSERT_NEAR(static_cast<double>(moments.GetSampleVariance()), squared / static_cast<double>(values.size() - 1u), variance * spread);
+      ASSERT_NEAR(static_cast<double>(moments.GetStandardDeviation()), std::sqrt(variance), std::sqrt(variance) * spread);
+    }
+
+    const std::vector<T> repeated(37u, static_cast<T>(2.5));
+    Moments<T> constant;
+    constant.Push(Math::Span<const T>(repeated));
+    ASSERT_EQ(constant.GetMean(), static_cast<T>(2.5));
+    ASSERT_EQ(constant.GetVariance(), static_cast<T>(0));
+  }
+
+  TYPED_TEST(StatisticsTyped, DecayedRange)
+  {
+    using T = TypeParam;
+
+    // A decay of one tracks the plain range exactly
+    const std::vector<T> values = CreateValues<T>(1003u, 11u, static_cast<T>(0), static_cast<T>(10));
+    DecayedRange<T> keep(static_cast<T>(1));
+    MinMax<T> plain;
+    keep.Push(Math::Span<const T>(values));
+    plain.Push(Math::Span<const T>(values));
+    ASSERT_EQ(keep.GetMin(), plain.GetMin());
+    ASSERT_EQ(keep.GetMax(), plain.GetMax());
+    ASSERT_EQ(keep.GetCount(), values.size());
+
+    // A bound drops to half of its distance from a run of zeros after one half life
+    DecayedRange<T> half = DecayedRange<T>::FromHalfLife(static_cast<T>(16));
+    half.Push(static_cast<T>(1));
+    for(std::size_t i = 0u; i < 16u; i++)
+    {
+      half.Push(static_cast<T>(0));
+    }
+
+    ASSERT_NEAR(half.GetMax(), static_cast<T>(0.5), static_cast<T>(1e-4));
+    ASSERT_EQ(half.GetMin(), static_cast<T>(0));
+
+    // Wide values followed by narrow ones, the range shrinks back towards the narrow spread
+    std::vector<T> stream = CreateValues<T>(1000u, 13u, static_cast<T>(0), static_cast<T>(10));
+    const std::vector<T> narrow = CreateValues<T>(1001u, 17u, static_cast<T>(0), static_cast<T>(1));
+    stream.insert(stream.end(), narrow.begin(), narrow.end());
+
+    const DecayedRange<T> identity = DecayedRange<T>::FromHalfLife(static_cast<T>(50));
+    DecayedRange<T> single         = identity;
+    for(const T value : stream)
+    {
+      single.Push(value);
+    }
+
+    ASSERT_LT(single.GetMax(), static_cast<T>(1.5));
+    ASSERT_GT(single.GetMin(), static_cast<T>(-1.5));
+    ASSERT_LT(single.GetMin(), single.GetMax());
+
+    DecayedRange<T> batch = identity;
+    batch.Push(Math::Span<const T>(stream));
+
+    const Math::Span<const T> span(stream);
+    const DecayedRange<T> parallel = Math::Parallel::Reduce(
+      std::size_t(0u), stream.size(), identity,
+      [&](std::size_t lo, std::size_t hi)
+      {
+        DecayedRange<T> partial = identity;
+        partial.Push(span.Subspan(lo, hi - lo));
+        return partial;
+      },
+      [](DecayedRange<T> a, const DecayedRange<T>& b)
+      {
+        a.Merge(b);
+        return a;
+      },
+      300u);
+
+    const T tolerance = std::numeric_limits<T>::epsilon() * static_cast<T>(256);
+    for(const DecayedRange<T>& range : {batch, parallel})
+    {
+      ASSERT_EQ(range.GetCount(), stream.size());
+      ASSERT_NEAR(range.GetMin(), single.GetMin(), tolerance);
+      ASSERT_NEAR(range.GetMax(), single.GetMax(), tolerance);
+    }
+
+    // Normalizing each chunk as it arrives keeps it within the range seen so far
+    DecayedRange<T> online = identity;
+    std::vector<T> out(64u);
+    for(std::size_t i = 0u; i < stream.size(); i += out.size())
+    {
+      const Math::Span<const T> chunk = span.Subspan(i, std::min(out.size(), stream.size() - i));
+      online.Push(chunk);
+      online.Normalize11(chunk, Math::Span<T>(out));
+      for(std::size_t j = 0u; j < chunk.GetSize(); j++)
+      {
+        ASSERT_EQ(out[j], Math::Normalize11(chunk[j], online.GetMin(), online.GetMax()));
+      }
+    }
+  }
+} // namespace UnitTest
@@ -0,0 +1,114 @@
+#include "Benchmark.hpp"
+#include "Quaternion.hpp"
+#include "TransformHierarchy.hpp"
+#include "Vector3.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Benchmark
+{
+  // Every node past the first gets parent (i - 1) / 4, a complete tree of fan-out four as skeletons and scenes tend to be
+  template<class T>
+  static TransformHierarchy<T> CreateHierarchy(std::size_t count)
+  {
+    const std::vector<T> scalars = CreateScalars<T>(count + 8u);
+
+    TransformHierarchy<T> result;
+    result.Reserve(count);
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const Quaternion<T> rotation = Quaternion<T>::FromAxisAngle(Vector3<T>::Up, scalars[i]);
+      const Vector3<T> translation(scalars[i + 1u], scalars[i + 2u], scalars[i + 3u]);
+      result.Add(rotation, translation, (i == 0u) ? TransformHierarchy<T>::kNoParent : ((i - 1u) / 4u));
+    }
+
+    result.Update();
+    return result;
+  }
+
+  // The recursive pointer-chasing baseline the hierarchy replaces
+  template<class T>
+  struct Node
+  {
+    Quaternion<T> m_LocalRotation;
+    Vector3<T> m_LocalTranslation;
+    Quaternion<T> m_WorldRotation;
+    Vector3<T> m_WorldTranslation;
+    std::vector<std::unique_ptr<Node<T>>> m_Children;
+  };
+
+  template<class T>
+  static void Propagate(Node<T>& node, const Quaternion<T>& rotation, const Vector3<T>& translation)
+  {
+    node.m_WorldRotation    = rotation * node.m_LocalRotation;
+    node.m_WorldTranslation = translation + rotation.Rotate(node.m_LocalTranslation);
+    for(const std::unique_ptr<Node<T>>& child : node.m_Children)
+    {
+      Propagate(*child, node.m_WorldRotation, node.m_WorldTranslation);
+    }
+  }
+
+  template<class T>
+  static std::unique_ptr<Node<T>> CreateNodes(std::size_t count)
+  {
+    const TransformHierarchy<T> hierarchy = CreateHierarchy<T>(count);
+
+    std::vector<Node<T>*> nodes;
+    std::unique_ptr<Node<T>> root = std::make_unique<Node<T>>();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      Node<T>* node = root.get();
+      if(i != 0u)
+      {
+        node = nodes[hierarchy.GetParent(i)]->m_Children.emplace_back(std::make_unique<Node<T>>()).get();
+      }
+
+      node->m_LocalRotation    = hierarchy.GetLocalRotation(i);
+      node->m_LocalTranslation = hierarchy.GetLocalTranslation(i);
+      nodes.push_back(node);
+    }
+
+    return root;
+  }
+
+  template<class T>
+  static bool RegisterTransformHierarchy()
+  {
+    RegisterBatch(Name<T>("TransformHierarchy_Recursive"),
+                  [](std::size_t count)
+                  {
+                    return [root = std::shared_ptr<Node<T>>(CreateNodes<T>(count))]()
+                    {
+                      Propagate(*root, Quaternion<T>::Identity, Vector3<T>::Zero);
+                      benchmark::DoNotOptimize(root->m_WorldRotation);
+                    };
+                  });
+
+    RegisterBatch(Name<T>("TransformHierarchy_Update"),
+                  [](std::size_t count)
+                  {
+                    return [hierarchy = CreateHierarchy<T>(count)]() mutable
+                    {
+                      hierarchy.SetLocalRotation(0u, hierarchy.GetLocalRotation(0u));
+                      benchmark::DoNotOptimize(hierarchy.Update());
+                    };
+                  });
+
+    // One leaf per call, the rest of the tree is skipped
+    RegisterBatch(Name<T>("TransformHierarchy_UpdateLeaf"),
+                  [](std::size_t count)
+                  {
+                    return [hierarchy = CreateHierarchy<T>(count)]() mutable
+                    {
+                      hierarchy.SetLocalTranslation(hierarchy.GetSize() - 1u, Vector3<T>::One);
+                      benchmark::DoNotOptimize(hierarchy.Update());
+                    };
+                  });
+
+    return true;
+  }
+
+  static const bool kTransformHierarchyRegistered = RegisterTransformHierarchy<float>() && RegisterTransformHierarchy<double>();
+} // namespace Benchmark
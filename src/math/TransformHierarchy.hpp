@@ -0,0 +1,440 @@
+#ifndef __MATH__TRANSFORMHIERARCHY_HPP__
+#define __MATH__TRANSFORMHIERARCHY_HPP__
+
+#include "AlignedAllocator.hpp"
+#include "Matrix4.hpp"
+#include "Parallel.hpp"
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * Rigid transform hierarchy
+ *
+ * Every node holds a local rotation and translation relative to its parent, world = parent * local. Nodes live in
+ * level order in SoA arrays: all roots first, then their children, then the grandchildren, the children of one parent
+ * next to each other. Update walks the levels top down, so every parent is final before its children read it, and
+ * computes a level in packed registers, spreading levels of at least kParallelLevel nodes over a thread pool.
+ *
+ * Changing a local transform only marks the node. Update carries the mark down to the descendants and recomputes the
+ * marked nodes alone, skipping untouched blocks of nodes and whole levels where nothing above changed.
+ */
+
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class TransformHierarchy
+{
+  public:
+  using Container = std::vector<T, Math::AlignedAllocator<T>>;
+
+  static constexpr std::size_t kNoParent = std::numeric_limits<std::size_t>::max();
+
+  // Levels narrower than this are cheaper to update on the calling thread
+  static constexpr std::size_t kParallelLevel = 8192u;
+
+  // Ids are handed out in order from zero and never change. The parent has to exist already, so there are no cycles
+  std::size_t Add(const Quaternion<T>& rotation, const Vector3<T>& translation, std::size_t parent = kNoParent)
+  {
+    assert((parent == kNoParent) || (parent < GetSize()));
+
+    const std::size_t id   = GetSize();
+    const std::size_t slot = id;
+    m_Parent.push_back(parent);
+    m_Depth.push_back((parent == kNoParent) ? 0u : (m_Depth[parent] + 1u));
+    m_Slot.push_back(slot);
+    m_Id.push_back(id);
+    m_ParentSlot.push_back((parent == kNoParent) ? kNoParent : m_Slot[parent]);
+    m_Dirty.push_back(1u);
+    for(std::size_t component = 0u; component < 4u; component++)
+    {
+      m_LocalRotation[component].push_back(GetComponent(rotation, component));
+      m_WorldRotation[component].push_back(GetComponent(rotation, component));
+    }
+
+    m_LocalTranslation.PushBack(translation);
+    m_WorldTranslation.PushBack(translation);
+
+    // The new node sits at the end until the next Update puts it on its level
+    m_Ordered = false;
+    return id;
+  }
+
+  void SetLocalRotation(std::size_t id, const Quaternion<T>& rotation)
+  {
+    const std::size_t slot = m_Slot[id];
+    for(std::size_t component = 0u; component < 4u; component++)
+    {
+      m_LocalRotation[component][slot] = GetComponent(rotation, component);
+    }
+
+    MarkDirty(slot, id);
+  }
+
+  void SetLocalTranslation(std::size_t id, const Vector3<T>& translation)
+  {
+    const std::size_t slot = m_Slot[id];
+    m_LocalTranslation.Set(slot, translation);
+    MarkDirty(slot, id);
+  }
+
+  void SetLocal(std::size_t id, const Quaternion<T>& rotation, const Vector3<T>& translation)
+  {
+    SetLocalRotation(id, rotation);
+    SetLocalTranslation(id, translation);
+  }
+
+  // Recomputes the world transform of every changed node and of all its descendants, returns how many were recomputed
+  std::size_t Update(Math::Parallel::ThreadPool& pool = Math::Parallel::ThreadPool::GetDefault())
+  {
+    if(!m_Ordered)
+    {
+      Order();
+    }
+
+    std::size_t result = 0u;
+    bool above         = false;
+    for(std::size_t level = 0u; (level + 1u) < m_Levels.size(); level++)
+    {
+      // Nothing marked on this level and nothing changed above it, so every node here keeps its world transform
+      if(!above && (m_LevelDirty[level] == 0u))
+      {
+        continue;
+      }
+
+      const std::size_t begin = m_Levels[level];
+      const std::size_t end   = m_Levels[level + 1u];
+      const auto update       = [this](std::size_t lo, std::size_t hi) { return UpdateRange(lo, hi); };
+
+      std::size_t updated = 0u;
+      if((end - begin) >= kParallelLevel)
+      {
+        updated = Math::Parallel::Reduce(begin, end, std::size_t(0), update, [](std::size_t a, std::size_t b) { return a + b; },
+                                         Math::Parallel::kDefaultGrain, pool);
+      }
+      else
+      {
+        updated = update(begin, end);
+      }
+
+      m_LevelDirty[level] = 0u;
+      above               = (updated != 0u);
+      result += updated;
+    }
+
+    if(result != 0u)
+    {
+      std::fill(m_Dirty.begin(), m_Dirty.end(), std::uint8_t(0));
+    }
+
+    return result;
+  }
+
+  // World transforms are those of the last Update
+  Quaternion<T> GetWorldRotation(std::size_t id) const { return GetRotation(m_WorldRotation, m_Slot[id]); }
+  Vector3<T> GetWorldTranslation(std::size_t id) const { return m_WorldTranslation[m_Slot[id]]; }
+  Matrix4<T> GetWorldMatrix(std::size_t id) const { return Matrix4<T>::FromRotationTranslation(GetWorldRotation(id), GetWorldTranslation(id)); }
+
+  Quaternion<T> GetLocalRotation(std::size_t id) const { return GetRotation(m_LocalRotation, m_Slot[id]); }
+  Vector3<T> GetLocalTranslation(std::size_t id) const { return m_LocalTranslation[m_Slot[id]]; }
+
+  std::size_t GetParent(std::size_t id) const { return m_Parent[id]; }
+  std::size_t GetDepth(std::size_t id) const { return m_Depth[id]; }
+  std::size_t GetSize() const { return m_Parent.size(); }
+  bool IsEmpty() const { return m_Parent.empty(); }
+
+  void Reserve(std::size_t capacity)
+  {
+    m_Parent.reserve(capacity);
+    m_Depth.reserve(capacity);
+    m_Slot.reserve(capacity);
+    m_Id.reserve(capacity);
+    m_ParentSlot.reserve(capacity);
+    m_Dirty.reserve(capacity);
+    for(std::size_t component = 0u; component < 4u; component++)
+    {
+      m_LocalRotation[component].reserve(capacity);
+      m_WorldRotation[component].reserve(capacity);
+    }
+
+    m_LocalTranslation.Reserve(capacity);
+    m_WorldTranslation.Reserve(capacity);
+  }
+
+  TransformHierarchy()
+      : m_Ordered(true)
+  {}
+
+  private:
+  static T GetComponent(const Quaternion<T>& value, std::size_t component)
+  {
+    return (component == 0u) ? value.GetX() : ((component == 1u) ? value.GetY() : ((component == 2u) ? value.GetZ() : value.GetW()));
+  }
+
+  static Quaternion<T> GetRotation(const std::array<Container, 4u>& rotation, std::size_t slot)
+  {
+    return Quaternion<T>(rotation[0][slot], rotation[1][slot], rotation[2][slot], rotation[3][slot]);
+  }
+
+  void MarkDirty(std::size_t slot, std::size_t id)
+  {
+    m_Dirty[slot] = 1u;
+    if(m_Ordered)
+    {
+      m_LevelDirty[m_Depth[id]] = 1u;
+    }
+  }
+
+  // Carries the marks of the parents down and recomputes the marked nodes of [lo, hi), a range within one level
+  std::size_t UpdateRange(std::size_t lo, std::size_t hi)
+  {
+    std::uint8_t* dirty            = m_Dirty.data();
+    const std::size_t* parentSlot  = m_ParentSlot.data();
+    const std::size_t rootLevelEnd = m_Levels[1];
+    const bool roots               = lo < rootLevelEnd;
+
+    std::size_t result = 0u;
+    std::size_t i      = lo;
+    if constexpr(Math::Simd::Traits<T>::kEnabled)
+    {
+      constexpr std::size_t kLanes = Math::Simd::Traits<T>::kLanes;
+
+      for(; !roots && ((i + kLanes) <= hi); i += kLanes)
+      {
+        std::size_t marked = 0u;
+        for(std::size_t lane = 0u; lane < kLanes; lane++)
+        {
+          dirty[i + lane] = static_cast<std::uint8_t>(dirty[i + lane] | dirty[parentSlot[i + lane]]);
+          marked += dirty[i + lane];
+        }
+
+        // Clean nodes in a marked block are recomputed from unchanged inputs, which leaves them as they were
+        if(marked != 0u)
+        {
+          ComposeBlock(i);
+          result += marked;
+        }
+      }
+    }
+
+    for(; i < hi; i++)
+    {
+      if(!roots)
+      {
+        dirty[i] = static_cast<std::uint8_t>(dirty[i] | dirty[parentSlot[i]]);
+      }
+
+      if(dirty[i] != 0u)
+      {
+        Compose(i);
+        result++;
+      }
+    }
+
+    return result;
+  }
+
+  void Compose(std::size_t slot)
+  {
+    const Quaternion<T> local    = GetRotation(m_LocalRotation, slot);
+    const Vector3<T> translation = m_LocalTranslation[slot];
+
+    Quaternion<T> rotation   = local;
+    Vector3<T> position      = translation;
+    const std::size_t parent = m_ParentSlot[slot];
+    if(parent != kNoParent)
+    {
+      const Quaternion<T> parentRotation = GetRotation(m_WorldRotation, parent);
+      rotation                           = parentRotation * local;
+      position                           = m_WorldTranslation[parent] + parentRotation.Rotate(translation);
+    }
+
+    for(std::size_t component = 0u; component < 4u; component++)
+    {
+      m_WorldRotation[component][slot] = GetComponent(rotation, component);
+    }
+
+    m_WorldTranslation.Set(slot, position);
+  }
+
+  // Compose for one register of nodes that all have parents, the parent transforms are gathered lane by lane
+  void ComposeBlock(std::size_t slot)
+  {
+    namespace Simd               = Math::Simd;
+    constexpr std::size_t kLanes = Simd::Traits<T>::kLanes;
+
+    alignas(Simd::Traits<T>::kAlignment) T gathered[7u][kLanes];
+    for(std::size_t lane = 0u; lane < kLanes; lane++)
+    {
+      const std::size_t parent = m_ParentSlot[slot + lane];
+      for(std::size_t component = 0u; component < 4u; component++)
+      {
+        gathered[component][lane] = m_WorldRotation[component][parent];
+      }
+
+      gathered[4u][lane] = m_WorldTranslation.GetX()[parent];
+      gathered[5u][lane] = m_WorldTranslation.GetY()[parent];
+      gathered[6u][lane] = m_WorldTranslation.GetZ()[parent];
+    }
+
+    const auto px = Simd::Load(gathered[0u]);
+    const auto py = Simd::Load(gathered[1u]);
+    const auto pz = Simd::Load(gathered[2u]);
+    const auto pw = Simd::Load(gathered[3u]);
+
+    const auto lx = Simd::LoadUnaligned(m_LocalRotation[0u].data() + slot);
+    const auto ly = Simd::LoadUnaligned(m_LocalRotation[1u].data() + slot);
+    const auto lz = Simd::LoadUnaligned(m_LocalRotation[2u].data() + slot);
+    const auto lw = Simd::LoadUnaligned(m_LocalRotation[3u].data() + slot);
+
+    // Hamilton product parent * local, term for term as Quaternion::operator*
+    const auto rx = Simd::Subtract(Simd::Add(Simd::Add(Simd::Multiply(pw, lx), Simd::Multiply(px, lw)), Simd::Multiply(py, lz)), Simd::Multiply(pz, ly));
+    const auto ry = Simd::Add(Simd::Add(Simd::Subtract(Simd::Multiply(pw, ly), Simd::Multiply(px, lz)), Simd::Multiply(py, lw)), Simd::Multiply(pz, lx));
+    const auto rz = Simd::Add(Simd::Subtract(Simd::Add(Simd::Multiply(pw, lz), Simd::Multiply(px, ly)), Simd::Multiply(py, lx)), Simd::Multiply(pz, lw));
+    const auto rw = Simd::Subtract(Simd::Subtract(Simd::Subtract(Simd::Multiply(pw, lw), Simd::Multiply(px, lx)), Simd::Multiply(py, ly)),
+                                   Simd::Multiply(pz, lz));
+
+    Simd::StoreUnaligned(m_WorldRotation[0u].data() + slot, rx);
+    Simd::StoreUnaligned(m_WorldRotation[1u].data() + slot, ry);
+    Simd::StoreUnaligned(m_WorldRotation[2u].data() + slot, rz);
+    Simd::StoreUnaligned(m_WorldRotation[3u].data() + slot, rw);
+
+    // Parent translation plus the local translation rotated as in Math::Batch::Rotate
+    const auto x   = Simd::LoadUnaligned(m_LocalTranslation.GetX().GetData() + slot);
+    const auto y   = Simd::LoadUnaligned(m_LocalTranslation.GetY().GetData() + slot);
+    const auto z   = Simd::LoadUnaligned(m_LocalTranslation.GetZ().GetData() + slot);
+    const auto two = Simd::Broadcast(static_cast<T>(2));
+
+    const auto tx = Simd::Multiply(two, Simd::Subtract(Simd::Multiply(py, z), Simd::Multiply(pz, y)));
+    const auto ty = Simd::Multiply(two, Simd::Subtract(Simd::Multiply(pz, x), Simd::Multiply(px, z)));
+    const auto tz = Simd::Multiply(two, Simd::Subtract(Simd::Multiply(px, y), Simd::Multiply(py, x)));
+
+    const auto ox = Simd::Add(Simd::Add(x, Simd::Multiply(pw, tx)), Simd::Subtract(Simd::Multiply(py, tz), Simd::Multiply(pz, ty)));
+    const auto oy = Simd::Add(Simd::Add(y, Simd::Multiply(pw, ty)), Simd::Subtract(Simd::Multiply(pz, tx), Simd::Multiply(px, tz)));
+    const auto oz = Simd::Add(Simd::Add(z, Simd::Multiply(pw, tz)), Simd::Subtract(Simd::Multiply(px, ty), Simd::Multiply(py, tx)));
+
+    Simd::StoreUnaligned(m_WorldTranslation.GetX().GetData() + slot, Simd::Add(Simd::Load(gathered[4u]), ox));
+    Simd::StoreUnaligned(m_WorldTranslation.GetY().GetData() + slot, Simd::Add(Simd::Load(gathered[5u]), oy));
+    Simd::StoreUnaligned(m_WorldTranslation.GetZ().GetData() + slot, Simd::Add(Simd::Load(gathered[6u]), oz));
+  }
+
+  // Lays the nodes out breadth first: roots in id order, then the children of each node in id order, level by level
+  void Order()
+  {
+    const std::size_t count = GetSize();
+
+    // Children of every node as one array indexed by offsets, counting sort on the parent id
+    std::vector<std::size_t> offsets(count + 2u, 0u);
+    for(std::size_t id = 0u; id < count; id++)
+    {
+      offsets[(m_Parent[id] == kNoParent) ? 0u : (m_Parent[id] + 1u)]++;
+    }
+
+    for(std::size_t i = 1u; i < offsets.size(); i++)
+    {
+      offsets[i] += offsets[i - 1u];
+    }
+
+    std::vector<std::size_t> children(count);
+    for(std::size_t id = count; id-- > 0u;)
+    {
+      children[--offsets[(m_Parent[id] == kNoParent) ? 0u : (m_Parent[id] + 1u)]] = id;
+    }
+
+    // Breadth first over the child lists gives level order, with siblings adjacent
+    std::vector<std::size_t> order(children.begin(), children.begin() + static_cast<std::ptrdiff_t>(offsets[1]));
+    order.reserve(count);
+    for(std::size_t i = 0u; i < order.size(); i++)
+    {
+      const std::size_t id = order[i];
+      const auto first     = children.begin() + static_cast<std::ptrdiff_t>(offsets[id + 1u]);
+      order.insert(order.end(), first, children.begin() + static_cast<std::ptrdiff_t>(offsets[id + 2u]));
+    }
+
+    assert(order.size() == count);
+
+    const auto permute = [&order, this](auto& values)
+    {
+      std::remove_reference_t<decltype(values)> result(values.size());
+      for(std::size_t slot = 0u; slot < order.size(); slot++)
+      {
+        result[slot] = values[m_Slot[order[slot]]];
+      }
+
+      values.swap(result);
+    };
+
+    for(std::size_t component = 0u; component < 4u; component++)
+    {
+      permute(m_LocalRotation[component]);
+      permute(m_WorldRotation[component]);
+    }
+
+    const auto permuteArray = [&order, this](Vector3Array<T>& values)
+    {
+      Vector3Array<T> result(order.size());
+      for(std::size_t slot = 0u; slot < order.size(); slot++)
+      {
+        result.Set(slot, values[m_Slot[order[slot]]]);
+      }
+
+      values = std::move(result);
+    };
+
+    permuteArray(m_LocalTranslation);
+    permuteArray(m_WorldTranslation);
+    permute(m_Dirty);
+
+    m_Id = order;
+    for(std::size_t slot = 0u; slot < count; slot++)
+    {
+      m_Slot[m_Id[slot]] = slot;
+    }
+
+    m_Levels.assign(1u, 0u);
+    for(std::size_t slot = 0u; slot < count; slot++)
+    {
+      const std::size_t parent = m_Parent[m_Id[slot]];
+      m_ParentSlot[slot]       = (parent == kNoParent) ? kNoParent : m_Slot[parent];
+      if((slot != 0u) && (m_Depth[m_Id[slot]] != m_Depth[m_Id[slot - 1u]]))
+      {
+        m_Levels.push_back(slot);
+      }
+    }
+
+    // Every level is rescanned once, the per-node marks decide what is recomputed
+    m_Levels.push_back(count);
+    m_LevelDirty.assign(m_Levels.size() - 1u, 1u);
+    m_Ordered = true;
+  }
+
+  // Indexed by id
+  std::vector<std::size_t> m_Parent;
+  std::vector<std::size_t> m_Depth;
+  std::vector<std::size_t> m_Slot;
+
+  // Indexed by slot in level order
+  std::vector<std::size_t> m_Id;
+  std::vector<std::size_t> m_ParentSlot;
+  std::vector<std::uint8_t> m_Dirty;
+  std::array<Container, 4u> m_LocalRotation;
+  std::array<Container, 4u> m_WorldRotation;
+  Vector3Array<T> m_LocalTranslation;
+  Vector3Array<T> m_WorldTranslation;
+
+  // First slot of every level followed by the node count, and whether a level holds a marked node
+  std::vector<std::size_t> m_Levels;
+  std::vector<std::uint8_t> m_LevelDirty;
+  bool m_Ordered;
+};
+
+#endif // __MATH__TRANSFORMHIERARCHY_HPP__
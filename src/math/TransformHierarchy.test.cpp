@@ -0,0 +1,179 @@
+#include "Matrix4.hpp"
+#include "Parallel.hpp"
+#include "Quaternion.hpp"
+#include "TransformHierarchy.hpp"
+#include "Vector3.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class TransformHierarchyTyped : public Test
+  {};
+
+  using TransformHierarchyTypes = Types<float, double>;
+  TYPED_TEST_SUITE(TransformHierarchyTyped, TransformHierarchyTypes);
+
+  template<class T>
+  static T CreateValue(std::uint32_t& state)
+  {
+    state = (state * 1664525u) + 1013904223u;
+    return static_cast<T>((static_cast<double>(state >> 8u) / 8388608.0) - 1.0);
+  }
+
+  template<class T>
+  static Quaternion<T> CreateRotation(std::uint32_t& state)
+  {
+    const T x = CreateValue<T>(state);
+    const T y = CreateValue<T>(state);
+    const T z = CreateValue<T>(state);
+    return Quaternion<T>::FromAxisAngle(Vector3<T>(x, y, z + static_cast<T>(2)).ToNormalized(), CreateValue<T>(state) * static_cast<T>(3));
+  }
+
+  template<class T>
+  static Vector3<T> CreateTranslation(std::uint32_t& state)
+  {
+    const T x = CreateValue<T>(state);
+    const T y = CreateValue<T>(state);
+    return Vector3<T>(x, y, CreateValue<T>(state));
+  }
+
+  // World transforms straight from the definition, parents always come before their children
+  template<class T>
+  static void ExpectWorld(const TransformHierarchy<T>& hierarchy)
+  {
+    const T tolerance = static_cast<T>(std::is_same_v<T, float> ? 1e-4 : 1e-10);
+
+    std::vector<Quaternion<T>> rotations;
+    std::vector<Vector3<T>> translations;
+    for(std::size_t id = 0u; id < hierarchy.GetSize(); id++)
+    {
+      const std::size_t parent = hierarchy.GetParent(id);
+      if(parent == TransformHierarchy<T>::kNoParent)
+      {
+        rotations.push_back(hierarchy.GetLocalRotation(id));
+        translations.push_back(hierarchy.GetLocalTranslation(id));
+      }
+      else
+      {
+        rotations.push_back(rotations[parent] * hierarchy.GetLocalRotation(id));
+        translations.push_back(translations[parent] + rotations[parent].Rotate(hierarchy.GetLocalTranslation(id)));
+      }
+
+      const Quaternion<T> rotation = hierarchy.GetWorldRotation(id);
+      const Vector3<T> translation = hierarchy.GetWorldTranslation(id);
+      ASSERT_NEAR(rotation.GetX(), rotations[id].GetX(), tolerance) << id;
+      ASSERT_NEAR(rotation.GetY(), rotations[id].GetY(), tolerance) << id;
+      ASSERT_NEAR(rotation.GetZ(), rotations[id].GetZ(), tolerance) << id;
+      ASSERT_NEAR(rotation.GetW(), rotations[id].GetW(), tolerance) << id;
+      ASSERT_NEAR(translation.GetX(), translations[id].GetX(), tolerance * 10) << id;
+      ASSERT_NEAR(translation.GetY(), translations[id].GetY(), tolerance * 10) << id;
+      ASSERT_NEAR(translation.GetZ(), translations[id].GetZ(), tolerance * 10) << id;
+    }
+  }
+
+  TYPED_TEST(TransformHierarchyTyped, Update)
+  {
+    using T = TypeParam;
+
+    TransformHierarchy<T> hierarchy;
+    ASSERT_TRUE(hierarchy.IsEmpty());
+    ASSERT_EQ(hierarchy.Update(), 0u);
+
+    // Three roots, every later node hangs off a random earlier one, so levels are uneven and interleaved by id
+    std::uint32_t state = 11u;
+    for(std::size_t i = 0u; i < 1000u; i++)
+    {
+      const std::size_t parent = (i < 3u) ? TransformHierarchy<T>::kNoParent : ((static_cast<std::size_t>(CreateValue<T>(state) * 1000) + 1000u) % i);
+      hierarchy.Add(CreateRotation<T>(state), CreateTranslation<T>(state), parent);
+    }
+
+    ASSERT_EQ(hierarchy.Update(), hierarchy.GetSize());
+    ExpectWorld(hierarchy);
+    ASSERT_EQ(hierarchy.Update(), 0u);
+
+    const Matrix4<T> matrix = hierarchy.GetWorldMatrix(500u);
+    const Vector3<T> point  = matrix.TransformPoint(Vector3<T>::Zero);
+    ASSERT_NEAR(point.GetX(), hierarchy.GetWorldTranslation(500u).GetX(), static_cast<T>(1e-5));
+  }
+
+  TYPED_TEST(TransformHierarchyTyped, Incremental)
+  {
+    using T = TypeParam;
+
+    // A chain 0 -> 1 -> ... -> 9 with two leaves on every link
+    TransformHierarchy<T> hierarchy;
+    std::uint32_t state = 5u;
+    std::size_t link    = hierarchy.Add(CreateRotation<T>(state), CreateTranslation<T>(state));
+    std::vector<std::size_t> links{link};
+    std::vector<std::size_t> leaves;
+    for(std::size_t i = 1u; i < 10u; i++)
+    {
+      leaves.push_back(hierarchy.Add(CreateRotation<T>(state), CreateTranslation<T>(state), link));
+      leaves.push_back(hierarchy.Add(CreateRotation<T>(state), CreateTranslation<T>(state), link));
+      link = hierarchy.Add(CreateRotation<T>(state), CreateTranslation<T>(state), link);
+      links.push_back(link);
+    }
+
+    ASSERT_EQ(hierarchy.Update(), hierarchy.GetSize());
+
+    // A leaf changes alone
+    hierarchy.SetLocalTranslation(leaves[4], CreateTranslation<T>(state));
+    ASSERT_EQ(hierarchy.Update(), 1u);
+    ExpectWorld(hierarchy);
+
+    // A link drags along its descendants: the rest of the chain and two leaves per remaining link
+    hierarchy.SetLocalRotation(links[6], CreateRotation<T>(state));
+    ASSERT_EQ(hierarchy.Update(), 1u + (3u * 3u));
+    ExpectWorld(hierarchy);
+
+    // Marks in one subtree twice count once
+    hierarchy.SetLocal(links[8], CreateRotation<T>(state), CreateTranslation<T>(state));
+    hierarchy.SetLocalTranslation(links[9], CreateTranslation<T>(state));
+    ASSERT_EQ(hierarchy.Update(), 1u + 3u);
+    ExpectWorld(hierarchy);
+
+    // New nodes may join any level, the next update lays the tree out again and computes only them
+    const std::size_t added = hierarchy.Add(CreateRotation<T>(state), CreateTranslation<T>(state), links[1]);
+    hierarchy.Add(CreateRotation<T>(state), CreateTranslation<T>(state), added);
+    ASSERT_EQ(hierarchy.GetDepth(added), 2u);
+    ASSERT_EQ(hierarchy.Update(), 2u);
+    ExpectWorld(hierarchy);
+    ASSERT_EQ(hierarchy.Update(), 0u);
+  }
+
+  TYPED_TEST(TransformHierarchyTyped, Parallel)
+  {
+    using T = TypeParam;
+
+    // Levels wide enough to be split over the pool, one root fanning out to two generations of children
+    TransformHierarchy<T> hierarchy;
+    std::uint32_t state      = 3u;
+    const std::size_t root   = hierarchy.Add(CreateRotation<T>(state), CreateTranslation<T>(state));
+    const std::size_t middle = TransformHierarchy<T>::kParallelLevel + 7u;
+    for(std::size_t i = 0u; i < middle; i++)
+    {
+      hierarchy.Add(CreateRotation<T>(state), CreateTranslation<T>(state), root);
+    }
+
+    for(std::size_t i = 0u; i < middle; i++)
+    {
+      hierarchy.Add(CreateRotation<T>(state), CreateTranslation<T>(state), 1u + ((i * 7u) % middle));
+    }
+
+    Math::Parallel::ThreadPool pool(4u);
+    ASSERT_EQ(hierarchy.Update(pool), hierarchy.GetSize());
+    ExpectWorld(hierarchy);
+
+    hierarchy.SetLocalRotation(root, CreateRotation<T>(state));
+    ASSERT_EQ(hierarchy.Update(pool), hierarchy.GetSize());
+    ExpectWorld(hierarchy);
+  }
+} // namespace UnitTest
@@ -0,0 +1,331 @@
+#ifndef __MATH__UNIFORMGRID_HPP__
+#define __MATH__UNIFORMGRID_HPP__
+
+#include "Span.hpp"
+#include "Spatial.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Hashed uniform grid. Space is cut into cubic cells of a fixed size and each cell hashes to one of a power of two
+ * buckets, at least as many as there are points. The points are counting sorted by bucket, so a bucket is a contiguous
+ * run of the coordinate arrays. Queries visit the cells they overlap and skip points of other cells sharing a bucket.
+ * Suits dense, evenly spread points with queries about one cell wide; the k-d tree adapts better to clustered data.
+ */
+template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+class UniformGrid
+{
+  public:
+  // cellSize > 0, and coordinates / cellSize must stay well inside the 64-bit integer range
+  void Build(Math::Span<const Vector3<T>> points, T cellSize)
+  {
+    assert(cellSize > static_cast<T>(0));
+
+    const std::size_t count = points.GetSize();
+    m_CellSize              = cellSize;
+    m_Inverse               = static_cast<T>(1) / cellSize;
+
+    std::size_t bucketCount = 1u;
+    while(bucketCount < count)
+    {
+      bucketCount <<= 1u;
+    }
+
+    m_Mask = bucketCount - 1u;
+    m_Start.assign(bucketCount + 1u, 0u);
+
+    std::vector<std::size_t> buckets(count);
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const Cell cell = GetCell(points[i].GetX(), points[i].GetY(), points[i].GetZ());
+      buckets[i]      = GetBucket(cell);
+      m_Start[buckets[i] + 1u]++;
+      m_Min = (i == 0u) ? cell : Cell{std::min(m_Min.x, cell.x), std::min(m_Min.y, cell.y), std::min(m_Min.z, cell.z)};
+      m_Max = (i == 0u) ? cell : Cell{std::max(m_Max.x, cell.x), std::max(m_Max.y, cell.y), std::max(m_Max.z, cell.z)};
+    }
+
+    for(std::size_t i = 0u; i < bucketCount; i++)
+    {
+      m_Start[i + 1u] += m_Start[i];
+    }
+
+    m_X.resize(count);
+    m_Y.resize(count);
+    m_Z.resize(count);
+    m_Index.resize(count);
+
+    std::vector<std::size_t> next(m_Start.begin(), m_Start.end() - 1);
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const std::size_t position = next[buckets[i]]++;
+      m_X[position]              = points[i].GetX();
+      m_Y[position]              = points[i].GetY();
+      m_Z[position]              = points[i].GetZ();
+      m_Index[position]          = i;
+    }
+  }
+
+  std::size_t GetSize() const { return m_Index.size(); }
+  bool IsEmpty() const { return m_Index.empty(); }
+  T GetCellSize() const { return m_CellSize; }
+
+  // Index of the closest point, Math::kNoPoint when the grid is empty
+  std::size_t Nearest(const Vector3<T>& query) const
+  {
+    Math::Detail::NearestCandidate<T> result;
+    Search(query, result);
+    return result.index;
+  }
+
+  // Indices of the count closest points, closest first
+  void Nearest(const Vector3<T>& query, std::size_t count, std::vector<std::size_t>& out) const
+  {
+    Math::Detail::NeighborHeap<T> heap(std::min(count, GetSize()));
+    if(count != 0u)
+    {
+      Search(query, heap);
+    }
+
+    heap.Extract(out);
+  }
+
+  // Indices of the points within radius of query, in no particular order
+  void Radius(const Vector3<T>& query, T radius, std::vector<std::size_t>& out) const
+  {
+    out.clear();
+    if(IsEmpty() || !(radius >= static_cast<T>(0)))
+    {
+      return;
+    }
+
+    const T squareRadius = radius * radius;
+    const Vector3<T> extent(radius, radius, radius);
+    VisitBox(query - extent, query + extent,
+             [&](std::size_t position)
+             {
+               if(Math::Detail::SquareDistance(query, m_X[position], m_Y[position], m_Z[position]) <= squareRadius)
+               {
+                 out.push_back(m_Index[position]);
+               }
+             });
+  }
+
+  // Indices of the points inside the closed box [min, max], in no particular order
+  void Box(const Vector3<T>& min, const Vector3<T>& max, std::vector<std::size_t>& out) const
+  {
+    out.clear();
+    if(IsEmpty())
+    {
+      return;
+    }
+
+    VisitBox(min, max,
+             [&](std::size_t position)
+             {
+               if(Math::Detail::IsInBox(min, max, m_X[position], m_Y[position], m_Z[position]))
+               {
+                 out.push_back(m_Index[position]);
+               }
+             });
+  }
+
+  UniformGrid() = default;
+
+  UniformGrid(Math::Span<const Vector3<T>> points, T cellSize) { Build(points, cellSize); }
+
+  private:
+  struct Cell
+  {
+    std::int64_t x;
+    std::int64_t y;
+    std::int64_t z;
+
+    bool operator==(const Cell& rhs) const { return (x == rhs.x) && (y == rhs.y) && (z == rhs.z); }
+  };
+
+  Cell GetCell(T x, T y, T z) const
+  {
+    return Cell{static_cast<std::int64_t>(std::floor(x * m_Inverse)), static_cast<std::int64_t>(std::floor(y * m_Inverse)),
+                static_cast<std::int64_t>(std::floor(z * m_Inverse))};
+  }
+
+  std::size_t GetBucket(const Cell& cell) const
+  {
+    std::uint64_t hash = static_cast<std::uint64_t>(cell.x) * 0x9E3779B97F4A7C15u;
+    hash               = (hash ^ (hash >> 29u)) + (static_cast<std::uint64_t>(cell.y) * 0xBF58476D1CE4E5B9u);
+    hash               = (hash ^ (hash >> 31u)) + (static_cast<std::uint64_t>(cell.z) * 0x94D049BB133111EBu);
+    return static_cast<std::size_t>((hash ^ (hash >> 32u)) & m_Mask);
+  }
+
+  // visit(position) for every point in cell
+  template<class Visit>
+  void VisitCell(const Cell& cell, Visit& visit) const
+  {
+    const std::size_t bucket = GetBucket(cell);
+    for(std::size_t position = m_Start[bucket]; position < m_Start[bucket + 1u]; position++)
+    {
+      if(GetCell(m_X[position], m_Y[position], m_Z[position]) == cell)
+      {
+        visit(position);
+      }
+    }
+  }
+
+  // visit(position) for every point in the occupied cells overlapping [min, max], or for all points when that is fewer
+  template<class Visit>
+  void VisitBox(const Vector3<T>& min, const Vector3<T>& max, Visit visit) const
+  {
+    if(!(min.GetX() <= max.GetX()) || !(min.GetY() <= max.GetY()) || !(min.GetZ() <= max.GetZ()))
+    {
+      return;
+    }
+
+    // Clamped in floating point first so far away boxes do not overflow the cell coordinates
+    const auto clamp = [this](T value, std::int64_t low, std::int64_t high)
+    {
+      const T cell = std::floor(value * m_Inverse);
+      return (cell < static_cast<T>(low)) ? low : ((cell > static_cast<T>(high)) ? high : static_cast<std::int64_t>(cell));
+    };
+
+    const Cell low{clamp(min.GetX(), m_Min.x, m_Max.x), clamp(min.GetY(), m_Min.y, m_Max.y), clamp(min.GetZ(), m_Min.z, m_Max.z)};
+    const Cell high{clamp(max.GetX(), m_Min.x, m_Max.x), clamp(max.GetY(), m_Min.y, m_Max.y), clamp(max.GetZ(), m_Min.z, m_Max.z)};
+
+    const double cells = static_cast<double>(high.x - low.x + 1) * static_cast<double>(high.y - low.y + 1) * static_cast<double>(high.z - low.z + 1);
+    if(cells >= static_cast<double>(GetSize()))
+    {
+      for(std::size_t position = 0u; position < GetSize(); position++)
+      {
+        visit(position);
+      }
+
+      return;
+    }
+
+    for(std::int64_t z = low.z; z <= high.z; z++)
+    {
+      for(std::int64_t y = low.y; y <= high.y; y++)
+      {
+        for(std::int64_t x = low.x; x <= high.x; x++)
+        {
+          VisitCell(Cell{x, y, z}, visit);
+        }
+      }
+    }
+  }
+
+  // Visits cells in growing shells around the query cell until no unvisited cell can beat the candidates
+  template<class Candidates>
+  void Search(const Vector3<T>& query, Candidates& candidates) const
+  {
+    if(IsEmpty())
+    {
+      return;
+    }
+
+    const auto offer = [&](std::size_t position)
+    { candidates.Offer(Math::Detail::SquareDistance(query, m_X[position], m_Y[position], m_Z[position]), m_Index[position]); };
+
+    // Shells only exist inside the occupied cells, beyond them every point has been seen
+    const auto clamp = [](T value, std::int64_t low, std::int64_t high)
+    { return (value < static_cast<T>(low)) ? low : ((value > static_cast<T>(high)) ? high : static_cast<std::int64_t>(value)); };
+
+    const T qx = std::floor(query.GetX() * m_Inverse);
+    const T qy = std::floor(query.GetY() * m_Inverse);
+    const T qz = std::floor(query.GetZ() * m_Inverse);
+    const Cell center{clamp(qx, m_Min.x, m_Max.x), clamp(qy, m_Min.y, m_Max.y), clamp(qz, m_Min.z, m_Max.z)};
+
+    // Distance from the query to the nearest wall of its cell, a full cell along axes where it lies outside the grid
+    const auto wall = [this](T value, T cell, std::int64_t clamped)
+    {
+      const T low = value - (cell * m_CellSize);
+      return (cell == static_cast<T>(clamped)) ? std::max(std::min(low, m_CellSize - low), static_cast<T>(0)) : m_CellSize;
+    };
+
+    const T inner = std::min({wall(query.GetX(), qx, center.x), wall(query.GetY(), qy, center.y), wall(query.GetZ(), qz, center.z)});
+    const T slack = static_cast<T>(8) * std::numeric_limits<T>::epsilon()
+                    * std::max({std::fabs(query.GetX()), std::fabs(query.GetY()), std::fabs(query.GetZ()), m_CellSize});
+
+    const std::int64_t last = std::max({center.x - m_Min.x, m_Max.x - center.x, center.y - m_Min.y, m_Max.y - center.y, center.z - m_Min.z,
+                                        m_Max.z - center.z});
+    double visited = 0.0;
+    for(std::int64_t ring = 0; ring <= last; ring++)
+    {
+      const Cell low{std::max(center.x - ring, m_Min.x), std::max(center.y - ring, m_Min.y), std::max(center.z - ring, m_Min.z)};
+      const Cell high{std::min(center.x + ring, m_Max.x), std::min(center.y + ring, m_Max.y), std::min(center.z + ring, m_Max.z)};
+
+      // On sparse grids a shell can hold more cells than there are points, then the points left are scanned directly
+      const double cells = static_cast<double>(high.x - low.x + 1) * static_cast<double>(high.y - low.y + 1) * static_cast<double>(high.z - low.z + 1);
+      if((cells - visited) > static_cast<double>(GetSize()))
+      {
+        for(std::size_t position = 0u; position < GetSize(); position++)
+        {
+          const Cell cell = GetCell(m_X[position], m_Y[position], m_Z[position]);
+          if(std::max({std::abs(cell.x - center.x), std::abs(cell.y - center.y), std::abs(cell.z - center.z)}) >= ring)
+          {
+            offer(position);
+          }
+        }
+
+        return;
+      }
+
+      visited = cells;
+      for(std::int64_t z = low.z; z <= high.z; z++)
+      {
+        for(std::int64_t y = low.y; y <= high.y; y++)
+        {
+          // Whole rows on the faces of the shell, only its two ends inside
+          if((z == (center.z - ring)) || (z == (center.z + ring)) || (y == (center.y - ring)) || (y == (center.y + ring)))
+          {
+            for(std::int64_t x = low.x; x <= high.x; x++)
+            {
+              VisitCell(Cell{x, y, z}, offer);
+            }
+
+            continue;
+          }
+
+          if((center.x - ring) >= m_Min.x)
+          {
+            VisitCell(Cell{center.x - ring, y, z}, offer);
+          }
+
+          if((center.x + ring) <= m_Max.x)
+          {
+            VisitCell(Cell{center.x + ring, y, z}, offer);
+          }
+        }
+      }
+
+      // Unvisited cells are at least ring + 1 cells away along one axis, so ring cells plus the wall distance in space;
+      // the slack covers the rounding of the cell assignment
+      const T reach = (static_cast<T>(ring) * m_CellSize) + inner - (static_cast<T>(ring + 1) * slack);
+      if((reach > static_cast<T>(0)) && ((reach * reach) > candidates.GetBound()))
+      {
+        return;
+      }
+    }
+  }
+
+  std::vector<T> m_X;
+  std::vector<T> m_Y;
+  std::vector<T> m_Z;
+  std::vector<std::size_t> m_Index;
+  std::vector<std::size_t> m_Start;
+  std::size_t m_Mask = 0u;
+  Cell m_Min         = {0, 0, 0};
+  Cell m_Max         = {0, 0, 0};
+  T m_CellSize       = static_cast<T>(1);
+  T m_Inverse        = static_cast<T>(1);
+};
+
+#endif // __MATH__UNIFORMGRID_HPP__
@@ -0,0 +1,62 @@
+#include "UniformGrid.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  static std::vector<Vector3<double>> CreateLattice()
+  {
+    // Integer lattice straddling the origin, so cells on both sides of zero are occupied
+    std::vector<Vector3<double>> result;
+    for(int z = -5; z < 5; z++)
+    {
+      for(int y = -5; y < 5; y++)
+      {
+        for(int x = -5; x < 5; x++)
+        {
+          result.push_back(Vector3<double>(x + 0.5, y + 0.5, z + 0.5));
+        }
+      }
+    }
+
+    return result;
+  }
+
+  TEST(UniformGrid, CellSizes)
+  {
+    const std::vector<Vector3<double>> lattice = CreateLattice();
+    const Vector3<double> query(0.9, -2.2, 3.4);
+
+    // A cell per point, many points per cell, one cell holding everything and cells far smaller than the spacing
+    for(const double cellSize : {1.0, 3.0, 100.0, 0.01})
+    {
+      const UniformGrid<double> grid(lattice, cellSize);
+      ASSERT_EQ(grid.GetCellSize(), cellSize);
+      ASSERT_EQ(grid.GetSize(), lattice.size());
+
+      const std::size_t nearest = grid.Nearest(query);
+      ASSERT_TRUE(lattice[nearest] == Vector3<double>(0.5, -2.5, 3.5)) << cellSize;
+
+      std::vector<std::size_t> out;
+      grid.Radius(query, 1.0, out);
+      ASSERT_EQ(out.size(), 4u) << cellSize;
+      for(const std::size_t index : out)
+      {
+        ASSERT_LE(Vector3<double>::Distance(lattice[index], query), 1.0);
+      }
+
+      grid.Box(Vector3<double>(-5.0, -5.0, -5.0), Vector3<double>(-4.0, -4.0, 5.0), out);
+      ASSERT_EQ(out.size(), 10u) << cellSize;
+
+      grid.Nearest(Vector3<double>(40.0, 40.0, 40.0), 1u, out);
+      ASSERT_EQ(out, (std::vector<std::size_t>{lattice.size() - 1u}));
+    }
+  }
+} // namespace UnitTest
@@ -0,0 +1,64 @@
+#include "Benchmark.hpp"
+#include "Vector2.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Benchmark
+{
+  template<class T>
+  static std::vector<Vector2<T>> CreateVectors2(std::size_t count)
+  {
+    std::vector<Vector2<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      result.push_back(Vector2<T>(CreateScalar<T>(2u * i), CreateScalar<T>((2u * i) + 1u)));
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static bool RegisterVector2()
+  {
+    using V           = Vector2<T>;
+    const auto create = &CreateVectors2<T>;
+    const T scalar    = static_cast<T>(3);
+
+    RegisterBinary(Name<T>("Vector2_Equal"), create, [](const V& a, const V& b) { return a == b; });
+    RegisterBinary(Name<T>("Vector2_NotEqual"), create, [](const V& a, const V& b) { return a != b; });
+    RegisterUnary(Name<T>("Vector2_Plus"), create, [](const V& value) { return +value; });
+    RegisterUnary(Name<T>("Vector2_Negate"), create, [](const V& value) { return -value; });
+    RegisterBinary(Name<T>("Vector2_Add"), create, [](const V& a, const V& b) { return a + b; });
+    RegisterBinary(Name<T>("Vector2_Subtract"), create, [](const V& a, const V& b) { return a - b; });
+    RegisterBinary(Name<T>("Vector2_Multiply"), create, [](const V& a, const V& b) { return a * b; });
+    RegisterBinary(Name<T>("Vector2_Divide"), create, [](const V& a, const V& b) { return a / b; });
+    RegisterUnary(Name<T>("Vector2_AddScalar"), create, [=](const V& value) { return value + scalar; });
+    RegisterUnary(Name<T>("Vector2_SubtractScalar"), create, [=](const V& value) { return value - scalar; });
+    RegisterUnary(Name<T>("Vector2_MultiplyScalar"), create, [=](const V& value) { return value * scalar; });
+    RegisterUnary(Name<T>("Vector2_DivideScalar"), create, [=](const V& value) { return value / scalar; });
+    RegisterBinary(Name<T>("Vector2_AddAssign"), create, [](V a, const V& b) { return a += b; });
+    RegisterBinary(Name<T>("Vector2_SubtractAssign"), create, [](V a, const V& b) { return a -= b; });
+    RegisterBinary(Name<T>("Vector2_MultiplyAssign"), create, [](V a, const V& b) { return a *= b; });
+    RegisterBinary(Name<T>("Vector2_DivideAssign"), create, [](V a, const V& b) { return a /= b; });
+    RegisterUnary(Name<T>("Vector2_AddAssignScalar"), create, [=](V value) { return value += scalar; });
+    RegisterUnary(Name<T>("Vector2_SubtractAssignScalar"), create, [=](V value) { return value -= scalar; });
+    RegisterUnary(Name<T>("Vector2_MultiplyAssignScalar"), create, [=](V value) { return value *= scalar; });
+    RegisterUnary(Name<T>("Vector2_DivideAssignScalar"), create, [=](V value) { return value /= scalar; });
+    RegisterBinary(Name<T>("Vector2_Distance"), create, [](const V& a, const V& b) { return V::Distance(a, b); });
+    RegisterBinary(Name<T>("Vector2_DotProduct"), create, [](const V& a, const V& b) { return V::DotProduct(a, b); });
+    RegisterBinary(Name<T>("Vector2_CrossProduct"), create, [](const V& a, const V& b) { return V::CrossProduct(a, b); });
+    RegisterUnary(Name<T>("Vector2_PerpendicularCW"), create, [](const V& value) { return V::PerpendicularCW(value); });
+    RegisterUnary(Name<T>("Vector2_PerpendicularCCW"), create, [](const V& value) { return V::PerpendicularCCW(value); });
+    RegisterUnary(Name<T>("Vector2_GetSquareMagnitude"), create, [](const V& value) { return value.GetSquareMagnitude(); });
+    RegisterUnary(Name<T>("Vector2_GetMagnitude"), create, [](const V& value) { return value.GetMagnitude(); });
+    RegisterUnary(Name<T>("Vector2_GetMagnitudeFast"), create, [](const V& value) { return value.GetMagnitude(Math::Precision::Fast()); });
+    RegisterUnary(Name<T>("Vector2_GetMagnitudeApprox"), create, [](const V& value) { return value.GetMagnitude(Math::Precision::Approx()); });
+    RegisterUnary(Name<T>("Vector2_ToNormalized"), create, [](const V& value) { return value.ToNormalized(); });
+    RegisterUnary(Name<T>("Vector2_ToNormalizedFast"), create, [](const V& value) { return value.ToNormalized(Math::Precision::Fast()); });
+    RegisterUnary(Name<T>("Vector2_ToNormalizedApprox"), create, [](const V& value) { return value.ToNormalized(Math::Precision::Approx()); });
+    return true;
+  }
+
+  static const bool kVector2Registered = RegisterVector2<float>() && RegisterVector2<double>() && RegisterVector2<int>();
+} // namespace Benchmark
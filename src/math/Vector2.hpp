@@ -1,10 +1,12 @@
 #ifndef __MATH__VECTOR2_HPP__
 #define __MATH__VECTOR2_HPP__
 
-#include <cmath>
+#include "Common.hpp"
+#include "Precision.hpp"
+
 #include <type_traits>
 
-template<class T, std::enable_if_t<std::is_arithmetic_v<T> && std::is_signed_v<T>, bool> = true>
+template<class T, std::enable_if_t<Math::kSignedScalar<T>, bool> = true>
 class Vector2
 {
   public:
@@ -16,41 +18,44 @@ class Vector2
   static constexpr Vector2<T> Up    = Vector2<T>(static_cast<T>(0), static_cast<T>(1));
   static constexpr Vector2<T> Down  = Vector2<T>(static_cast<T>(0), static_cast<T>(-1));
 
-  static T Distance(const Vector2<T>& a, const Vector2<T>& b) { return static_cast<T>(std::sqrt((a - b).GetMagnitude())); }
+  static constexpr T Distance(const Vector2<T>& a, const Vector2<T>& b) { return (a - b).GetMagnitude(); }
+
+  // Orders like Distance without the square root
+  static constexpr T SquareDistance(const Vector2<T>& a, const Vector2<T>& b) { return (a - b).GetSquareMagnitude(); }
 
-  static T DotProduct(const Vector2<T>& a, const Vector2<T>& b) { return (a.m_X * b.m_X) + (a.m_Y * b.m_Y); }
+  static constexpr T DotProduct(const Vector2<T>& a, const Vector2<T>& b) { return (a.m_X * b.m_X) + (a.m_Y * b.m_Y); }
 
-  static T CrossProduct(const Vector2<T>& a, const Vector2<T>& b) { return (a.m_X * b.m_Y) - (a.m_Y * b.m_X); }
+  static constexpr T CrossProduct(const Vector2<T>& a, const Vector2<T>& b) { return (a.m_X * b.m_Y) - (a.m_Y * b.m_X); }
 
-  static Vector2<T> PerpendicularCW(const Vector2<T>& value) { return Vector2<T>(value.m_Y, -value.m_X); }
+  static constexpr Vector2<T> PerpendicularCW(const Vector2<T>& value) { return Vector2<T>(value.m_Y, -value.m_X); }
 
-  static Vector2<T> PerpendicularCCW(const Vector2<T>& value) { return Vector2<T>(-value.m_Y, value.m_X); }
+  static constexpr Vector2<T> PerpendicularCCW(const Vector2<T>& value) { return Vector2<T>(-value.m_Y, value.m_X); }
 
-  bool operator==(const Vector2<T>& rhs) { return (m_X == rhs.m_X) && (m_Y == rhs.m_Y); }
+  constexpr bool operator==(const Vector2<T>& rhs) const { return (m_X == rhs.m_X) && (m_Y == rhs.m_Y); }
 
-  bool operator!=(const Vector2<T>& rhs) { return (m_X != rhs.m_X) || (m_Y != rhs.m_Y); }
+  constexpr bool operator!=(const Vector2<T>& rhs) const { return (m_X != rhs.m_X) || (m_Y != rhs.m_Y); }
 
-  Vector2<T> operator+() const { return Vector2<T>(+m_X, +m_Y); }
+  constexpr Vector2<T> operator+() const { return Vector2<T>(+m_X, +m_Y); }
 
-  Vector2<T> operator-() const { return Vector2<T>(-m_X, -m_Y); }
+  constexpr Vector2<T> operator-() const { return Vector2<T>(-m_X, -m_Y); }
 
-  Vector2<T> operator+(const Vector2& rhs) const { return Vector2<T>(m_X + rhs.m_X, m_Y + rhs.m_Y); }
+  constexpr Vector2<T> operator+(const Vector2& rhs) const { return Vector2<T>(m_X + rhs.m_X, m_Y + rhs.m_Y); }
 
-  Vector2<T> operator-(const Vector2& rhs) const { return Vector2<T>(m_X - rhs.m_X, m_Y - rhs.m_Y); }
+  constexpr Vector2<T> operator-(const Vector2& rhs) const { return Vector2<T>(m_X - rhs.m_X, m_Y - rhs.m_Y); }
 
-  Vector2<T> operator*(const Vector2& rhs) const { return Vector2<T>(m_X * rhs.m_X, m_Y * rhs.m_Y); }
+  constexpr Vector2<T> operator*(const Vector2& rhs) const { return Vector2<T>(m_X * rhs.m_X, m_Y * rhs.m_Y); }
 
-  Vector2<T> operator/(const Vector2& rhs) const { return Vector2<T>(m_X / rhs.m_X, m_Y / rhs.m_Y); }
+  constexpr Vector2<T> operator/(const Vector2& rhs) const { return Vector2<T>(m_X / rhs.m_X, m_Y / rhs.m_Y); }
 
-  Vector2<T> operator+(T rhs) const { return Vector2<T>(m_X + rhs, m_Y + rhs); }
+  constexpr Vector2<T> operator+(T rhs) const { return Vector2<T>(m_X + rhs, m_Y + rhs); }
 
-  Vector2<T> operator-(T rhs) const { return Vector2<T>(m_X - rhs, m_Y - rhs); }
+  constexpr Vector2<T> operator-(T rhs) const { return Vector2<T>(m_X - rhs, m_Y - rhs); }
 
-  Vector2<T> operator*(T rhs) const { return Vector2<T>(m_X * rhs, m_Y * rhs); }
+  constexpr Vector2<T> operator*(T rhs) const { return Vector2<T>(m_X * rhs, m_Y * rhs); }
 
-  Vector2<T> operator/(T rhs) const { return Vector2<T>(m_X / rhs, m_Y / rhs); }
+  constexpr Vector2<T> operator/(T rhs) const { return Vector2<T>(m_X / rhs, m_Y / rhs); }
 
-  Vector2<T>& operator+=(const Vector2& rhs)
+  constexpr Vector2<T>& operator+=(const Vector2& rhs)
   {
     m_X += rhs.m_X;
     m_Y += rhs.m_Y;
@@ -58,7 +63,7 @@ class Vector2
     return *this;
   }
 
-  Vector2<T>& operator-=(const Vector2& rhs)
+  constexpr Vector2<T>& operator-=(const Vector2& rhs)
   {
     m_X -= rhs.m_X;
     m_Y -= rhs.m_Y;
@@ -66,7 +71,7 @@ class Vector2
     return *this;
   }
 
-  Vector2<T>& operator*=(const Vector2& rhs)
+  constexpr Vector2<T>& operator*=(const Vector2& rhs)
   {
     m_X *= rhs.m_X;
     m_Y *= rhs.m_Y;
@@ -74,7 +79,7 @@ class Vector2
     return *this;
   }
 
-  Vector2<T>& operator/=(const Vector2& rhs)
+  constexpr Vector2<T>& operator/=(const Vector2& rhs)
   {
     m_X /= rhs.m_X;
     m_Y /= rhs.m_Y;
@@ -82,7 +87,7 @@ class Vector2
     return *this;
   }
 
-  Vector2<T>& operator+=(T rhs)
+  constexpr Vector2<T>& operator+=(T rhs)
   {
     m_X += rhs;
     m_Y += rhs;
@@ -90,7 +95,7 @@ class Vector2
     return *this;
   }
 
-  Vector2<T>& operator-=(T rhs)
+  constexpr Vector2<T>& operator-=(T rhs)
   {
     m_X -= rhs;
     m_Y -= rhs;
@@ -98,7 +103,7 @@ class Vector2
     return *this;
   }
 
-  Vector2<T>& operator*=(T rhs)
+  constexpr Vector2<T>& operator*=(T rhs)
   {
     m_X *= rhs;
     m_Y *= rhs;
@@ -106,7 +111,7 @@ class Vector2
     return *this;
   }
 
-  Vector2<T>& operator/=(T rhs)
+  constexpr Vector2<T>& operator/=(T rhs)
   {
     m_X /= rhs;
     m_Y /= rhs;
@@ -114,18 +119,42 @@ class Vector2
     return *this;
   }
 
-  T GetSquareMagnitude() const { return (m_X * m_X) + (m_Y * m_Y); }
+  constexpr T GetSquareMagnitude() const { return (m_X * m_X) + (m_Y * m_Y); }
+
+  constexpr T GetMagnitude() const { return static_cast<T>(Math::Sqrt(GetSquareMagnitude())); }
 
-  T GetMagnitude() const { return static_cast<T>(std::sqrt(GetSquareMagnitude())); }
+  template<class P, std::enable_if_t<Math::Precision::kPolicy<P>, bool> = true>
+  constexpr T GetMagnitude(P policy) const
+  {
+    return static_cast<T>(Math::Sqrt(GetSquareMagnitude(), policy));
+  }
 
-  Vector2<T> ToNormalized() const
+  constexpr Vector2<T> ToNormalized() const
   {
-    T magnitude = GetMagnitude();
+    MATH_INSTRUMENT_COUNT("Vector2::ToNormalized");
+
+    const T magnitude = GetMagnitude();
     return (magnitude != static_cast<T>(0)) ? ((*this) / magnitude) : (*this);
   }
 
-  T GetX() const { return m_X; }
-  T GetY() const { return m_Y; }
+  // Multiplies by the reciprocal magnitude instead of dividing, see Precision.hpp for the error of each policy
+  template<class P, std::enable_if_t<Math::Precision::kPolicy<P>, bool> = true>
+  constexpr Vector2<T> ToNormalized(P) const
+  {
+    if constexpr(Math::Precision::kEstimated<P, T>)
+    {
+      const T square = GetSquareMagnitude();
+      if(!Math::Detail::IsConstantEvaluated() && (square != static_cast<T>(0)))
+      {
+        return (*this) * Math::ReciprocalSqrt(square, P());
+      }
+    }
+
+    return ToNormalized();
+  }
+
+  constexpr T GetX() const { return m_X; }
+  constexpr T GetY() const { return m_Y; }
 
   constexpr Vector2(T x, T y)
       : m_X(x)
@@ -139,31 +168,19 @@ class Vector2
       , m_Y(static_cast<T>(0))
   {}
 
-  constexpr Vector2(const Vector2<T>& other)
-      : m_X(other.m_X)
-      , m_Y(other.m_Y)
-  {}
-
-  Vector2(Vector2<T>&& other)
-      : m_X(std::move(other.m_X))
-      , m_Y(std::move(other.m_Y))
-  {}
+  constexpr Vector2(const Vector2&) = default;
+  constexpr Vector2(Vector2&&)      = default;
 
-  constexpr Vector2& operator=(const Vector2<T>& other)
-  {
-    m_X = other.m_X;
-    m_Y = other.m_Y;
-  }
-
-  Vector2& operator=(Vector2<T>&& other)
-  {
-    m_X = std::move(other.m_X);
-    m_Y = std::move(other.m_Y);
-  }
+  constexpr Vector2& operator=(const Vector2&) = default;
+  constexpr Vector2& operator=(Vector2&&)      = default;
 
   private:
   T m_X;
   T m_Y;
 };
 
+// Arrays of them are copied, mapped and written as raw bytes
+static_assert(std::is_trivially_copyable_v<Vector2<float>> && std::is_standard_layout_v<Vector2<float>>);
+static_assert(std::is_trivially_copyable_v<Vector2<double>> && std::is_standard_layout_v<Vector2<double>>);
+
 #endif // __MATH__VECTOR2_HPP__
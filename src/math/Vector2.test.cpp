@@ -14,4 +14,28 @@ namespace UnitTest
       ASSERT_EQ(vector2.GetY(), 0.0);
     }
   }
+
+  TEST(Vector2, Constexpr)
+  {
+    constexpr Vector2<double> a(3.0, -4.0);
+    constexpr Vector2<double> b = Vector2<double>::PerpendicularCCW(a) * 2.0 + Vector2<double>::One;
+
+    static_assert(b == Vector2<double>(9.0, 7.0));
+    static_assert(Vector2<double>::DotProduct(a, b) == -1.0);
+    static_assert(Vector2<double>::CrossProduct(a, b) == 57.0);
+    static_assert(a.GetMagnitude() == 5.0);
+    static_assert(Vector2<double>::Distance(a, Vector2<double>::Zero) == 5.0);
+    static_assert(Vector2<double>::SquareDistance(a, b) == 157.0);
+    static_assert(a.ToNormalized() == Vector2<double>(0.6, -0.8));
+
+    constexpr Vector2<float> accumulated = []()
+    {
+      Vector2<float> result = Vector2<float>::Zero;
+      result += Vector2<float>::Right;
+      result *= 4.0f;
+      result -= Vector2<float>::Down;
+      return result;
+    }();
+    static_assert(accumulated == Vector2<float>(4.0f, 1.0f));
+  }
 } // namespace UnitTest
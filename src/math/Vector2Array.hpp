@@ -0,0 +1,103 @@
+#ifndef __MATH__VECTOR2ARRAY_HPP__
+#define __MATH__VECTOR2ARRAY_HPP__
+
+#include "AlignedAllocator.hpp"
+#include "Span.hpp"
+#include "Vector2.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// Structure-of-arrays storage for Vector2, keeping each component in its own contiguous, cache line aligned array
+template<class T, std::enable_if_t<std::is_arithmetic_v<T> && std::is_signed_v<T>, bool> = true>
+class Vector2Array
+{
+  public:
+  using Container = std::vector<T, Math::AlignedAllocator<T>>;
+
+  Vector2<T> operator[](std::size_t index) const { return Vector2<T>(m_X[index], m_Y[index]); }
+
+  void Set(std::size_t index, const Vector2<T>& value)
+  {
+    m_X[index] = value.GetX();
+    m_Y[index] = value.GetY();
+  }
+
+  void PushBack(const Vector2<T>& value)
+  {
+    m_X.push_back(value.GetX());
+    m_Y.push_back(value.GetY());
+  }
+
+  void Resize(std::size_t size)
+  {
+    m_X.resize(size);
+    m_Y.resize(size);
+  }
+
+  void Reserve(std::size_t capacity)
+  {
+    m_X.reserve(capacity);
+    m_Y.reserve(capacity);
+  }
+
+  void Clear()
+  {
+    m_X.clear();
+    m_Y.clear();
+  }
+
+  void ToVectors(Math::Span<Vector2<T>> out) const
+  {
+    assert(out.GetSize() >= GetSize());
+
+    const std::size_t count = GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = Vector2<T>(m_X[i], m_Y[i]);
+    }
+  }
+
+  std::vector<Vector2<T>> ToVectors() const
+  {
+    std::vector<Vector2<T>> result(GetSize());
+    ToVectors(Math::Span<Vector2<T>>(result));
+    return result;
+  }
+
+  std::size_t GetSize() const { return m_X.size(); }
+  bool IsEmpty() const { return m_X.empty(); }
+
+  Math::Span<T> GetX() { return Math::Span<T>(m_X); }
+  Math::Span<T> GetY() { return Math::Span<T>(m_Y); }
+
+  Math::Span<const T> GetX() const { return Math::Span<const T>(m_X); }
+  Math::Span<const T> GetY() const { return Math::Span<const T>(m_Y); }
+
+  Vector2Array(Math::Span<const Vector2<T>> values)
+      : m_X(values.GetSize())
+      , m_Y(values.GetSize())
+  {
+    const std::size_t count = values.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      m_X[i] = values[i].GetX();
+      m_Y[i] = values[i].GetY();
+    }
+  }
+
+  explicit Vector2Array(std::size_t size)
+      : m_X(size)
+      , m_Y(size)
+  {}
+
+  Vector2Array() = default;
+
+  private:
+  Container m_X;
+  Container m_Y;
+};
+
+#endif // __MATH__VECTOR2ARRAY_HPP__
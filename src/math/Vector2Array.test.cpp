@@ -0,0 +1,40 @@
+#include "Vector2Array.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  TEST(Vector2Array, Conversion)
+  {
+    std::vector<Vector2<double>> vectors;
+    for(std::size_t i = 0u; i < 37u; i++)
+    {
+      const double value = static_cast<double>(i);
+      vectors.push_back(Vector2<double>(value - 8.0, (value * 0.5) + 1.0));
+    }
+
+    Vector2Array<double> array(vectors);
+    ASSERT_EQ(array.GetSize(), vectors.size());
+
+    const std::vector<Vector2<double>> result = array.ToVectors();
+    ASSERT_EQ(result.size(), vectors.size());
+    for(std::size_t i = 0u; i < vectors.size(); i++)
+    {
+      ASSERT_TRUE(result[i] == vectors[i]);
+      ASSERT_TRUE(array[i] == vectors[i]);
+      ASSERT_EQ(array.GetY()[i], vectors[i].GetY());
+    }
+
+    array.Set(3u, Vector2<double>::One);
+    array.PushBack(Vector2<double>::Up);
+    ASSERT_TRUE(array[3u] == Vector2<double>::One);
+    ASSERT_TRUE(array[37u] == Vector2<double>::Up);
+
+    array.Clear();
+    ASSERT_TRUE(array.IsEmpty());
+  }
+} // namespace UnitTest
@@ -0,0 +1,66 @@
+#include "Benchmark.hpp"
+#include "Vector3.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Benchmark
+{
+  template<class T>
+  static std::vector<Vector3<T>> CreateVectors3(std::size_t count)
+  {
+    std::vector<Vector3<T>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      result.push_back(Vector3<T>(CreateScalar<T>(3u * i), CreateScalar<T>((3u * i) + 1u), CreateScalar<T>((3u * i) + 2u)));
+    }
+
+    return result;
+  }
+
+  template<class T>
+  static bool RegisterVector3()
+  {
+    using V           = Vector3<T>;
+    const auto create = &CreateVectors3<T>;
+    const T scalar    = static_cast<T>(3);
+
+    RegisterBinary(Name<T>("Vector3_Equal"), create, [](const V& a, const V& b) { return a == b; });
+    RegisterBinary(Name<T>("Vector3_NotEqual"), create, [](const V& a, const V& b) { return a != b; });
+    RegisterUnary(Name<T>("Vector3_Plus"), create, [](const V& value) { return +value; });
+    RegisterUnary(Name<T>("Vector3_Negate"), create, [](const V& value) { return -value; });
+    RegisterBinary(Name<T>("Vector3_Add"), create, [](const V& a, const V& b) { return a + b; });
+    RegisterBinary(Name<T>("Vector3_Subtract"), create, [](const V& a, const V& b) { return a - b; });
+    RegisterBinary(Name<T>("Vector3_Multiply"), create, [](const V& a, const V& b) { return a * b; });
+    RegisterBinary(Name<T>("Vector3_Divide"), create, [](const V& a, const V& b) { return a / b; });
+    RegisterUnary(Name<T>("Vector3_AddScalar"), create, [=](const V& value) { return value + scalar; });
+    RegisterUnary(Name<T>("Vector3_SubtractScalar"), create, [=](const V& value) { return value - scalar; });
+    RegisterUnary(Name<T>("Vector3_MultiplyScalar"), create, [=](const V& value) { return value * scalar; });
+    RegisterUnary(Name<T>("Vector3_DivideScalar"), create, [=](const V& value) { return value / scalar; });
+    RegisterBinary(Name<T>("Vector3_AddAssign"), create, [](V a, const V& b) { return a += b; });
+    RegisterBinary(Name<T>("Vector3_SubtractAssign"), create, [](V a, const V& b) { return a -= b; });
+    RegisterBinary(Name<T>("Vector3_MultiplyAssign"), create, [](V a, const V& b) { return a *= b; });
+    RegisterBinary(Name<T>("Vector3_DivideAssign"), create, [](V a, const V& b) { return a /= b; });
+    RegisterUnary(Name<T>("Vector3_AddAssignScalar"), create, [=](V value) { return value += scalar; });
+    RegisterUnary(Name<T>("Vector3_SubtractAssignScalar"), create, [=](V value) { return value -= scalar; });
+    RegisterUnary(Name<T>("Vector3_MultiplyAssignScalar"), create, [=](V value) { return value *= scalar; });
+    RegisterUnary(Name<T>("Vector3_DivideAssignScalar"), create, [=](V value) { return value /= scalar; });
+    RegisterBinary(Name<T>("Vector3_Distance"), create, [](const V& a, const V& b) { return V::Distance(a, b); });
+    RegisterBinary(Name<T>("Vector3_DotProduct"), create, [](const V& a, const V& b) { return V::DotProduct(a, b); });
+    RegisterBinary(Name<T>("Vector3_CrossProduct"), create, [](const V& a, const V& b) { return V::CrossProduct(a, b); });
+    RegisterUnary(Name<T>("Vector3_ToVector2"), create, [](const V& value) { return static_cast<Vector2<T>>(value); });
+    RegisterUnary(Name<T>("Vector3_GetSquareMagnitude"), create, [](const V& value) { return value.GetSquareMagnitude(); });
+    RegisterUnary(Name<T>("Vector3_GetMagnitude"), create, [](const V& value) { return value.GetMagnitude(); });
+    RegisterUnary(Name<T>("Vector3_GetMagnitudeFast"), create, [](const V& value) { return value.GetMagnitude(Math::Precision::Fast()); });
+    RegisterUnary(Name<T>("Vector3_GetMagnitudeApprox"), create, [](const V& value) { return value.GetMagnitude(Math::Precision::Approx()); });
+    RegisterUnary(Name<T>("Vector3_ToNormalized"), create, [](const V& value) { return value.ToNormalized(); });
+    RegisterUnary(Name<T>("Vector3_ToNormalizedFast"), create, [](const V& value) { return value.ToNormalized(Math::Precision::Fast()); });
+    RegisterUnary(Name<T>("Vector3_ToNormalizedApprox"), create, [](const V& value) { return value.ToNormalized(Math::Precision::Approx()); });
+    // Chains keep intermediates in registers, where a single operation mostly measures its own load and store
+    RegisterBinary(Name<T>("Vector3_Chain"), create,
+                   [](const V& a, const V& b) { return V::DotProduct((a + (b * static_cast<T>(2)) - V::CrossProduct(a, b)).ToNormalized(), a); });
+    return true;
+  }
+
+  static const bool kVector3Registered = RegisterVector3<float>() && RegisterVector3<double>() && RegisterVector3<int>();
+} // namespace Benchmark
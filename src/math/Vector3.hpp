@@ -1,13 +1,14 @@
 #ifndef __MATH__VECTOR3_HPP__
 #define __MATH__VECTOR3_HPP__
 
+#include "Common.hpp"
+#include "Simd.hpp"
 #include "Vector2.hpp"
 
-#include <cmath>
 #include <type_traits>
 
-template<class T, std::enable_if_t<std::is_arithmetic_v<T> && std::is_signed_v<T>, bool> = true>
-class Vector3
+template<class T, std::enable_if_t<Math::kSignedScalar<T>, bool> = true>
+class alignas(Math::Simd::Traits<T>::kAlignment) Vector3
 {
   public:
   static constexpr Vector3<T> Zero = Vector3<T>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
@@ -20,177 +21,275 @@ class Vector3
   static constexpr Vector3<T> Forward = Vector3<T>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(1));
   static constexpr Vector3<T> Back    = Vector3<T>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(-1));
 
-  static T Distance(const Vector3<T>& a, const Vector3<T>& b) { return static_cast<T>(std::sqrt((a - b).GetMagnitude())); }
+  static constexpr T Distance(const Vector3<T>& a, const Vector3<T>& b) { return (a - b).GetMagnitude(); }
 
-  static T DotProduct(const Vector3<T>& a, const Vector3<T>& b) { return (a.m_X * b.m_X) + (a.m_Y * b.m_Y) + (a.m_Z * b.m_Z); }
+  // Orders like Distance without the square root
+  static constexpr T SquareDistance(const Vector3<T>& a, const Vector3<T>& b) { return (a - b).GetSquareMagnitude(); }
 
-  static Vector3 CrossProduct(const Vector3<T>& a, const Vector3<T>& b)
+  static constexpr T DotProduct(const Vector3<T>& a, const Vector3<T>& b)
   {
-    return Vector3((a.m_Y * b.m_Z) - (a.m_Z * b.m_Y), (a.m_Z * b.m_X) - (a.m_X * b.m_Z), (a.m_X * b.m_Y) - (a.m_Y * b.m_X));
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return Math::Simd::HorizontalSum(Math::Simd::Multiply(a.ToRegister(), b.ToRegister()));
+      }
+    }
+
+    return (a.GetX() * b.GetX()) + (a.GetY() * b.GetY()) + (a.GetZ() * b.GetZ());
   }
 
-  bool operator==(const Vector3<T>& rhs) { return (m_X == rhs.m_X) && (m_Y == rhs.m_Y) && (m_Z == rhs.m_Z); }
-
-  bool operator!=(const Vector3<T>& rhs) { return (m_X != rhs.m_X) || (m_Y != rhs.m_Y) || (m_Z != rhs.m_Z); }
-
-  Vector3<T> operator+() const { return Vector3<T>(+m_X, +m_Y, +m_Z); }
-
-  Vector3<T> operator-() const { return Vector3<T>(-m_X, -m_Y, -m_Z); }
-
-  Vector3<T> operator+(const Vector3& rhs) const { return Vector3<T>(m_X + rhs.m_X, m_Y + rhs.m_Y, m_Z + rhs.m_Z); }
-
-  Vector3<T> operator-(const Vector3& rhs) const { return Vector3<T>(m_X - rhs.m_X, m_Y - rhs.m_Y, m_Z - rhs.m_Z); }
-
-  Vector3<T> operator*(const Vector3& rhs) const { return Vector3<T>(m_X * rhs.m_X, m_Y * rhs.m_Y, m_Z * rhs.m_Z); }
-
-  Vector3<T> operator/(const Vector3& rhs) const { return Vector3<T>(m_X / rhs.m_X, m_Y / rhs.m_Y, m_Z / rhs.m_Z); }
-
-  Vector3<T> operator+(T rhs) const { return Vector3<T>(m_X + rhs, m_Y + rhs, m_Z + rhs); }
+  static constexpr Vector3 CrossProduct(const Vector3<T>& a, const Vector3<T>& b)
+  {
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        const Register lhs = a.ToRegister();
+        const Register rhs = b.ToRegister();
+        const Register zxy = Math::Simd::Subtract(Math::Simd::Multiply(lhs, Math::Simd::Shuffle<1, 2, 0, 3>(rhs)),
+                                                  Math::Simd::Multiply(Math::Simd::Shuffle<1, 2, 0, 3>(lhs), rhs));
+        return FromRegister(Math::Simd::Shuffle<1, 2, 0, 3>(zxy));
+      }
+    }
+
+    return Vector3((a.GetY() * b.GetZ()) - (a.GetZ() * b.GetY()), (a.GetZ() * b.GetX()) - (a.GetX() * b.GetZ()), (a.GetX() * b.GetY()) - (a.GetY() * b.GetX()));
+  }
 
-  Vector3<T> operator-(T rhs) const { return Vector3<T>(m_X - rhs, m_Y - rhs, m_Z - rhs); }
+  constexpr bool operator==(const Vector3<T>& rhs) const { return (GetX() == rhs.GetX()) && (GetY() == rhs.GetY()) && (GetZ() == rhs.GetZ()); }
 
-  Vector3<T> operator*(T rhs) const { return Vector3<T>(m_X * rhs, m_Y * rhs, m_Z * rhs); }
+  constexpr bool operator!=(const Vector3<T>& rhs) const { return (GetX() != rhs.GetX()) || (GetY() != rhs.GetY()) || (GetZ() != rhs.GetZ()); }
 
-  Vector3<T> operator/(T rhs) const { return Vector3<T>(m_X / rhs, m_Y / rhs, m_Z / rhs); }
+  constexpr Vector3<T> operator+() const { return Vector3<T>(+GetX(), +GetY(), +GetZ()); }
 
-  Vector3<T>& operator+=(const Vector3& rhs)
+  constexpr Vector3<T> operator-() const
   {
-    m_X += rhs.m_X;
-    m_Y += rhs.m_Y;
-    m_Z += rhs.m_Z;
-
-    return *this;
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Negate<true, true, true, false>(ToRegister()));
+      }
+    }
+
+    return Vector3<T>(-GetX(), -GetY(), -GetZ());
   }
 
-  Vector3<T>& operator-=(const Vector3& rhs)
+  constexpr Vector3<T> operator+(const Vector3& rhs) const
   {
-    m_X -= rhs.m_X;
-    m_Y -= rhs.m_Y;
-    m_Z -= rhs.m_Z;
-
-    return *this;
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Add(ToRegister(), rhs.ToRegister()));
+      }
+    }
+
+    return Vector3<T>(GetX() + rhs.GetX(), GetY() + rhs.GetY(), GetZ() + rhs.GetZ());
   }
 
-  Vector3<T>& operator*=(const Vector3& rhs)
+  constexpr Vector3<T> operator-(const Vector3& rhs) const
   {
-    m_X *= rhs.m_X;
-    m_Y *= rhs.m_Y;
-    m_Z *= rhs.m_Z;
-
-    return *this;
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Subtract(ToRegister(), rhs.ToRegister()));
+      }
+    }
+
+    return Vector3<T>(GetX() - rhs.GetX(), GetY() - rhs.GetY(), GetZ() - rhs.GetZ());
   }
 
-  Vector3<T>& operator/=(const Vector3& rhs)
+  constexpr Vector3<T> operator*(const Vector3& rhs) const
   {
-    m_X /= rhs.m_X;
-    m_Y /= rhs.m_Y;
-    m_Z /= rhs.m_Z;
-
-    return *this;
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Multiply(ToRegister(), rhs.ToRegister()));
+      }
+    }
+
+    return Vector3<T>(GetX() * rhs.GetX(), GetY() * rhs.GetY(), GetZ() * rhs.GetZ());
   }
 
-  Vector3<T>& operator+=(T rhs)
+  constexpr Vector3<T> operator/(const Vector3& rhs) const
   {
-    m_X += rhs;
-    m_Y += rhs;
-    m_Z += rhs;
-
-    return *this;
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        // The padding lane of the divisor is one so that lane never computes 0/0
+        const Register divisor = Math::Simd::Set(rhs.GetX(), rhs.GetY(), rhs.GetZ(), static_cast<T>(1));
+        return FromRegister(Math::Simd::Divide(ToRegister(), divisor));
+      }
+    }
+
+    return Vector3<T>(GetX() / rhs.GetX(), GetY() / rhs.GetY(), GetZ() / rhs.GetZ());
   }
 
-  Vector3<T>& operator-=(T rhs)
+  constexpr Vector3<T> operator+(T rhs) const
   {
-    m_X -= rhs;
-    m_Y -= rhs;
-    m_Z -= rhs;
-
-    return *this;
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Add(ToRegister(), ScalarRegister(rhs)));
+      }
+    }
+
+    return Vector3<T>(GetX() + rhs, GetY() + rhs, GetZ() + rhs);
   }
 
-  Vector3<T>& operator*=(T rhs)
+  constexpr Vector3<T> operator-(T rhs) const
   {
-    m_X *= rhs;
-    m_Y *= rhs;
-    m_Z *= rhs;
-
-    return *this;
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Subtract(ToRegister(), ScalarRegister(rhs)));
+      }
+    }
+
+    return Vector3<T>(GetX() - rhs, GetY() - rhs, GetZ() - rhs);
   }
 
-  Vector3<T>& operator/=(T rhs)
+  constexpr Vector3<T> operator*(T rhs) const
   {
-    m_X /= rhs;
-    m_Y /= rhs;
-    m_Z /= rhs;
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Multiply(ToRegister(), ScalarRegister(rhs)));
+      }
+    }
+
+    return Vector3<T>(GetX() * rhs, GetY() * rhs, GetZ() * rhs);
+  }
 
-    return *this;
+  constexpr Vector3<T> operator/(T rhs) const
+  {
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        return FromRegister(Math::Simd::Divide(ToRegister(), ScalarRegister(rhs, static_cast<T>(1))));
+      }
+    }
+
+    return Vector3<T>(GetX() / rhs, GetY() / rhs, GetZ() / rhs);
   }
 
-  operator Vector2<T>() const { return Vector2<T>(m_X, m_Y); }
+  constexpr Vector3<T>& operator+=(const Vector3& rhs) { return (*this) = (*this) + rhs; }
+
+  constexpr Vector3<T>& operator-=(const Vector3& rhs) { return (*this) = (*this) - rhs; }
+
+  constexpr Vector3<T>& operator*=(const Vector3& rhs) { return (*this) = (*this) * rhs; }
+
+  constexpr Vector3<T>& operator/=(const Vector3& rhs) { return (*this) = (*this) / rhs; }
+
+  constexpr Vector3<T>& operator+=(T rhs) { return (*this) = (*this) + rhs; }
 
-  T GetSquareMagnitude() const { return (m_X * m_X) + (m_Y * m_Y) + (m_Z * m_Z); }
+  constexpr Vector3<T>& operator-=(T rhs) { return (*this) = (*this) - rhs; }
 
-  T GetMagnitude() const { return static_cast<T>(std::sqrt(GetSquareMagnitude())); }
+  constexpr Vector3<T>& operator*=(T rhs) { return (*this) = (*this) * rhs; }
 
-  Vector3<T> ToNormalized() const
+  constexpr Vector3<T>& operator/=(T rhs) { return (*this) = (*this) / rhs; }
+
+  constexpr operator Vector2<T>() const { return Vector2<T>(GetX(), GetY()); }
+
+  constexpr T GetSquareMagnitude() const { return DotProduct(*this, *this); }
+
+  constexpr T GetMagnitude() const { return static_cast<T>(Math::Sqrt(GetSquareMagnitude())); }
+
+  template<class P, std::enable_if_t<Math::Precision::kPolicy<P>, bool> = true>
+  constexpr T GetMagnitude(P policy) const
+  {
+    return static_cast<T>(Math::Sqrt(GetSquareMagnitude(), policy));
+  }
+
+  constexpr Vector3<T> ToNormalized() const
   {
-    T magnitude = GetMagnitude();
+    MATH_INSTRUMENT_COUNT("Vector3::ToNormalized");
+
+    const T magnitude = GetMagnitude();
     return (magnitude != static_cast<T>(0)) ? ((*this) / magnitude) : (*this);
   }
 
-  T GetX() const { return m_X; }
-  T GetY() const { return m_Y; }
-  T GetZ() const { return m_Z; }
+  // Multiplies by the reciprocal magnitude instead of dividing, see Precision.hpp for the error of each policy
+  template<class P, std::enable_if_t<Math::Precision::kPolicy<P>, bool> = true>
+  constexpr Vector3<T> ToNormalized(P) const
+  {
+    if constexpr(Math::Precision::kEstimated<P, T>)
+    {
+      const T square = GetSquareMagnitude();
+      if(!Math::Detail::IsConstantEvaluated() && (square != static_cast<T>(0)))
+      {
+        return (*this) * Math::ReciprocalSqrt(square, P());
+      }
+    }
+
+    return ToNormalized();
+  }
+
+  constexpr T GetX() const { return m_Values[0]; }
+  constexpr T GetY() const { return m_Values[1]; }
+  constexpr T GetZ() const { return m_Values[2]; }
 
   constexpr Vector3(T x, T y, T z)
-      : m_X(x)
-      , m_Y(y)
-      , m_Z(z)
-  {}
+      : m_Values{x, y, z}
+  {
+    if constexpr(kPacked)
+    {
+      if(!Math::Detail::IsConstantEvaluated())
+      {
+        // Written as one register, a packed operation reading it right after gets the store forwarded
+        Math::Simd::Store(m_Values, Math::Simd::Set(x, y, z, static_cast<T>(0)));
+      }
+    }
+  }
 
   constexpr Vector3(const Vector2<T>& other)
-      : m_X(other.m_X)
-      , m_Y(other.m_Y)
-      , m_Z(static_cast<T>(0))
+      : Vector3(other.GetX(), other.GetY(), static_cast<T>(0))
   {}
 
   ~Vector3() = default;
 
   constexpr Vector3()
-      : m_X(static_cast<T>(0))
-      , m_Y(static_cast<T>(0))
-      , m_Z(static_cast<T>(0))
+      : m_Values{}
   {}
 
-  constexpr Vector3(const Vector3<T>& other)
-      : m_X(other.m_X)
-      , m_Y(other.m_Y)
-      , m_Z(other.m_Z)
-  {}
+  constexpr Vector3(const Vector3&) = default;
+  constexpr Vector3(Vector3&&)      = default;
 
-  Vector3(Vector3<T>&& other)
-      : m_X(std::move(other.m_X))
-      , m_Y(std::move(other.m_Y))
-      , m_Z(std::move(other.m_Z))
-  {}
+  constexpr Vector3& operator=(const Vector3&) = default;
+  constexpr Vector3& operator=(Vector3&&)      = default;
 
-  constexpr Vector3& operator=(const Vector3<T>& other)
-  {
-    m_X = other.m_X;
-    m_Y = other.m_Y;
-    m_Z = other.m_Z;
-  }
+  private:
+  static constexpr bool kPacked = Math::Simd::Traits<T>::kEnabled;
+  using Register                = typename Math::Simd::Traits<T>::Register;
+
+  // The padding lane is zero from construction on and every packed operation keeps it zero, so a vector loads and stores
+  // as one aligned register and the padding never reaches a horizontal sum
+  Register ToRegister() const { return Math::Simd::Load(m_Values); }
 
-  Vector3& operator=(Vector3<T>&& other)
+  static Vector3<T> FromRegister(Register value)
   {
-    m_X = std::move(other.m_X);
-    m_Y = std::move(other.m_Y);
-    m_Z = std::move(other.m_Z);
+    Vector3<T> result;
+    Math::Simd::Store(result.m_Values, value);
+    return result;
   }
 
-  private:
-  T m_X;
-  T m_Y;
-  T m_Z;
+  // A scalar operand with its own padding lane, zero for the padding to stay zero and one as a divisor
+  static Register ScalarRegister(T value, T padding = static_cast<T>(0)) { return Math::Simd::Set(value, value, value, padding); }
+
+  // x, y, z and, for packed types, the padding lane that fills the register
+  T m_Values[kPacked ? Math::Simd::Traits<T>::kLanes : 3u];
 };
 
+// Arrays of them are copied, mapped and written as raw bytes
+static_assert(std::is_trivially_copyable_v<Vector3<float>> && std::is_standard_layout_v<Vector3<float>>);
+static_assert(std::is_trivially_copyable_v<Vector3<double>> && std::is_standard_layout_v<Vector3<double>>);
+
 #endif // __MATH__VECTOR3_HPP__
@@ -1,5 +1,8 @@
 #include "Vector3.hpp"
 
+#include <array>
+#include <limits>
+
 #include <gtest/gtest.h>
 
 using namespace ::testing;
@@ -15,4 +18,120 @@ namespace UnitTest
       ASSERT_EQ(vector3.GetZ(), 0.0);
     }
   }
+
+  template<class T>
+  class Vector3Typed : public Test
+  {};
+
+  using Vector3Types = Types<float, double>;
+  TYPED_TEST_SUITE(Vector3Typed, Vector3Types);
+
+  TYPED_TEST(Vector3Typed, Arithmetic)
+  {
+    using T = TypeParam;
+
+    const Vector3<T> a(static_cast<T>(1), static_cast<T>(-2), static_cast<T>(3));
+    const Vector3<T> b(static_cast<T>(4), static_cast<T>(5), static_cast<T>(-8));
+
+    ASSERT_TRUE((a + b) == Vector3<T>(static_cast<T>(5), static_cast<T>(3), static_cast<T>(-5)));
+    ASSERT_TRUE((a - b) == Vector3<T>(static_cast<T>(-3), static_cast<T>(-7), static_cast<T>(11)));
+    ASSERT_TRUE((a * b) == Vector3<T>(static_cast<T>(4), static_cast<T>(-10), static_cast<T>(-24)));
+    ASSERT_TRUE((b / a) == Vector3<T>(static_cast<T>(4), static_cast<T>(-2.5), static_cast<T>(-8) / static_cast<T>(3)));
+    ASSERT_TRUE((a * static_cast<T>(2)) == Vector3<T>(static_cast<T>(2), static_cast<T>(-4), static_cast<T>(6)));
+    ASSERT_TRUE((a / static_cast<T>(2)) == Vector3<T>(static_cast<T>(0.5), static_cast<T>(-1), static_cast<T>(1.5)));
+    ASSERT_TRUE((a + static_cast<T>(1)) == Vector3<T>(static_cast<T>(2), static_cast<T>(-1), static_cast<T>(4)));
+    ASSERT_TRUE((a - static_cast<T>(1)) == Vector3<T>(static_cast<T>(0), static_cast<T>(-3), static_cast<T>(2)));
+    ASSERT_TRUE((-a) == Vector3<T>(static_cast<T>(-1), static_cast<T>(2), static_cast<T>(-3)));
+
+    Vector3<T> c = a;
+    c += b;
+    c *= static_cast<T>(2);
+    c -= a;
+    c /= b;
+    ASSERT_TRUE(c == ((((a + b) * static_cast<T>(2)) - a) / b));
+  }
+
+  TYPED_TEST(Vector3Typed, Products)
+  {
+    using T = TypeParam;
+
+    const Vector3<T> a(static_cast<T>(1), static_cast<T>(-2), static_cast<T>(3));
+    const Vector3<T> b(static_cast<T>(4), static_cast<T>(5), static_cast<T>(-8));
+
+    ASSERT_EQ(Vector3<T>::DotProduct(a, b), static_cast<T>(-30));
+    ASSERT_TRUE(Vector3<T>::CrossProduct(a, b) == Vector3<T>(static_cast<T>(1), static_cast<T>(20), static_cast<T>(13)));
+    ASSERT_TRUE(Vector3<T>::CrossProduct(Vector3<T>::Right, Vector3<T>::Up) == Vector3<T>::Forward);
+  }
+
+  TYPED_TEST(Vector3Typed, Distance)
+  {
+    using T = TypeParam;
+
+    const Vector3<T> a(static_cast<T>(1), static_cast<T>(-2), static_cast<T>(3));
+    const Vector3<T> b(static_cast<T>(3), static_cast<T>(-5), static_cast<T>(9));
+    ASSERT_EQ(Vector3<T>::SquareDistance(a, b), static_cast<T>(49));
+    ASSERT_EQ(Vector3<T>::Distance(a, b), static_cast<T>(7));
+    ASSERT_EQ(Vector3<T>::Distance(b, a), static_cast<T>(7));
+    ASSERT_EQ(Vector3<T>::Distance(a, a), static_cast<T>(0));
+  }
+
+  TYPED_TEST(Vector3Typed, Magnitude)
+  {
+    using T = TypeParam;
+
+    const Vector3<T> a(static_cast<T>(2), static_cast<T>(-3), static_cast<T>(6));
+    ASSERT_EQ(a.GetSquareMagnitude(), static_cast<T>(49));
+    ASSERT_EQ(a.GetMagnitude(), static_cast<T>(7));
+
+    const Vector3<T> normalized = a.ToNormalized();
+    ASSERT_EQ(normalized.GetX(), static_cast<T>(2) / static_cast<T>(7));
+    ASSERT_EQ(normalized.GetY(), static_cast<T>(-3) / static_cast<T>(7));
+    ASSERT_EQ(normalized.GetZ(), static_cast<T>(6) / static_cast<T>(7));
+
+    ASSERT_TRUE(Vector3<T>::Zero.ToNormalized() == Vector3<T>::Zero);
+  }
+
+  // Every unit direction towards the corners, edges and faces of a cube, built at compile time
+  template<class T>
+  static constexpr std::array<Vector3<T>, 26> CreateDirections()
+  {
+    std::array<Vector3<T>, 26> result = {};
+    std::size_t count                 = 0u;
+    for(int x = -1; x <= 1; x++)
+    {
+      for(int y = -1; y <= 1; y++)
+      {
+        for(int z = -1; z <= 1; z++)
+        {
+          if((x != 0) || (y != 0) || (z != 0))
+          {
+            result[count++] = Vector3<T>(static_cast<T>(x), static_cast<T>(y), static_cast<T>(z)).ToNormalized();
+          }
+        }
+      }
+    }
+
+    return result;
+  }
+
+  TYPED_TEST(Vector3Typed, Constexpr)
+  {
+    using T = TypeParam;
+
+    constexpr Vector3<T> a(static_cast<T>(2), static_cast<T>(3), static_cast<T>(6));
+    static_assert(Vector3<T>::CrossProduct(Vector3<T>::Right, Vector3<T>::Up) == Vector3<T>::Forward);
+    static_assert(Vector3<T>::DotProduct(a, Vector3<T>::One) == static_cast<T>(11));
+    static_assert((-a + (a * static_cast<T>(2)) - (a / a)) == Vector3<T>(static_cast<T>(1), static_cast<T>(2), static_cast<T>(5)));
+    static_assert(a.GetMagnitude() == static_cast<T>(7));
+    static_assert(Vector2<T>(a) == Vector2<T>(static_cast<T>(2), static_cast<T>(3)));
+
+    // Compile-time and runtime evaluation take different code paths but agree
+    constexpr std::array<Vector3<T>, 26> kDirections = CreateDirections<T>();
+    const std::array<Vector3<T>, 26> directions      = CreateDirections<T>();
+    for(std::size_t i = 0u; i < kDirections.size(); i++)
+    {
+      ASSERT_TRUE(kDirections[i] == directions[i]);
+      ASSERT_NEAR(kDirections[i].GetMagnitude(), static_cast<T>(1), std::numeric_limits<T>::epsilon());
+    }
+  }
 } // namespace UnitTest
@@ -0,0 +1,82 @@
+#include "Benchmark.hpp"
+#include "Precision.hpp"
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+#include "VectorExpression.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace Benchmark
+{
+  template<class T>
+  static Vector3Array<T> CreateArray(std::size_t count, std::size_t seed)
+  {
+    Vector3Array<T> result(count);
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const std::size_t index = 3u * (i + seed);
+      result.GetX()[i]        = CreateScalar<T>(index);
+      result.GetY()[i]        = CreateScalar<T>(index + 1u);
+      result.GetZ()[i]        = CreateScalar<T>(index + 2u);
+    }
+
+    return result;
+  }
+
+  // kernel(a, b, out) over two arrays of count vectors
+  template<class T, class Kernel>
+  static void RegisterArrays(const char* name, Kernel kernel)
+  {
+    RegisterBatch(Name<T>(name),
+                  [kernel](std::size_t count)
+                  {
+                    return [kernel, a = CreateArray<T>(count, 0u), b = CreateArray<T>(count, count), out = Vector3Array<T>(count)]() mutable
+                    { kernel(a, b, out); };
+                  });
+  }
+
+  // kernel(a, out) with a scalar output per vector
+  template<class T, class Kernel>
+  static void RegisterReduction(const char* name, Kernel kernel)
+  {
+    RegisterBatch(Name<T>(name),
+                  [kernel](std::size_t count)
+                  {
+                    return [kernel, a = CreateArray<T>(count, 0u), b = CreateArray<T>(count, count), out = std::vector<T>(count)]() mutable
+                    { kernel(a, b, Math::Span<T>(out)); };
+                  });
+  }
+
+  template<class T>
+  static bool RegisterVector3Array()
+  {
+    using A = Vector3Array<T>;
+    using S = Math::Span<T>;
+
+    const T scalar = static_cast<T>(3);
+
+    RegisterArrays<T>("Vector3Array_Add", [](const A& a, const A& b, A& out) { Math::Batch::Add(a, b, out); });
+    RegisterArrays<T>("Vector3Array_Subtract", [](const A& a, const A& b, A& out) { Math::Batch::Subtract(a, b, out); });
+    RegisterArrays<T>("Vector3Array_Scale", [=](const A& a, const A&, A& out) { Math::Batch::Scale(a, scalar, out); });
+    RegisterArrays<T>("Vector3Array_CrossProduct", [](const A& a, const A& b, A& out) { Math::Batch::CrossProduct(a, b, out); });
+    RegisterArrays<T>("Vector3Array_Normalize", [](const A& a, const A&, A& out) { Math::Batch::Normalize(a, out); });
+    RegisterArrays<T>("Vector3Array_Expression", [=](const A& a, const A& b, A& out) { out = a + (b * scalar) - (a / b); });
+    RegisterReduction<T>("Vector3Array_DotProduct", [](const A& a, const A& b, S out) { Math::Batch::DotProduct(a, b, out); });
+    RegisterReduction<T>("Vector3Array_SquareMagnitude", [](const A& a, const A&, S out) { Math::Batch::SquareMagnitude(a, out); });
+    RegisterReduction<T>("Vector3Array_Magnitude", [](const A& a, const A&, S out) { Math::Batch::Magnitude(a, out); });
+
+    if constexpr(std::is_floating_point_v<T>)
+    {
+      RegisterArrays<T>("Vector3Array_NormalizeFast", [](const A& a, const A&, A& out) { Math::Batch::Normalize(a, out, Math::Precision::Fast()); });
+      RegisterArrays<T>("Vector3Array_NormalizeApprox", [](const A& a, const A&, A& out) { Math::Batch::Normalize(a, out, Math::Precision::Approx()); });
+      RegisterReduction<T>("Vector3Array_MagnitudeFast", [](const A& a, const A&, S out) { Math::Batch::Magnitude(a, out, Math::Precision::Fast()); });
+      RegisterReduction<T>("Vector3Array_MagnitudeApprox", [](const A& a, const A&, S out) { Math::Batch::Magnitude(a, out, Math::Precision::Approx()); });
+    }
+
+    return true;
+  }
+
+  static const bool kVector3ArrayRegistered = RegisterVector3Array<float>() && RegisterVector3Array<double>() && RegisterVector3Array<int>();
+} // namespace Benchmark
@@ -0,0 +1,455 @@
+#ifndef __MATH__VECTOR3ARRAY_HPP__
+#define __MATH__VECTOR3ARRAY_HPP__
+
+#include "AlignedAllocator.hpp"
+#include "Precision.hpp"
+#include "Simd.hpp"
+#include "Span.hpp"
+#include "Vector3.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// Structure-of-arrays storage for Vector3, keeping each component in its own contiguous, cache line aligned array
+template<class T, std::enable_if_t<std::is_arithmetic_v<T> && std::is_signed_v<T>, bool> = true>
+class Vector3Array
+{
+  public:
+  using Container = std::vector<T, Math::AlignedAllocator<T>>;
+
+  Vector3<T> operator[](std::size_t index) const { return Vector3<T>(m_X[index], m_Y[index], m_Z[index]); }
+
+  void Set(std::size_t index, const Vector3<T>& value)
+  {
+    m_X[index] = value.GetX();
+    m_Y[index] = value.GetY();
+    m_Z[index] = value.GetZ();
+  }
+
+  void PushBack(const Vector3<T>& value)
+  {
+    m_X.push_back(value.GetX());
+    m_Y.push_back(value.GetY());
+    m_Z.push_back(value.GetZ());
+  }
+
+  void Resize(std::size_t size)
+  {
+    m_X.resize(size);
+    m_Y.resize(size);
+    m_Z.resize(size);
+  }
+
+  void Reserve(std::size_t capacity)
+  {
+    m_X.reserve(capacity);
+    m_Y.reserve(capacity);
+    m_Z.reserve(capacity);
+  }
+
+  void Clear()
+  {
+    m_X.clear();
+    m_Y.clear();
+    m_Z.clear();
+  }
+
+  void ToVectors(Math::Span<Vector3<T>> out) const
+  {
+    assert(out.GetSize() >= GetSize());
+
+    const std::size_t count = GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      out[i] = Vector3<T>(m_X[i], m_Y[i], m_Z[i]);
+    }
+  }
+
+  std::vector<Vector3<T>> ToVectors() const
+  {
+    std::vector<Vector3<T>> result(GetSize());
+    ToVectors(Math::Span<Vector3<T>>(result));
+    return result;
+  }
+
+  std::size_t GetSize() const { return m_X.size(); }
+  bool IsEmpty() const { return m_X.empty(); }
+
+  Math::Span<T> GetX() { return Math::Span<T>(m_X); }
+  Math::Span<T> GetY() { return Math::Span<T>(m_Y); }
+  Math::Span<T> GetZ() { return Math::Span<T>(m_Z); }
+
+  Math::Span<const T> GetX() const { return Math::Span<const T>(m_X); }
+  Math::Span<const T> GetY() const { return Math::Span<const T>(m_Y); }
+  Math::Span<const T> GetZ() const { return Math::Span<const T>(m_Z); }
+
+  // Evaluates a lazy expression from VectorExpression.hpp straight into the component arrays, one loop per component
+  template<class Expression, std::enable_if_t<Expression::kVectorExpression, bool> = true>
+  Vector3Array& operator=(const Expression& expression)
+  {
+    const std::size_t count = expression.GetSize();
+    Resize(count);
+
+    for(std::size_t i = 0u; i < count; i++) m_X[i] = expression.template Get<0u>(i);
+    for(std::size_t i = 0u; i < count; i++) m_Y[i] = expression.template Get<1u>(i);
+    for(std::size_t i = 0u; i < count; i++) m_Z[i] = expression.template Get<2u>(i);
+
+    return *this;
+  }
+
+  template<class Expression, std::enable_if_t<Expression::kVectorExpression, bool> = true>
+  Vector3Array(const Expression& expression)
+  {
+    (*this) = expression;
+  }
+
+  Vector3Array(Math::Span<const Vector3<T>> values)
+      : m_X(values.GetSize())
+      , m_Y(values.GetSize())
+      , m_Z(values.GetSize())
+  {
+    const std::size_t count = values.GetSize();
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      m_X[i] = values[i].GetX();
+      m_Y[i] = values[i].GetY();
+      m_Z[i] = values[i].GetZ();
+    }
+  }
+
+  explicit Vector3Array(std::size_t size)
+      : m_X(size)
+      , m_Y(size)
+      , m_Z(size)
+  {}
+
+  Vector3Array() = default;
+
+  private:
+  Container m_X;
+  Container m_Y;
+  Container m_Z;
+};
+
+namespace Math::Batch
+{
+  // The kernels below walk plain component arrays so the compiler can vectorize them. The output may alias any of the inputs.
+
+  template<class T>
+  void Add(const Vector3Array<T>& a, const Vector3Array<T>& b, Vector3Array<T>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Vector3Array::Add", a.GetSize());
+
+    assert(a.GetSize() == b.GetSize());
+
+    const std::size_t count = a.GetSize();
+    out.Resize(count);
+
+    const T* ax = a.GetX().GetData();
+    const T* ay = a.GetY().GetData();
+    const T* az = a.GetZ().GetData();
+    const T* bx = b.GetX().GetData();
+    const T* by = b.GetY().GetData();
+    const T* bz = b.GetZ().GetData();
+    T* ox       = out.GetX().GetData();
+    T* oy       = out.GetY().GetData();
+    T* oz       = out.GetZ().GetData();
+
+    for(std::size_t i = 0u; i < count; i++) ox[i] = ax[i] + bx[i];
+    for(std::size_t i = 0u; i < count; i++) oy[i] = ay[i] + by[i];
+    for(std::size_t i = 0u; i < count; i++) oz[i] = az[i] + bz[i];
+  }
+
+  template<class T>
+  void Subtract(const Vector3Array<T>& a, const Vector3Array<T>& b, Vector3Array<T>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Vector3Array::Subtract", a.GetSize());
+
+    assert(a.GetSize() == b.GetSize());
+
+    const std::size_t count = a.GetSize();
+    out.Resize(count);
+
+    const T* ax = a.GetX().GetData();
+    const T* ay = a.GetY().GetData();
+    const T* az = a.GetZ().GetData();
+    const T* bx = b.GetX().GetData();
+    const T* by = b.GetY().GetData();
+    const T* bz = b.GetZ().GetData();
+    T* ox       = out.GetX().GetData();
+    T* oy       = out.GetY().GetData();
+    T* oz       = out.GetZ().GetData();
+
+    for(std::size_t i = 0u; i < count; i++) ox[i] = ax[i] - bx[i];
+    for(std::size_t i = 0u; i < count; i++) oy[i] = ay[i] - by[i];
+    for(std::size_t i = 0u; i < count; i++) oz[i] = az[i] - bz[i];
+  }
+
+  template<class T>
+  void Scale(const Vector3Array<T>& a, T scale, Vector3Array<T>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Vector3Array::Scale", a.GetSize());
+
+    const std::size_t count = a.GetSize();
+    out.Resize(count);
+
+    const T* ax = a.GetX().GetData();
+    const T* ay = a.GetY().GetData();
+    const T* az = a.GetZ().GetData();
+    T* ox       = out.GetX().GetData();
+    T* oy       = out.GetY().GetData();
+    T* oz       = out.GetZ().GetData();
+
+    for(std::size_t i = 0u; i < count; i++) ox[i] = ax[i] * scale;
+    for(std::size_t i = 0u; i < count; i++) oy[i] = ay[i] * scale;
+    for(std::size_t i = 0u; i < count; i++) oz[i] = az[i] * scale;
+  }
+
+  template<class T>
+  void DotProduct(const Vector3Array<T>& a, const Vector3Array<T>& b, Math::Span<T> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Vector3Array::DotProduct", a.GetSize());
+
+    assert(a.GetSize() == b.GetSize());
+    assert(out.GetSize() >= a.GetSize());
+
+    const std::size_t count = a.GetSize();
+    const T* ax             = a.GetX().GetData();
+    const T* ay             = a.GetY().GetData();
+    const T* az             = a.GetZ().GetData();
+    const T* bx             = b.GetX().GetData();
+    const T* by             = b.GetY().GetData();
+    const T* bz             = b.GetZ().GetData();
+    T* o                    = out.GetData();
+
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      o[i] = (ax[i] * bx[i]) + (ay[i] * by[i]) + (az[i] * bz[i]);
+    }
+  }
+
+  template<class T>
+  void CrossProduct(const Vector3Array<T>& a, const Vector3Array<T>& b, Vector3Array<T>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Vector3Array::CrossProduct", a.GetSize());
+
+    assert(a.GetSize() == b.GetSize());
+
+    const std::size_t count = a.GetSize();
+    out.Resize(count);
+
+    const T* ax = a.GetX().GetData();
+    const T* ay = a.GetY().GetData();
+    const T* az = a.GetZ().GetData();
+    const T* bx = b.GetX().GetData();
+    const T* by = b.GetY().GetData();
+    const T* bz = b.GetZ().GetData();
+    T* ox       = out.GetX().GetData();
+    T* oy       = out.GetY().GetData();
+    T* oz       = out.GetZ().GetData();
+
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T x = (ay[i] * bz[i]) - (az[i] * by[i]);
+      const T y = (az[i] * bx[i]) - (ax[i] * bz[i]);
+      const T z = (ax[i] * by[i]) - (ay[i] * bx[i]);
+
+      ox[i] = x;
+      oy[i] = y;
+      oz[i] = z;
+    }
+  }
+
+  template<class T>
+  void SquareMagnitude(const Vector3Array<T>& a, Math::Span<T> out)
+  {
+    DotProduct(a, a, out);
+  }
+
+  template<class T>
+  void Magnitude(const Vector3Array<T>& a, Math::Span<T> out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Vector3Array::Magnitude", a.GetSize());
+
+    assert(out.GetSize() >= a.GetSize());
+
+    const std::size_t count = a.GetSize();
+    const T* ax             = a.GetX().GetData();
+    const T* ay             = a.GetY().GetData();
+    const T* az             = a.GetZ().GetData();
+    T* o                    = out.GetData();
+
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      o[i] = static_cast<T>(std::sqrt((ax[i] * ax[i]) + (ay[i] * ay[i]) + (az[i] * az[i])));
+    }
+  }
+
+  template<class T>
+  void Normalize(const Vector3Array<T>& a, Vector3Array<T>& out)
+  {
+    MATH_INSTRUMENT_BATCH("Batch::Vector3Array::Normalize", a.GetSize());
+
+    constexpr T kZero = static_cast<T>(0);
+    constexpr T kOne  = static_cast<T>(1);
+
+    const std::size_t count = a.GetSize();
+    out.Resize(count);
+
+    const T* ax = a.GetX().GetData();
+    const T* ay = a.GetY().GetData();
+    const T* az = a.GetZ().GetData();
+    T* ox       = out.GetX().GetData();
+    T* oy       = out.GetY().GetData();
+    T* oz       = out.GetZ().GetData();
+
+    if constexpr(std::is_floating_point_v<T>)
+    {
+      // Zero-length vectors are left untouched, matching Vector3::ToNormalized, through a select instead of a branch
+      for(std::size_t i = 0u; i < count; i++)
+      {
+        const T magnitude = std::sqrt((ax[i] * ax[i]) + (ay[i] * ay[i]) + (az[i] * az[i]));
+        const T factor    = (magnitude != kZero) ? (kOne / magnitude) : kOne;
+
+        ox[i] = ax[i] * factor;
+        oy[i] = ay[i] * factor;
+        oz[i] = az[i] * factor;
+      }
+    }
+    else
+    {
+      for(std::size_t i = 0u; i < count; i++)
+      {
+        const T magnitude = static_cast<T>(std::sqrt((ax[i] * ax[i]) + (ay[i] * ay[i]) + (az[i] * az[i])));
+        const T divisor   = (magnitude != kZero) ? magnitude : kOne;
+
+        ox[i] = ax[i] / divisor;
+        oy[i] = ay[i] / divisor;
+        oz[i] = az[i] / divisor;
+      }
+    }
+  }
+
+  // Magnitudes to the precision of the policy, blocks with a lane outside the estimate range take the scalar path
+  template<class T, class P, std::enable_if_t<Math::Precision::kPolicy<P>, bool> = true>
+  void Magnitude(const Vector3Array<T>& a, Math::Span<T> out, P)
+  {
+    if constexpr(!Math::Precision::kEstimated<P, T>)
+    {
+      Magnitude(a, out);
+    }
+    else
+    {
+      MATH_INSTRUMENT_BATCH("Batch::Vector3Array::Magnitude", a.GetSize());
+
+      assert(out.GetSize() >= a.GetSize());
+
+      const std::size_t count = a.GetSize();
+      const T* ax             = a.GetX().GetData();
+      const T* ay             = a.GetY().GetData();
+      const T* az             = a.GetZ().GetData();
+      T* o                    = out.GetData();
+
+      std::size_t i = 0u;
+      if constexpr(Math::Simd::Traits<T>::kEnabled)
+      {
+        constexpr std::size_t kLanes = Math::Simd::Traits<T>::kLanes;
+
+        const auto low  = Simd::Broadcast(Math::Detail::kEstimateMin<T>);
+        const auto high = Simd::Broadcast(Math::Detail::kEstimateMax<T>);
+        for(; (i + kLanes) <= count; i += kLanes)
+        {
+          const auto x      = Simd::LoadUnaligned(ax + i);
+          const auto y      = Simd::LoadUnaligned(ay + i);
+          const auto z      = Simd::LoadUnaligned(az + i);
+          const auto square = Simd::Add(Simd::Add(Simd::Multiply(x, x), Simd::Multiply(y, y)), Simd::Multiply(z, z));
+          if(Simd::AllWithin(square, low, high))
+          {
+            Simd::StoreUnaligned(o + i, Simd::Multiply(square, Math::Detail::ReciprocalSqrtRegister<P>(square)));
+            continue;
+          }
+
+          for(std::size_t j = i; j < (i + kLanes); j++)
+          {
+            o[j] = Math::Sqrt((ax[j] * ax[j]) + (ay[j] * ay[j]) + (az[j] * az[j]), P());
+          }
+        }
+      }
+
+      for(; i < count; i++)
+      {
+        o[i] = Math::Sqrt((ax[i] * ax[i]) + (ay[i] * ay[i]) + (az[i] * az[i]), P());
+      }
+    }
+  }
+
+  // Normalization to the precision of the policy, zero-length vectors are left untouched like with the exact kernel
+  template<class T, class P, std::enable_if_t<Math::Precision::kPolicy<P>, bool> = true>
+  void Normalize(const Vector3Array<T>& a, Vector3Array<T>& out, P)
+  {
+    if constexpr(!Math::Precision::kEstimated<P, T>)
+    {
+      Normalize(a, out);
+    }
+    else
+    {
+      MATH_INSTRUMENT_BATCH("Batch::Vector3Array::Normalize", a.GetSize());
+
+      constexpr T kZero = static_cast<T>(0);
+      constexpr T kOne  = static_cast<T>(1);
+
+      const std::size_t count = a.GetSize();
+      out.Resize(count);
+
+      const T* ax = a.GetX().GetData();
+      const T* ay = a.GetY().GetData();
+      const T* az = a.GetZ().GetData();
+      T* ox       = out.GetX().GetData();
+      T* oy       = out.GetY().GetData();
+      T* oz       = out.GetZ().GetData();
+
+      const auto normalize = [&](std::size_t index)
+      {
+        const T square = (ax[index] * ax[index]) + (ay[index] * ay[index]) + (az[index] * az[index]);
+        const T factor = (square != kZero) ? Math::ReciprocalSqrt(square, P()) : kOne;
+
+        ox[index] = ax[index] * factor;
+        oy[index] = ay[index] * factor;
+        oz[index] = az[index] * factor;
+      };
+
+      std::size_t i = 0u;
+      if constexpr(Math::Simd::Traits<T>::kEnabled)
+      {
+        constexpr std::size_t kLanes = Math::Simd::Traits<T>::kLanes;
+
+        const auto low  = Simd::Broadcast(Math::Detail::kEstimateMin<T>);
+        const auto high = Simd::Broadcast(Math::Detail::kEstimateMax<T>);
+        for(; (i + kLanes) <= count; i += kLanes)
+        {
+          const auto x      = Simd::LoadUnaligned(ax + i);
+          const auto y      = Simd::LoadUnaligned(ay + i);
+          const auto z      = Simd::LoadUnaligned(az + i);
+          const auto square = Simd::Add(Simd::Add(Simd::Multiply(x, x), Simd::Multiply(y, y)), Simd::Multiply(z, z));
+          if(Simd::AllWithin(square, low, high))
+          {
+            const auto factor = Math::Detail::ReciprocalSqrtRegister<P>(square);
+            Simd::StoreUnaligned(ox + i, Simd::Multiply(x, factor));
+            Simd::StoreUnaligned(oy + i, Simd::Multiply(y, factor));
+            Simd::StoreUnaligned(oz + i, Simd::Multiply(z, factor));
+            continue;
+          }
+
+          for(std::size_t j = i; j < (i + kLanes); j++) normalize(j);
+        }
+      }
+
+      for(; i < count; i++) normalize(i);
+    }
+  }
+} // namespace Math::Batch
+
+#endif // __MATH__VECTOR3ARRAY_HPP__
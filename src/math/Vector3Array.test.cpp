@@ -0,0 +1,120 @@
+#include "Vector3Array.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  static std::vector<Vector3<double>> CreateVectors(std::size_t count)
+  {
+    std::vector<Vector3<double>> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const double value = static_cast<double>(i);
+      result.push_back(Vector3<double>(value - 8.0, (value * 0.5) + 1.0, 3.0 - (value * 0.25)));
+    }
+
+    return result;
+  }
+
+  TEST(Vector3Array, Conversion)
+  {
+    const std::vector<Vector3<double>> vectors = CreateVectors(37u);
+    const Vector3Array<double> array(vectors);
+    ASSERT_EQ(array.GetSize(), vectors.size());
+
+    const std::vector<Vector3<double>> result = array.ToVectors();
+    ASSERT_EQ(result.size(), vectors.size());
+    for(std::size_t i = 0u; i < vectors.size(); i++)
+    {
+      ASSERT_EQ(result[i].GetX(), vectors[i].GetX());
+      ASSERT_EQ(result[i].GetY(), vectors[i].GetY());
+      ASSERT_EQ(result[i].GetZ(), vectors[i].GetZ());
+      ASSERT_EQ(array[i].GetZ(), vectors[i].GetZ());
+    }
+  }
+
+  TEST(Vector3Array, Arithmetic)
+  {
+    const std::vector<Vector3<double>> vectorsA = CreateVectors(37u);
+    const std::vector<Vector3<double>> vectorsB = CreateVectors(74u);
+    const Vector3Array<double> a(vectorsA);
+    const Vector3Array<double> b(Math::Span<const Vector3<double>>(vectorsB).Subspan(37u));
+
+    Vector3Array<double> sum;
+    Vector3Array<double> difference;
+    Vector3Array<double> scaled;
+    Math::Batch::Add(a, b, sum);
+    Math::Batch::Subtract(a, b, difference);
+    Math::Batch::Scale(a, 2.5, scaled);
+
+    for(std::size_t i = 0u; i < a.GetSize(); i++)
+    {
+      const Vector3<double> expectedSum        = vectorsA[i] + vectorsB[i + 37u];
+      const Vector3<double> expectedDifference = vectorsA[i] - vectorsB[i + 37u];
+      const Vector3<double> expectedScaled     = vectorsA[i] * 2.5;
+
+      ASSERT_DOUBLE_EQ(sum[i].GetX(), expectedSum.GetX());
+      ASSERT_DOUBLE_EQ(sum[i].GetY(), expectedSum.GetY());
+      ASSERT_DOUBLE_EQ(sum[i].GetZ(), expectedSum.GetZ());
+      ASSERT_DOUBLE_EQ(difference[i].GetX(), expectedDifference.GetX());
+      ASSERT_DOUBLE_EQ(difference[i].GetY(), expectedDifference.GetY());
+      ASSERT_DOUBLE_EQ(difference[i].GetZ(), expectedDifference.GetZ());
+      ASSERT_DOUBLE_EQ(scaled[i].GetX(), expectedScaled.GetX());
+      ASSERT_DOUBLE_EQ(scaled[i].GetY(), expectedScaled.GetY());
+      ASSERT_DOUBLE_EQ(scaled[i].GetZ(), expectedScaled.GetZ());
+    }
+  }
+
+  TEST(Vector3Array, Products)
+  {
+    const std::vector<Vector3<double>> vectorsA = CreateVectors(37u);
+    const std::vector<Vector3<double>> vectorsB = CreateVectors(74u);
+    Vector3Array<double> a(vectorsA);
+    const Vector3Array<double> b(Math::Span<const Vector3<double>>(vectorsB).Subspan(37u));
+
+    std::vector<double> dot(a.GetSize());
+    Math::Batch::DotProduct(a, b, Math::Span<double>(dot));
+
+    // Output aliasing the first operand
+    Math::Batch::CrossProduct(a, b, a);
+
+    for(std::size_t i = 0u; i < a.GetSize(); i++)
+    {
+      const Vector3<double> expectedCross = Vector3<double>::CrossProduct(vectorsA[i], vectorsB[i + 37u]);
+
+      ASSERT_DOUBLE_EQ(dot[i], Vector3<double>::DotProduct(vectorsA[i], vectorsB[i + 37u]));
+      ASSERT_DOUBLE_EQ(a[i].GetX(), expectedCross.GetX());
+      ASSERT_DOUBLE_EQ(a[i].GetY(), expectedCross.GetY());
+      ASSERT_DOUBLE_EQ(a[i].GetZ(), expectedCross.GetZ());
+    }
+  }
+
+  TEST(Vector3Array, Normalize)
+  {
+    std::vector<Vector3<double>> vectors = CreateVectors(37u);
+    vectors.push_back(Vector3<double>::Zero);
+    Vector3Array<double> array(vectors);
+
+    std::vector<double> magnitude(array.GetSize());
+    Math::Batch::Magnitude(array, Math::Span<double>(magnitude));
+    Math::Batch::Normalize(array, array);
+
+    for(std::size_t i = 0u; i < array.GetSize(); i++)
+    {
+      const Vector3<double> expected = vectors[i].ToNormalized();
+
+      ASSERT_DOUBLE_EQ(magnitude[i], vectors[i].GetMagnitude());
+      ASSERT_NEAR(array[i].GetX(), expected.GetX(), 1e-15);
+      ASSERT_NEAR(array[i].GetY(), expected.GetY(), 1e-15);
+      ASSERT_NEAR(array[i].GetZ(), expected.GetZ(), 1e-15);
+    }
+
+    ASSERT_EQ(array[array.GetSize() - 1u].GetX(), 0.0);
+    ASSERT_EQ(array[array.GetSize() - 1u].GetY(), 0.0);
+    ASSERT_EQ(array[array.GetSize() - 1u].GetZ(), 0.0);
+  }
+} // namespace UnitTest
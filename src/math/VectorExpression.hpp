@@ -0,0 +1,320 @@
+#ifndef __MATH__VECTOREXPRESSION_HPP__
+#define __MATH__VECTOREXPRESSION_HPP__
+
+#include "Vector3.hpp"
+#include "Vector3Array.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+/*
+ * Opt-in expression templates. With this header included, +, -, * and / on Vector3Array operands build lightweight
+ * expression nodes instead of computing anything; the nodes are evaluated element by element straight into the
+ * destination array, so `out = a + b * s - c / d` runs one loop per component without temporary arrays. A single
+ * Vector3 or a scalar joins an expression as a broadcast value.
+ *
+ * Expressions over single vectors keep their eager member operators. Vectors are trivially copyable and a packed
+ * intermediate is one register, so there is no temporary to remove, while a node evaluates lane by lane in scalar code.
+ *
+ * Nodes refer to the arrays they read, so an expression must be evaluated before its operands go away or change size.
+ */
+namespace Math::Expression
+{
+  // Size reported by broadcast leaves, they adapt to the size of any array they are combined with
+  constexpr std::size_t kBroadcast = std::numeric_limits<std::size_t>::max();
+
+  struct Add
+  {
+    template<class T>
+    static T Apply(T a, T b)
+    {
+      return a + b;
+    }
+  };
+
+  struct Subtract
+  {
+    template<class T>
+    static T Apply(T a, T b)
+    {
+      return a - b;
+    }
+  };
+
+  struct Multiply
+  {
+    template<class T>
+    static T Apply(T a, T b)
+    {
+      return a * b;
+    }
+  };
+
+  struct Divide
+  {
+    template<class T>
+    static T Apply(T a, T b)
+    {
+      return a / b;
+    }
+  };
+
+  // Common interface of every node, the value type of its components
+  template<class T>
+  struct Node
+  {
+    using ValueType = T;
+
+    static constexpr bool kVectorExpression = true;
+  };
+
+  template<class T>
+  class ArrayLeaf : public Node<T>
+  {
+    public:
+    template<std::size_t Component>
+    T Get(std::size_t index) const
+    {
+      return m_Components[Component][index];
+    }
+
+    std::size_t GetSize() const { return m_Size; }
+
+    explicit ArrayLeaf(const Vector3Array<T>& values)
+        : m_Components {values.GetX().GetData(), values.GetY().GetData(), values.GetZ().GetData()}
+        , m_Size(values.GetSize())
+    {}
+
+    private:
+    const T* m_Components[3];
+    std::size_t m_Size;
+  };
+
+  template<class T>
+  class VectorLeaf : public Node<T>
+  {
+    public:
+    template<std::size_t Component>
+    T Get(std::size_t) const
+    {
+      return m_Components[Component];
+    }
+
+    std::size_t GetSize() const { return kBroadcast; }
+
+    explicit VectorLeaf(const Vector3<T>& value)
+        : m_Components {value.GetX(), value.GetY(), value.GetZ()}
+    {}
+
+    private:
+    T m_Components[3];
+  };
+
+  template<class T>
+  class ScalarLeaf : public Node<T>
+  {
+    public:
+    template<std::size_t>
+    T Get(std::size_t) const
+    {
+      return m_Value;
+    }
+
+    std::size_t GetSize() const { return kBroadcast; }
+
+    explicit ScalarLeaf(T value)
+        : m_Value(value)
+    {}
+
+    private:
+    T m_Value;
+  };
+
+  template<class Op, class L, class R>
+  class Binary : public Node<typename L::ValueType>
+  {
+    public:
+    template<std::size_t Component>
+    typename L::ValueType Get(std::size_t index) const
+    {
+      return Op::Apply(m_Lhs.template Get<Component>(index), m_Rhs.template Get<Component>(index));
+    }
+
+    std::size_t GetSize() const
+    {
+      const std::size_t lhs = m_Lhs.GetSize();
+      const std::size_t rhs = m_Rhs.GetSize();
+      assert((lhs == kBroadcast) || (rhs == kBroadcast) || (lhs == rhs));
+      return (lhs == kBroadcast) ? rhs : lhs;
+    }
+
+    Binary(const L& lhs, const R& rhs)
+        : m_Lhs(lhs)
+        , m_Rhs(rhs)
+    {
+      static_assert(std::is_same_v<typename L::ValueType, typename R::ValueType>, "Operands must share their value type");
+    }
+
+    private:
+    L m_Lhs;
+    R m_Rhs;
+  };
+
+  template<class E>
+  class Negated : public Node<typename E::ValueType>
+  {
+    public:
+    template<std::size_t Component>
+    typename E::ValueType Get(std::size_t index) const
+    {
+      return -m_Value.template Get<Component>(index);
+    }
+
+    std::size_t GetSize() const { return m_Value.GetSize(); }
+
+    explicit Negated(const E& value)
+        : m_Value(value)
+    {}
+
+    private:
+    E m_Value;
+  };
+
+  // How each kind of operand enters an expression: nodes as they are, arrays and vectors as leaves, scalars broadcast.
+  // Only nodes and arrays are lazy, an expression needs one of them.
+  template<class X, class = void>
+  struct Operand
+  {
+    static constexpr bool kValid = false;
+    static constexpr bool kLazy  = false;
+  };
+
+  template<class X>
+  struct Operand<X, std::enable_if_t<X::kVectorExpression>>
+  {
+    static constexpr bool kValid = true;
+    static constexpr bool kLazy  = true;
+    using ValueType              = typename X::ValueType;
+
+    template<class>
+    static const X& ToNode(const X& value)
+    {
+      return value;
+    }
+  };
+
+  template<class T>
+  struct Operand<Vector3Array<T>>
+  {
+    static constexpr bool kValid = true;
+    static constexpr bool kLazy  = true;
+    using ValueType              = T;
+
+    template<class>
+    static ArrayLeaf<T> ToNode(const Vector3Array<T>& value)
+    {
+      return ArrayLeaf<T>(value);
+    }
+  };
+
+  template<class T>
+  struct Operand<Vector3<T>>
+  {
+    static constexpr bool kValid = true;
+    static constexpr bool kLazy  = false;
+    using ValueType              = T;
+
+    template<class>
+    static VectorLeaf<T> ToNode(const Vector3<T>& value)
+    {
+      return VectorLeaf<T>(value);
+    }
+  };
+
+  template<class X>
+  struct Operand<X, std::enable_if_t<std::is_arithmetic_v<X>>>
+  {
+    static constexpr bool kValid = true;
+    static constexpr bool kLazy  = false;
+
+    // Takes its value type from the other operand
+    template<class T>
+    static ScalarLeaf<T> ToNode(X value)
+    {
+      return ScalarLeaf<T>(static_cast<T>(value));
+    }
+  };
+
+  // The operand that is not a bare scalar decides the value type
+  template<class L, class R>
+  using Reference = std::conditional_t<std::is_arithmetic_v<L>, Operand<R>, Operand<L>>;
+
+  template<class L, class R>
+  constexpr bool kEnabled = Operand<L>::kValid && Operand<R>::kValid && (Operand<L>::kLazy || Operand<R>::kLazy);
+
+  template<class Op, class L, class R>
+  auto MakeBinary(const L& lhs, const R& rhs)
+  {
+    using T = typename Reference<L, R>::ValueType;
+
+    const auto left  = Operand<L>::template ToNode<T>(lhs);
+    const auto right = Operand<R>::template ToNode<T>(rhs);
+    return Binary<Op, std::decay_t<decltype(left)>, std::decay_t<decltype(right)>>(left, right);
+  }
+} // namespace Math::Expression
+
+namespace Math
+{
+  // A leaf over an array, for passing an expression on before any operator has been applied
+  template<class T>
+  Expression::ArrayLeaf<T> Lazy(const Vector3Array<T>& values)
+  {
+    return Expression::ArrayLeaf<T>(values);
+  }
+} // namespace Math
+
+template<class L, class R, std::enable_if_t<Math::Expression::kEnabled<L, R>, bool> = true>
+auto operator+(const L& lhs, const R& rhs)
+{
+  return Math::Expression::MakeBinary<Math::Expression::Add>(lhs, rhs);
+}
+
+template<class L, class R, std::enable_if_t<Math::Expression::kEnabled<L, R>, bool> = true>
+auto operator-(const L& lhs, const R& rhs)
+{
+  return Math::Expression::MakeBinary<Math::Expression::Subtract>(lhs, rhs);
+}
+
+template<class L, class R, std::enable_if_t<Math::Expression::kEnabled<L, R>, bool> = true>
+auto operator*(const L& lhs, const R& rhs)
+{
+  return Math::Expression::MakeBinary<Math::Expression::Multiply>(lhs, rhs);
+}
+
+template<class L, class R, std::enable_if_t<Math::Expression::kEnabled<L, R>, bool> = true>
+auto operator/(const L& lhs, const R& rhs)
+{
+  return Math::Expression::MakeBinary<Math::Expression::Divide>(lhs, rhs);
+}
+
+template<class E, std::enable_if_t<Math::Expression::Operand<E>::kLazy, bool> = true>
+auto operator-(const E& value)
+{
+  using Operand = Math::Expression::Operand<E>;
+
+  const auto node = Operand::template ToNode<typename Operand::ValueType>(value);
+  return Math::Expression::Negated<std::decay_t<decltype(node)>>(node);
+}
+
+namespace Math::Expression
+{
+  // Lets argument-dependent lookup find the operators from inside other namespaces
+  using ::operator+;
+  using ::operator-;
+  using ::operator*;
+  using ::operator/;
+} // namespace Math::Expression
+
+#endif // __MATH__VECTOREXPRESSION_HPP__
@@ -0,0 +1,93 @@
+#include "VectorExpression.hpp"
+
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  template<class T>
+  class VectorExpressionTyped : public Test
+  {};
+
+  using VectorExpressionTypes = Types<float, double>;
+  TYPED_TEST_SUITE(VectorExpressionTyped, VectorExpressionTypes);
+
+  template<class T>
+  static Vector3Array<T> CreateArray(std::size_t count, T offset)
+  {
+    Vector3Array<T> result;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const T value = static_cast<T>(i) + offset;
+      result.PushBack(Vector3<T>(value, value * static_cast<T>(2), static_cast<T>(1) - value));
+    }
+
+    return result;
+  }
+
+  TYPED_TEST(VectorExpressionTyped, Array)
+  {
+    using T = TypeParam;
+
+    const Vector3Array<T> a = CreateArray<T>(37u, T(1));
+    const Vector3Array<T> b = CreateArray<T>(37u, T(-4));
+    const Vector3Array<T> c = CreateArray<T>(37u, T(0.5));
+    const Vector3Array<T> d = CreateArray<T>(37u, T(100));
+    const Vector3<T> shift(T(1), T(-2), T(3));
+    const T s = T(1.5);
+
+    const Vector3Array<T> result = a + b * s - c / d;
+    Vector3Array<T> assigned;
+    assigned = -(a - shift) * T(2) + T(1) / d;
+
+    ASSERT_EQ(result.GetSize(), a.GetSize());
+    ASSERT_EQ(assigned.GetSize(), a.GetSize());
+    for(std::size_t i = 0u; i < a.GetSize(); i++)
+    {
+      // Component-wise evaluation performs exactly the operations the eager operators do
+      ASSERT_TRUE(result[i] == ((a[i] + (b[i] * s)) - (c[i] / d[i])));
+      ASSERT_TRUE(assigned[i] == ((-(a[i] - shift) * T(2)) + (Vector3<T>::One / d[i])));
+    }
+  }
+
+  TYPED_TEST(VectorExpressionTyped, Alias)
+  {
+    using T = TypeParam;
+
+    Vector3Array<T> a       = CreateArray<T>(20u, T(1));
+    const Vector3Array<T> b = CreateArray<T>(20u, T(3));
+    const Vector3Array<T> c = a;
+
+    a = a * T(2) + b;
+    for(std::size_t i = 0u; i < a.GetSize(); i++)
+    {
+      ASSERT_TRUE(a[i] == ((c[i] * T(2)) + b[i]));
+    }
+  }
+
+  TYPED_TEST(VectorExpressionTyped, Single)
+  {
+    using T = TypeParam;
+
+    const Vector3<T> a(T(1), T(2), T(3));
+    const Vector3<T> b(T(-4), T(5), T(0.5));
+    const Vector3<T> c(T(2), T(2), T(8));
+
+    // Single vectors keep their eager operators with the header included
+    const auto eager = a + b * T(2) - c / T(4);
+    static_assert(std::is_same_v<std::decay_t<decltype(eager)>, Vector3<T>>);
+    ASSERT_TRUE(eager == Vector3<T>(T(-7.5), T(11.5), T(2)));
+
+    // and join array expressions as broadcast values
+    const Vector3Array<T> values = CreateArray<T>(5u, T(1));
+    const Vector3Array<T> result = values * a + (b - c);
+    for(std::size_t i = 0u; i < values.GetSize(); i++)
+    {
+      ASSERT_TRUE(result[i] == ((values[i] * a) + (b - c)));
+    }
+  }
+} // namespace UnitTest